@@ -18,38 +18,55 @@
 #include <fftw3.h>
 
 #include "ptime.h"
+#include "util.h"
 
 #if defined(USE_FFTWF)
 #include "util-fftwf.h"
 typedef fftwf_complex       FFTW_COMPLEX_T;
 typedef fftwf_plan          FFTW_PLAN_T;
 #define ASSERT_FFTW_MALLOC  assert_fftwf_malloc
-#define FFTW_FREE           fftwf_free
+#define FFTW_FREE           free_fftwf
 #define FFTW_PLAN_2D        fftwf_plan_dft_2d
 #define FFTW_PLAN_DESTROY   fftwf_destroy_plan
 #define FFTW_EXECUTE        fftwf_execute
 #define FILL_RAND           fill_rand_fftwf
+#define PLAN_FLAGS          plan_flags_fftwf
+#define WISDOM_PATH         wisdom_path_fftwf
+#define WISDOM_IMPORT       wisdom_import_fftwf
+#define WISDOM_EXPORT       wisdom_export_fftwf
 #else
 #include "util-fftw.h"
 typedef fftw_complex        FFTW_COMPLEX_T;
 typedef fftw_plan           FFTW_PLAN_T;
 #define ASSERT_FFTW_MALLOC  assert_fftw_malloc
-#define FFTW_FREE           fftw_free
+#define FFTW_FREE           free_fftw
 #define FFTW_PLAN_2D        fftw_plan_dft_2d
 #define FFTW_PLAN_DESTROY   fftw_destroy_plan
 #define FFTW_EXECUTE        fftw_execute
 #define FILL_RAND           fill_rand_fftw
+#define PLAN_FLAGS          plan_flags_fftw
+#define WISDOM_PATH         wisdom_path_fftw
+#define WISDOM_IMPORT       wisdom_import_fftw
+#define WISDOM_EXPORT       wisdom_export_fftw
 #endif
 
 #define PRINT_ELAPSED_TIME(prefix, t1, t2) \
     printf("%s (ms): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000000.0);
 
+static unsigned plan_flags = FFTW_ESTIMATE;
+static const char *wisdom_dir = NULL;
+
 static void data_alloc(FFTW_COMPLEX_T **A, FFTW_COMPLEX_T **B, FFTW_PLAN_T *p,
                        size_t nrows, size_t ncols)
 {
+    struct timespec t1, t2;
     *A = ASSERT_FFTW_MALLOC(nrows * ncols * sizeof(**A));
     *B = ASSERT_FFTW_MALLOC(nrows * ncols * sizeof(**B));
-    *p = FFTW_PLAN_2D(nrows, ncols, *A, *B, FFTW_FORWARD, FFTW_ESTIMATE);
+    // planning with more rigor than estimate may overwrite A and B
+    ptime_gettime_monotonic(&t1);
+    *p = FFTW_PLAN_2D(nrows, ncols, *A, *B, FFTW_FORWARD, plan_flags);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("plan", &t1, &t2);
 }
 
 static void data_free(FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B, FFTW_PLAN_T p)
@@ -59,7 +76,7 @@ static void data_free(FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B, FFTW_PLAN_T p)
     FFTW_FREE(A);
 }
 
-static void fft_2d(size_t nrows, size_t ncols, bool do_init)
+static void fft_2d(size_t nrows, size_t ncols, bool do_init, bool do_huge)
 {
     struct timespec t1, t2;
     FFTW_COMPLEX_T *mat_in, *mat_out;
@@ -84,15 +101,64 @@ static void fft_2d(size_t nrows, size_t ncols, bool do_init)
     ptime_gettime_monotonic(&t2);
     PRINT_ELAPSED_TIME("fft-2d", &t1, &t2);
 
+    if (do_huge) {
+        printf("in-page-size (KiB): %zu\n", alloc_page_size(mat_in) / 1024);
+        printf("out-page-size (KiB): %zu\n", alloc_page_size(mat_out) / 1024);
+    }
+
     data_free(mat_in, mat_out, p);
 }
 
+/*
+ * FFTW wisdom is kept in a file in wisdom_dir for each matrix size and data
+ * type (the 2-D FFT isn't threaded).
+ */
+static void fft_wisdom_path(char *buf, size_t len, size_t nrows, size_t ncols)
+{
+    if ((size_t) WISDOM_PATH(buf, len, wisdom_dir, nrows, ncols, 1) >= len) {
+        errno = ENAMETOOLONG;
+        perror(wisdom_dir);
+        exit(errno);
+    }
+}
+
+static void fft_wisdom_import(size_t nrows, size_t ncols)
+{
+    char path[4096];
+    if (wisdom_dir) {
+        fft_wisdom_path(path, sizeof(path), nrows, ncols);
+        // a wisdom file that doesn't exist yet is created on export
+        if (WISDOM_IMPORT(path) && errno != ENOENT) {
+            perror(path);
+            exit(errno);
+        }
+    }
+}
+
+static void fft_wisdom_export(size_t nrows, size_t ncols)
+{
+    char path[4096];
+    if (wisdom_dir) {
+        fft_wisdom_path(path, sizeof(path), nrows, ncols);
+        if (WISDOM_EXPORT(path)) {
+            perror(path);
+        }
+    }
+}
+
 static void usage(const char *pname, int code)
 {
     fprintf(code ? stderr : stdout,
-            "Usage: %s -r ROWS -c COLS [-h]\n"
+            "Usage: %s -r ROWS -c COLS [-F RIGOR] [-W DIR] [-H] [-h]\n"
             "  -r, --rows=ROWS          Matrix row count, in [1, ULONG_MAX]\n"
             "  -c, --cols=COLS          Matrix column count, in [1, ULONG_MAX]\n"
+            "  -F, --plan-flags=RIGOR   FFTW planner rigor: estimate, measure, patient, or\n"
+            "                           exhaustive (default=estimate)\n"
+            "  -W, --fftw-wisdom=DIR    Load FFTW plans from the wisdom file in DIR for the\n"
+            "                           matrix size and type, if it exists, and save plans\n"
+            "                           to it after the benchmark\n"
+            "  -H, --huge-pages         Back matrices with huge pages, if possible, and\n"
+            "                           print the page size obtained for each\n"
             "  -i, --init               Initialize all matrices (simulates buffer reuse)\n"
             "                           Note: input matrix is always initialized\n"
             "  -h, --help               Print this message and exit\n",
@@ -109,10 +175,13 @@ static size_t assert_to_size_t(const char* str, const char* pname)
     return s;
 }
 
-static const char opts_short[] = "r:c:ih";
+static const char opts_short[] = "r:c:F:W:Hih";
 static const struct option opts_long[] = {
     {"rows",        required_argument,  NULL,   'r'},
     {"cols",        required_argument,  NULL,   'c'},
+    {"plan-flags",  required_argument,  NULL,   'F'},
+    {"fftw-wisdom", required_argument,  NULL,   'W'},
+    {"huge-pages",  no_argument,        NULL,   'H'},
     {"init",        no_argument,        NULL,   'i'},
     {"help",        no_argument,        NULL,   'h'},
     {0, 0, 0, 0}
@@ -123,6 +192,7 @@ int main(int argc, char **argv)
     size_t nrows = 0;
     size_t ncols = 0;
     bool do_init = false;
+    bool do_huge = false;
     int c;
 
     while ((c = getopt_long(argc, argv, opts_short, opts_long, NULL)) != -1) {
@@ -133,6 +203,18 @@ int main(int argc, char **argv)
         case 'c':
             ncols = assert_to_size_t(optarg, argv[0]);
             break;
+        case 'F':
+            if (PLAN_FLAGS(optarg, &plan_flags)) {
+                usage(argv[0], EINVAL);
+            }
+            break;
+        case 'W':
+            wisdom_dir = optarg;
+            break;
+        case 'H':
+            do_huge = true;
+            alloc_huge_pages(1);
+            break;
         case 'i':
             do_init = true;
             break;
@@ -147,6 +229,8 @@ int main(int argc, char **argv)
     if (!nrows || !ncols) {
         usage(argv[0], EINVAL);
     }
-    fft_2d(nrows, ncols, do_init);
+    fft_wisdom_import(nrows, ncols);
+    fft_2d(nrows, ncols, do_init, do_huge);
+    fft_wisdom_export(nrows, ncols);
     return 0;
 }
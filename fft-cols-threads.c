@@ -0,0 +1,90 @@
+/**
+ * Threaded 1-D FFTs down the columns of a matrix.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include "fft-cols.h"
+#include "fft-cols-threads.h"
+#include "thread-pool.h"
+
+struct fc_thread_arg {
+    const void* restrict A;
+    void* restrict B;
+    const void *tw;
+    size_t n;
+    size_t lda, ldb;
+    size_t c_min, c_max;
+    size_t panel;
+    size_t thr_num;
+};
+
+static void *fft_cols_fcmplx_thread(void *args)
+{
+    const struct fc_thread_arg *fc_arg = (const struct fc_thread_arg *)args;
+    fft_cols_fcmplx_radix2(fc_arg->A, fc_arg->B, fc_arg->n,
+                           fc_arg->lda, fc_arg->ldb,
+                           fc_arg->c_min, fc_arg->c_max, fc_arg->panel,
+                           fc_arg->tw);
+    return (void *)fc_arg->thr_num;
+}
+
+static void *fft_cols_dcmplx_thread(void *args)
+{
+    const struct fc_thread_arg *fc_arg = (const struct fc_thread_arg *)args;
+    fft_cols_dcmplx_radix2(fc_arg->A, fc_arg->B, fc_arg->n,
+                           fc_arg->lda, fc_arg->ldb,
+                           fc_arg->c_min, fc_arg->c_max, fc_arg->panel,
+                           fc_arg->tw);
+    return (void *)fc_arg->thr_num;
+}
+
+static void fft_cols_thr(void *(*fn)(void *), const void* restrict A,
+                         void* restrict B, size_t n, size_t A_cols,
+                         size_t lda, size_t ldb, size_t panel, const void *tw,
+                         size_t num_thr)
+{
+    struct fc_thread_arg *args = thread_pool_args(sizeof(*args), num_thr);
+    // divide whole panels as evenly as possible among the threads
+    const size_t num_panels = (A_cols + panel - 1) / panel;
+    size_t thr_num, p_min, p_max;
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        p_min = thr_num * num_panels / num_thr;
+        p_max = (thr_num + 1) * num_panels / num_thr;
+        args[thr_num].A = A;
+        args[thr_num].B = B;
+        args[thr_num].tw = tw;
+        args[thr_num].n = n;
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
+        args[thr_num].c_min = p_min * panel;
+        args[thr_num].c_max = p_max * panel < A_cols ? p_max * panel : A_cols;
+        args[thr_num].panel = panel;
+        args[thr_num].thr_num = thr_num;
+    }
+
+    thread_pool_run(fn, args, sizeof(*args), num_thr);
+}
+
+void fft_cols_fcmplx_thr_radix2(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t n, size_t A_cols, size_t lda, size_t ldb,
+                                size_t panel, const float complex *tw,
+                                size_t num_thr)
+{
+    fft_cols_thr(fft_cols_fcmplx_thread, A, B, n, A_cols, lda, ldb, panel, tw,
+                 num_thr);
+}
+
+void fft_cols_dcmplx_thr_radix2(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t n, size_t A_cols, size_t lda, size_t ldb,
+                                size_t panel, const double complex *tw,
+                                size_t num_thr)
+{
+    fft_cols_thr(fft_cols_dcmplx_thread, A, B, n, A_cols, lda, ldb, panel, tw,
+                 num_thr);
+}
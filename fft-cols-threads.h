@@ -0,0 +1,28 @@
+/**
+ * Threaded 1-D FFTs down the columns of a matrix (see fft-cols.h).
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef FFT_COLS_THREADS_H
+#define FFT_COLS_THREADS_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+/**
+ * Like fft_cols_*_radix2() over all A_cols columns, with the panels divided
+ * as evenly as possible among the threads.
+ */
+void fft_cols_fcmplx_thr_radix2(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t n, size_t A_cols, size_t lda, size_t ldb,
+                                size_t panel, const float complex *tw,
+                                size_t num_thr);
+void fft_cols_dcmplx_thr_radix2(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t n, size_t A_cols, size_t lda, size_t ldb,
+                                size_t panel, const double complex *tw,
+                                size_t num_thr);
+
+#endif /* FFT_COLS_THREADS_H */
@@ -0,0 +1,161 @@
+/**
+ * 1-D FFTs down the columns of a matrix, vectorized across columns.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#include "transpose-avx512-kernels.h"
+#endif
+
+#include "fft-cols.h"
+#include "util.h"
+
+// -std=c11 doesn't define M_PI
+#define FFT_COLS_PI 3.14159265358979323846
+
+float complex *fft_cols_twiddle_fcmplx(size_t n)
+{
+    float complex *tw = assert_malloc((n / 2 + 1) * sizeof(*tw));
+    size_t k;
+    for (k = 0; k < n / 2; k++) {
+        tw[k] = (float complex) cexp(-2 * FFT_COLS_PI * I * k / n);
+    }
+    return tw;
+}
+
+double complex *fft_cols_twiddle_dcmplx(size_t n)
+{
+    double complex *tw = assert_malloc((n / 2 + 1) * sizeof(*tw));
+    size_t k;
+    for (k = 0; k < n / 2; k++) {
+        tw[k] = cexp(-2 * FFT_COLS_PI * I * k / n);
+    }
+    return tw;
+}
+
+static size_t bit_reverse(size_t i, size_t bits)
+{
+    size_t r = 0;
+    for (; bits; bits--, i >>= 1) {
+        r = (r << 1) | (i & 1);
+    }
+    return r;
+}
+
+/*
+ * Radix-2 butterflies between two rows of a panel: x, y = x + w * y, x - w * y
+ * for len adjacent columns.  The complex products are written out in real
+ * arithmetic so the compiler vectorizes the remainder loop without -ffast-math.
+ */
+static inline void bfly_fcmplx(float complex* restrict x,
+                               float complex* restrict y, size_t len,
+                               float complex w)
+{
+    const float wr = crealf(w);
+    const float wi = cimagf(w);
+    float vr, vi;
+    size_t k = 0;
+#if defined(__AVX512F__)
+    // 8 float complex values per vector
+    double w_bits;
+    __m512d vw, u, v;
+    memcpy(&w_bits, &w, sizeof(w_bits));
+    vw = _mm512_set1_pd(w_bits);
+    for (; k + 8 <= len; k += 8) {
+        u = _mm512_loadu_pd((const double *)&x[k]);
+        v = cmul_cps(_mm512_loadu_pd((const double *)&y[k]), vw);
+        _mm512_storeu_ps((float *)&x[k], _mm512_add_ps(_mm512_castpd_ps(u),
+                                                       _mm512_castpd_ps(v)));
+        _mm512_storeu_ps((float *)&y[k], _mm512_sub_ps(_mm512_castpd_ps(u),
+                                                       _mm512_castpd_ps(v)));
+    }
+#endif
+    for (; k < len; k++) {
+        vr = crealf(y[k]) * wr - cimagf(y[k]) * wi;
+        vi = crealf(y[k]) * wi + cimagf(y[k]) * wr;
+        y[k] = CMPLXF(crealf(x[k]) - vr, cimagf(x[k]) - vi);
+        x[k] = CMPLXF(crealf(x[k]) + vr, cimagf(x[k]) + vi);
+    }
+}
+
+static inline void bfly_dcmplx(double complex* restrict x,
+                               double complex* restrict y, size_t len,
+                               double complex w)
+{
+    const double wr = creal(w);
+    const double wi = cimag(w);
+    double vr, vi;
+    size_t k = 0;
+#if defined(__AVX512F__)
+    // 4 double complex values per vector
+    __m512d vw, u, v;
+    vw = _mm512_castps_pd(_mm512_broadcast_f32x4(
+        _mm_castpd_ps(_mm_loadu_pd((const double *)&w))));
+    for (; k + 4 <= len; k += 4) {
+        u = _mm512_loadu_pd((const double *)&x[k]);
+        v = cmul_cpd(_mm512_loadu_pd((const double *)&y[k]), vw);
+        _mm512_storeu_pd((double *)&x[k], _mm512_add_pd(u, v));
+        _mm512_storeu_pd((double *)&y[k], _mm512_sub_pd(u, v));
+    }
+#endif
+    for (; k < len; k++) {
+        vr = creal(y[k]) * wr - cimag(y[k]) * wi;
+        vi = creal(y[k]) * wi + cimag(y[k]) * wr;
+        y[k] = CMPLX(creal(x[k]) - vr, cimag(x[k]) - vi);
+        x[k] = CMPLX(creal(x[k]) + vr, cimag(x[k]) + vi);
+    }
+}
+
+/*
+ * Each panel is copied from A to B in bit-reversed row order, then transformed
+ * in place, one stage of butterflies at a time, while it's in cache.
+ */
+#define FFT_COLS_RADIX2(fn_bfly, A, B, n, lda, ldb, c_min, c_max, panel, \
+                        tw) { \
+    size_t bits = 0, c, c_end, i, len, half, s, k; \
+    while (((size_t) 1 << bits) < (n)) { \
+        bits++; \
+    } \
+    for (c = (c_min); c < (c_max); c += (panel)) { \
+        c_end = (c_max) - c < (panel) ? (c_max) : c + (panel); \
+        for (i = 0; i < (n); i++) { \
+            memcpy(&(B)[bit_reverse(i, bits) * (ldb) + c], \
+                   &(A)[i * (lda) + c], (c_end - c) * sizeof(*(B))); \
+        } \
+        for (len = 2; len <= (n); len <<= 1) { \
+            half = len >> 1; \
+            for (s = 0; s < (n); s += len) { \
+                for (k = 0; k < half; k++) { \
+                    fn_bfly(&(B)[(s + k) * (ldb) + c], \
+                            &(B)[(s + k + half) * (ldb) + c], \
+                            c_end - c, (tw)[k * ((n) / len)]); \
+                } \
+            } \
+        } \
+    } \
+}
+
+void fft_cols_fcmplx_radix2(const float complex* restrict A,
+                            float complex* restrict B,
+                            size_t n, size_t lda, size_t ldb,
+                            size_t c_min, size_t c_max, size_t panel,
+                            const float complex *tw)
+{
+    FFT_COLS_RADIX2(bfly_fcmplx, A, B, n, lda, ldb, c_min, c_max, panel, tw);
+}
+
+void fft_cols_dcmplx_radix2(const double complex* restrict A,
+                            double complex* restrict B,
+                            size_t n, size_t lda, size_t ldb,
+                            size_t c_min, size_t c_max, size_t panel,
+                            const double complex *tw)
+{
+    FFT_COLS_RADIX2(bfly_dcmplx, A, B, n, lda, ldb, c_min, c_max, panel, tw);
+}
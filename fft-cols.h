@@ -0,0 +1,42 @@
+/**
+ * 1-D FFTs down the columns of a matrix, vectorized across columns.
+ *
+ * Rather than transposing a matrix so that 1-D FFTs run along its rows, these
+ * FFTs run down its columns, a panel of adjacent columns at a time: each step
+ * of the FFT applies the same operation (and twiddle factor) to a row of the
+ * panel, so the SIMD lanes compute independent FFTs, one per column.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef FFT_COLS_H
+#define FFT_COLS_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+/**
+ * Create the n / 2 twiddle factors w^k of a forward FFT of length n, where
+ * w = exp(-2 * pi * i / n).  Free with free().
+ */
+float complex *fft_cols_twiddle_fcmplx(size_t n);
+double complex *fft_cols_twiddle_dcmplx(size_t n);
+
+/**
+ * Forward radix-2 FFTs of length n down columns [c_min, c_max) of A (n rows,
+ * with row stride lda), to the same columns of B (with row stride ldb), in
+ * panels of the given number of columns.
+ * n must be a power of two, and tw its twiddle factors (see above).
+ */
+void fft_cols_fcmplx_radix2(const float complex* restrict A,
+                            float complex* restrict B,
+                            size_t n, size_t lda, size_t ldb,
+                            size_t c_min, size_t c_max, size_t panel,
+                            const float complex *tw);
+void fft_cols_dcmplx_radix2(const double complex* restrict A,
+                            double complex* restrict B,
+                            size_t n, size_t lda, size_t ldb,
+                            size_t c_min, size_t c_max, size_t panel,
+                            const double complex *tw);
+
+#endif /* FFT_COLS_H */
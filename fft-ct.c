@@ -3,6 +3,11 @@
  *
  * 1-D FFTs -> Transpose -> 1-D FFTs
  *
+ * With a fused epilogue transpose, optionally a six-step 1-D FFT of length
+ * ROWS * COLS instead:
+ * Transpose -> 1-D FFTs -> Transpose with twiddle factors -> 1-D FFTs ->
+ * Transpose
+ *
  * @author Connor Imes <cimes@isi.edu>
  * @date 2019-07-15
  */
@@ -10,7 +15,9 @@
 #include <errno.h>
 #include <getopt.h>
 #include <limits.h>
+#include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -18,6 +25,7 @@
 #include <fftw3.h>
 
 #include "ptime.h"
+#include "util.h"
 
 #if defined(USE_FFTWF_NAIVE) || \
     defined(USE_FFTWF_BLOCKED) || \
@@ -28,65 +36,328 @@
     defined(USE_FFTWF_AVX512_INTR) || \
     defined(USE_FFTWF_THRROW_AVX512_INTR) || \
     defined(USE_FFTWF_THRCOL_AVX512_INTR) || \
-    defined(USE_FFTWF_MKL)
+    defined(USE_FFTWF_SQUARE_NAIVE) || \
+    defined(USE_FFTWF_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_INPLACE) || \
+    defined(USE_FFTWF_THRCYC_INPLACE) || \
+    defined(USE_FFTWF_AVX2_INTR) || \
+    defined(USE_FFTWF_THRROW_AVX2_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTWF_DISPATCH) || \
+    defined(USE_FFTWF_RECURSIVE) || \
+    defined(USE_FFTWF_MORTON) || \
+    defined(USE_FFTWF_HILBERT) || \
+    defined(USE_FFTWF_TLB) || \
+    defined(USE_FFTWF_THRREC) || \
+    defined(USE_FFTWF_THRMORTON) || \
+    defined(USE_FFTWF_THRHILBERT) || \
+    defined(USE_FFTWF_THRTILE) || \
+    defined(USE_FFTWF_THRNUMA) || \
+    defined(USE_FFTWF_THRTLB) || \
+    defined(USE_FFTWF_RECURSIVE_AVX512_INTR) || \
+    defined(USE_FFTWF_PLAN) || \
+    defined(USE_FFTWF_MKL) || \
+    defined(USE_FFTWF_GURU) || \
+    defined(USE_FFTWF_GURU_INPLACE) || \
+    defined(USE_FFTWF_NAIVE_EPI) || \
+    defined(USE_FFTWF_BLOCKED_EPI) || \
+    defined(USE_FFTWF_THRROW_EPI) || \
+    defined(USE_FFTWF_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_COLS) || \
+    defined(USE_FFTWF_THRCOLS) || \
+    defined(USE_FFTWF_COLS_AVX512_INTR) || \
+    defined(USE_FFTWF_THRCOLS_AVX512_INTR)
 #include "fft-threads-fftwf.h"
 #include "transpose-fftwf.h"
 #include "transpose-fftwf-avx.h"
+#include "transpose-fftwf-avx2.h"
+#include "transpose-fftwf-dispatch.h"
+#include "transpose-fftwf-guru.h"
 #include "transpose-fftwf-mkl.h"
+#include "transpose-fftwf-plan.h"
 #include "transpose-fftwf-threads.h"
 #include "transpose-fftwf-threads-avx.h"
+#include "transpose-fftwf-threads-avx2.h"
 #include "util-fftwf.h"
 typedef fftwf_complex       FFTW_COMPLEX_T;
 typedef fftwf_plan          FFTW_PLAN_T;
 #define ASSERT_FFTW_MALLOC  assert_fftwf_malloc
-#define FFTW_FREE           fftwf_free
+#define FFTW_FREE           free_fftwf
 #define FFTW_PLAN_1D        fftwf_plan_dft_1d
+#define FFTW_PLAN_MANY      fftwf_plan_many_dft
 #define FFTW_PLAN_DESTROY   fftwf_destroy_plan
 #define FFTW_EXECUTE        fftwf_execute
 #define FILL_RAND           fill_rand_fftwf
+#define PLAN_FLAGS          plan_flags_fftwf
+#define WISDOM_PATH         wisdom_path_fftwf
+#define WISDOM_IMPORT       wisdom_import_fftwf
+#define WISDOM_EXPORT       wisdom_export_fftwf
+#define TWIDDLE_CREATE      transpose_twiddle_fcmplx
+// relative RMS error of a six-step FFT allowed by verification
+#define FFT_TOLERANCE       1e-5
 #define THR_EXECUTE         fft_thr_fftwf
+#define FFT_COLS_TWIDDLE    fft_cols_twiddle_fcmplx
+#define FFT_COLS_RADIX2     fft_cols_fcmplx_radix2
+#define THR_COLS_RADIX2     fft_cols_fcmplx_thr_radix2
+// default columns per panel of column FFTs: two cache lines per row
+#define FFT_COLS_PANEL      16
 #else
 #include "fft-threads-fftw.h"
 #include "transpose-fftw.h"
+#include "transpose-fftw-avx.h"
+#include "transpose-fftw-avx2.h"
+#include "transpose-fftw-dispatch.h"
+#include "transpose-fftw-guru.h"
 #include "transpose-fftw-mkl.h"
+#include "transpose-fftw-plan.h"
 #include "transpose-fftw-threads.h"
+#include "transpose-fftw-threads-avx.h"
+#include "transpose-fftw-threads-avx2.h"
 #include "util-fftw.h"
 typedef fftw_complex        FFTW_COMPLEX_T;
 typedef fftw_plan           FFTW_PLAN_T;
 #define ASSERT_FFTW_MALLOC  assert_fftw_malloc
-#define FFTW_FREE           fftw_free
+#define FFTW_FREE           free_fftw
 #define FFTW_PLAN_1D        fftw_plan_dft_1d
+#define FFTW_PLAN_MANY      fftw_plan_many_dft
 #define FFTW_PLAN_DESTROY   fftw_destroy_plan
 #define FFTW_EXECUTE        fftw_execute
 #define FILL_RAND           fill_rand_fftw
+#define PLAN_FLAGS          plan_flags_fftw
+#define WISDOM_PATH         wisdom_path_fftw
+#define WISDOM_IMPORT       wisdom_import_fftw
+#define WISDOM_EXPORT       wisdom_export_fftw
+#define TWIDDLE_CREATE      transpose_twiddle_dcmplx
+#define FFT_TOLERANCE       1e-12
 #define THR_EXECUTE         fft_thr_fftw
+#define FFT_COLS_TWIDDLE    fft_cols_twiddle_dcmplx
+#define FFT_COLS_RADIX2     fft_cols_dcmplx_radix2
+#define THR_COLS_RADIX2     fft_cols_dcmplx_thr_radix2
+// default columns per panel of column FFTs: two cache lines per row
+#define FFT_COLS_PANEL      8
 #endif
 
 #if defined(USE_FFTWF_BLOCKED) || \
     defined(USE_FFTWF_THRROW_BLOCKED) || \
     defined(USE_FFTWF_THRCOL_BLOCKED) || \
+    defined(USE_FFTWF_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
     defined(USE_FFTW_BLOCKED) || \
     defined(USE_FFTW_THRROW_BLOCKED) || \
-    defined(USE_FFTW_THRCOL_BLOCKED)
+    defined(USE_FFTW_THRCOL_BLOCKED) || \
+    defined(USE_FFTW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_BLOCKED_EPI) || \
+    defined(USE_FFTW_BLOCKED_EPI)
 #define _USE_TRANSP_BLOCKED 1
 #endif
 
 #if defined(USE_FFTWF_THRROW) || \
     defined(USE_FFTWF_THRCOL) || \
+    defined(USE_FFTWF_THRREC) || \
+    defined(USE_FFTWF_THRMORTON) || \
+    defined(USE_FFTWF_THRHILBERT) || \
+    defined(USE_FFTWF_THRTILE) || \
+    defined(USE_FFTWF_THRNUMA) || \
+    defined(USE_FFTWF_THRTLB) || \
+    defined(USE_FFTWF_PLAN) || \
     defined(USE_FFTWF_THRROW_BLOCKED) || \
     defined(USE_FFTWF_THRCOL_BLOCKED) || \
     defined(USE_FFTWF_THRROW_AVX512_INTR) || \
     defined(USE_FFTWF_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_SQUARE) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_THRCYC_INPLACE) || \
+    defined(USE_FFTWF_THRROW_AVX2_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX2_INTR) || \
     defined(USE_FFTW_THRROW) || \
     defined(USE_FFTW_THRCOL) || \
+    defined(USE_FFTW_THRREC) || \
+    defined(USE_FFTW_THRMORTON) || \
+    defined(USE_FFTW_THRHILBERT) || \
+    defined(USE_FFTW_THRTILE) || \
+    defined(USE_FFTW_THRNUMA) || \
+    defined(USE_FFTW_THRTLB) || \
+    defined(USE_FFTW_PLAN) || \
     defined(USE_FFTW_THRROW_BLOCKED) || \
-    defined(USE_FFTW_THRCOL_BLOCKED)
+    defined(USE_FFTW_THRCOL_BLOCKED) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_SQUARE) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_THRCYC_INPLACE) || \
+    defined(USE_FFTW_THRROW_AVX2_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTWF_THRROW_EPI) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_THRROW_EPI) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_THRCOLS) || \
+    defined(USE_FFTWF_THRCOLS_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOLS) || \
+    defined(USE_FFTW_THRCOLS_AVX512_INTR)
 #define _USE_TRANSP_THREADS 1
+#include "numa-util.h"
+#endif
+
+#if defined(USE_FFTWF_SQUARE_NAIVE) || \
+    defined(USE_FFTWF_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_SQUARE_NAIVE) || \
+    defined(USE_FFTW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR)
+#define _USE_TRANSP_SQUARE 1
+#endif
+
+// in-place transposes need only two buffers: FFT 2 writes back to FFT 1 input
+#if defined(_USE_TRANSP_SQUARE) || \
+    defined(USE_FFTWF_INPLACE) || \
+    defined(USE_FFTWF_THRCYC_INPLACE) || \
+    defined(USE_FFTWF_GURU_INPLACE) || \
+    defined(USE_FFTW_INPLACE) || \
+    defined(USE_FFTW_THRCYC_INPLACE) || \
+    defined(USE_FFTW_GURU_INPLACE)
+#define _USE_TRANSP_INPLACE 1
+#endif
+
+// epilogue transposes can also fuse the twiddle factors of a six-step FFT
+#if defined(USE_FFTWF_NAIVE_EPI) || \
+    defined(USE_FFTWF_BLOCKED_EPI) || \
+    defined(USE_FFTWF_THRROW_EPI) || \
+    defined(USE_FFTWF_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_NAIVE_EPI) || \
+    defined(USE_FFTW_BLOCKED_EPI) || \
+    defined(USE_FFTW_THRROW_EPI) || \
+    defined(USE_FFTW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR_EPI)
+#define _USE_TRANSP_EPI 1
+#endif
+
+// the second set of 1-D FFTs runs down the columns, without a transpose
+#if defined(USE_FFTWF_COLS) || \
+    defined(USE_FFTWF_THRCOLS) || \
+    defined(USE_FFTWF_COLS_AVX512_INTR) || \
+    defined(USE_FFTWF_THRCOLS_AVX512_INTR) || \
+    defined(USE_FFTW_COLS) || \
+    defined(USE_FFTW_THRCOLS) || \
+    defined(USE_FFTW_COLS_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOLS_AVX512_INTR)
+#define _USE_FFT_COLS 1
+#include "fft-cols.h"
+#include "fft-cols-threads.h"
+#endif
+
+#if defined(USE_FFTWF_NAIVE) || \
+    defined(USE_FFTWF_BLOCKED) || \
+    defined(USE_FFTWF_THRROW) || \
+    defined(USE_FFTWF_THRCOL) || \
+    defined(USE_FFTWF_THRROW_BLOCKED) || \
+    defined(USE_FFTWF_THRCOL_BLOCKED) || \
+    defined(USE_FFTWF_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTWF_AVX2_INTR) || \
+    defined(USE_FFTWF_THRROW_AVX2_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTW_NAIVE) || \
+    defined(USE_FFTW_BLOCKED) || \
+    defined(USE_FFTW_THRROW) || \
+    defined(USE_FFTW_THRCOL) || \
+    defined(USE_FFTW_THRROW_BLOCKED) || \
+    defined(USE_FFTW_THRCOL_BLOCKED) || \
+    defined(USE_FFTW_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTW_AVX2_INTR) || \
+    defined(USE_FFTW_THRROW_AVX2_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX2_INTR) || \
+    defined(_USE_TRANSP_EPI) || \
+    defined(_USE_FFT_COLS)
+#define _USE_TRANSP_LD 1
+#endif
+
+#if defined(USE_FFTWF_DISPATCH) || \
+    defined(USE_FFTW_DISPATCH)
+#define _USE_TRANSP_DISPATCH 1
+#include "transpose-dispatch.h"
+#endif
+
+// transposes that go through a scratch matrix, kept between calls
+#if defined(USE_FFTWF_THRNUMA)
+#define _USE_TRANSP_SCRATCH 1
+#define TRANSPOSE_SCRATCH_RESERVE   transpose_fftwf_thrnuma_reserve
+#define TRANSPOSE_SCRATCH_RELEASE   transpose_fftwf_thrnuma_release
+#elif defined(USE_FFTW_THRNUMA)
+#define _USE_TRANSP_SCRATCH 1
+#define TRANSPOSE_SCRATCH_RESERVE   transpose_fftw_thrnuma_reserve
+#define TRANSPOSE_SCRATCH_RELEASE   transpose_fftw_thrnuma_release
+#elif defined(USE_FFTWF_TLB)
+#define _USE_TRANSP_SCRATCH 1
+#define TRANSPOSE_SCRATCH_RESERVE(rows, cols, num_thr) \
+    transpose_fftwf_tlb_reserve(rows, cols)
+#define TRANSPOSE_SCRATCH_RELEASE   transpose_fftwf_tlb_release
+#elif defined(USE_FFTW_TLB)
+#define _USE_TRANSP_SCRATCH 1
+#define TRANSPOSE_SCRATCH_RESERVE(rows, cols, num_thr) \
+    transpose_fftw_tlb_reserve(rows, cols)
+#define TRANSPOSE_SCRATCH_RELEASE   transpose_fftw_tlb_release
+#elif defined(USE_FFTWF_THRTLB)
+#define _USE_TRANSP_SCRATCH 1
+#define TRANSPOSE_SCRATCH_RESERVE   transpose_fftwf_thrtlb_reserve
+#define TRANSPOSE_SCRATCH_RELEASE   transpose_fftwf_thrtlb_release
+#elif defined(USE_FFTW_THRTLB)
+#define _USE_TRANSP_SCRATCH 1
+#define TRANSPOSE_SCRATCH_RESERVE   transpose_fftw_thrtlb_reserve
+#define TRANSPOSE_SCRATCH_RELEASE   transpose_fftw_thrtlb_release
+#endif
+
+#if defined(USE_FFTWF_PLAN) || \
+    defined(USE_FFTW_PLAN)
+#define _USE_TRANSP_PLAN 1
+#include "transpose-dispatch.h"
+#include "transpose-plan.h"
+#if defined(USE_FFTWF_PLAN)
+#define TRANSPOSE_PLAN      transpose_plan_fftwf
+#define TRANSPOSE_EXECUTE   transpose_execute_fftwf
+#else
+#define TRANSPOSE_PLAN      transpose_plan_fftw
+#define TRANSPOSE_EXECUTE   transpose_execute_fftw
+#endif
+#endif
+
+#if defined(USE_FFTWF_GURU) || \
+    defined(USE_FFTWF_GURU_INPLACE)
+#define _USE_TRANSP_GURU 1
+#define TRANSPOSE_GURU_PLAN transpose_fftwf_guru_plan
+#elif defined(USE_FFTW_GURU) || \
+    defined(USE_FFTW_GURU_INPLACE)
+#define _USE_TRANSP_GURU 1
+#define TRANSPOSE_GURU_PLAN transpose_fftw_guru_plan
 #endif
 
 static size_t nrows = 0;
 static size_t ncols = 0;
 static bool do_init = false;
+static bool do_huge = false;
+static bool do_row_plans = false;
+static size_t batch_rows = 0;
+static unsigned plan_flags = FFTW_ESTIMATE;
+static const char *wisdom_dir = NULL;
+static int64_t plan_ns = 0;
 static struct timespec t1;
 static struct timespec t2;
 
@@ -97,120 +368,669 @@ static size_t nblkcols = 0;
 
 #if defined(_USE_TRANSP_THREADS)
 static size_t nthreads = 1;
+static bool do_numa = false;
+#endif
+
+#if defined(_USE_TRANSP_PLAN)
+static transpose_plan_mode plan_mode = TRANSPOSE_PLAN_ESTIMATE;
+static const char *wisdom_file = NULL;
+static transpose_plan *plan = NULL;
+#endif
+
+#if defined(_USE_TRANSP_GURU)
+// FFTW's transpose, planned for the matrices it transposes
+static FFTW_PLAN_T guru_plan = NULL;
+#endif
+
+// leading dimensions (row strides) of the transpose input and output, or 0 to
+// choose, so FFT 1 writes and FFT 2 reads rows at the same stride
+#if !defined(_USE_TRANSP_INPLACE)
+static size_t lda = 0;
+static size_t ldb = 0;
+#if !defined(_USE_FFT_COLS)
+// FFT 1 writes its output transposed, without a separate transpose
+static bool do_no_transpose = false;
+#endif
+#endif
+#if defined(_USE_TRANSP_LD)
+static bool do_pad = false;
+#endif
+
+#if defined(_USE_FFT_COLS)
+// column FFTs use the built-in radix-2 kernel instead of FFTW plans
+static bool do_col_radix2 = false;
+static size_t col_panel = FFT_COLS_PANEL;
+#endif
+
+#if defined(_USE_TRANSP_EPI)
+// the identity, unless the middle transpose of a six-step FFT adds twiddles
+static transpose_epilogue epi = { 1, 0, 0, 0, NULL };
+static bool do_six_step = false;
+static bool do_twiddle_full = false;
+static bool do_verify = false;
 #endif
 
 #define PRINT_ELAPSED_TIME(prefix, t1, t2) \
     printf("%s (ms): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000000.0);
 
-static void data_alloc(FFTW_COMPLEX_T **A, FFTW_COMPLEX_T **B, FFTW_PLAN_T **p,
-                       size_t r, size_t c)
+static void data_page_report(const char *name_A, const FFTW_COMPLEX_T *A,
+                             const char *name_B, const FFTW_COMPLEX_T *B)
 {
-    size_t i;
-    *A = ASSERT_FFTW_MALLOC(r * c * sizeof(**A));
-    *B = ASSERT_FFTW_MALLOC(r * c * sizeof(**B));
-    *p = ASSERT_FFTW_MALLOC(r * sizeof(**p));
-    for (i = 0; i < r; i++) {
-        (*p)[i] = FFTW_PLAN_1D(c, &(*A)[i * c], &(*B)[i * c],
-                               FFTW_FORWARD, FFTW_ESTIMATE);
+    if (do_huge) {
+        printf("%s-page-size (KiB): %zu\n", name_A, alloc_page_size(A) / 1024);
+        printf("%s-page-size (KiB): %zu\n", name_B, alloc_page_size(B) / 1024);
     }
 }
 
-static void data_free(FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B, FFTW_PLAN_T *p,
-                      size_t r)
+/*
+ * Plan r 1-D FFTs of length c from A to B, where element j of FFT i is at
+ * A[i * idist + j * istride] and B[i * odist + j * ostride], and print the
+ * time and (heap) memory the plans took.
+ * Each plan is batched over the given number of FFTs, or if batch is 0, each
+ * thread gets a batched plan for its FFTs, which it executes as a whole,
+ * divided as fft_thr_*() would divide one plan per FFT.  Without threads,
+ * there's then a single plan.  Otherwise, threads divide the plans.
+ * Plans are created with the planner flags given by -F, which may overwrite A
+ * and B.  Returns the number of plans.
+ */
+static size_t plans_alloc_strided(FFTW_PLAN_T **p, FFTW_COMPLEX_T *A,
+                                  FFTW_COMPLEX_T *B, size_t r, size_t c,
+                                  size_t istride, size_t idist,
+                                  size_t ostride, size_t odist, size_t batch,
+                                  const char *name)
+{
+    const size_t heap = alloc_heap_used();
+    const int n = c;
+    size_t i, np, used, r_min, rows;
+    ptime_gettime_monotonic(&t1);
+    if (batch) {
+        np = (r + batch - 1) / batch;
+    } else {
+#if defined(_USE_TRANSP_THREADS)
+        np = nthreads < r ? nthreads : r;
+#else
+        np = 1;
+#endif
+    }
+    *p = ASSERT_FFTW_MALLOC(np * sizeof(**p));
+    for (i = 0, r_min = 0; i < np; i++, r_min += rows) {
+        if (batch) {
+            rows = r - r_min < batch ? r - r_min : batch;
+        } else {
+            rows = r / np + (i < r % np);
+        }
+        (*p)[i] = FFTW_PLAN_MANY(1, &n, rows, &A[r_min * idist], NULL,
+                                 istride, idist, &B[r_min * odist], NULL,
+                                 ostride, odist, FFTW_FORWARD, plan_flags);
+    }
+    ptime_gettime_monotonic(&t2);
+    used = alloc_heap_used();
+    plan_ns += ptime_elapsed_ns(&t1, &t2);
+    PRINT_ELAPSED_TIME(name, &t1, &t2);
+    printf("%s-mem (KiB): %zu\n", name, (used > heap ? used - heap : 0) / 1024);
+    return np;
+}
+
+/*
+ * Plan r 1-D FFTs of length c from the rows of A to the rows of B, both with
+ * row stride ld, batched over each thread's rows, over -B rows, or (with
+ * --row-plans) planned separately for each row.
+ */
+static size_t plans_alloc(FFTW_PLAN_T **p, FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B,
+                          size_t r, size_t c, size_t ld, const char *name)
+{
+    return plans_alloc_strided(p, A, B, r, c, 1, ld, 1, ld,
+                               do_row_plans ? 1 : batch_rows, name);
+}
+
+// print the total time spent planning 1-D FFTs
+static void plans_report(void)
+{
+    printf("plan (ms): %f\n", plan_ns / 1000000.0);
+}
+
+static void plans_free(FFTW_PLAN_T *p, size_t np)
 {
     size_t i;
-    for (i = 0; i < r; i++) {
+    for (i = 0; i < np; i++) {
         FFTW_PLAN_DESTROY(p[i]);
     }
     FFTW_FREE(p);
+}
+
+static void buf_alloc(FFTW_COMPLEX_T **A, size_t r, size_t ld)
+{
+    *A = ASSERT_FFTW_MALLOC(r * ld * sizeof(**A));
+#if defined(_USE_TRANSP_THREADS)
+    // place each thread's rows on the thread's NUMA node
+    numa_first_touch(*A, r * ld * sizeof(**A), nthreads);
+#endif
+}
+
+static size_t data_alloc(FFTW_COMPLEX_T **A, FFTW_COMPLEX_T **B,
+                         FFTW_PLAN_T **p, size_t r, size_t c, size_t ld,
+                         const char *name)
+{
+    buf_alloc(A, r, ld);
+    buf_alloc(B, r, ld);
+    return plans_alloc(p, *A, *B, r, c, ld, name);
+}
+
+#if defined(_USE_TRANSP_THREADS)
+static void data_numa_report(const char *name_A, const FFTW_COMPLEX_T *A,
+                             const char *name_B, const FFTW_COMPLEX_T *B,
+                             size_t len)
+{
+    if (do_numa) {
+        numa_print_locality(name_A, A, len * sizeof(*A), nthreads);
+        numa_print_locality(name_B, B, len * sizeof(*B), nthreads);
+    }
+}
+#endif
+
+static void data_free(FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B, FFTW_PLAN_T *p,
+                      size_t np)
+{
+    plans_free(p, np);
     FFTW_FREE(B);
     FFTW_FREE(A);
 }
 
-static void fft_1d(const FFTW_PLAN_T *p, size_t r)
+static void fft_1d(const FFTW_PLAN_T *p, size_t np)
 {
 #if defined(_USE_TRANSP_THREADS)
-    THR_EXECUTE(p, r, nthreads);
+    THR_EXECUTE(p, np, nthreads);
 #else
     size_t i;
-    for (i = 0; i < r; i++) {
+    for (i = 0; i < np; i++) {
         FFTW_EXECUTE(p[i]);
     }
 #endif
 }
 
+#if defined(_USE_TRANSP_GURU)
+/*
+ * Plan the transpose from A to B (the same matrix, in place) with the planner
+ * flags given by -F, before the input is filled, since planning may overwrite
+ * A and B.  FFTW wisdom is imported and exported with the FFTs' plans.
+ */
+static void transpose_guru_setup(FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B)
+{
+    ptime_gettime_monotonic(&t1);
+    guru_plan = TRANSPOSE_GURU_PLAN(A, B, nrows, ncols, plan_flags);
+    ptime_gettime_monotonic(&t2);
+    if (!guru_plan) {
+        fprintf(stderr, "FFTW can't plan a%s %zux%zu transpose\n",
+                A == B ? "n in-place" : "", nrows, ncols);
+        exit(EINVAL);
+    }
+    PRINT_ELAPSED_TIME("transpose-plan", &t1, &t2);
+}
+
+static void transpose_guru_teardown(void)
+{
+    FFTW_PLAN_DESTROY(guru_plan);
+    guru_plan = NULL;
+}
+
+#endif
+#if defined(_USE_TRANSP_INPLACE)
+static void transpose_inplace(FFTW_COMPLEX_T *A)
+{
+#if defined(USE_FFTWF_SQUARE_NAIVE)
+    transpose_fftwf_square_naive(A, nrows);
+#elif defined(USE_FFTWF_SQUARE_BLOCKED)
+    transpose_fftwf_square_blocked(A, nrows, nblkrows);
+#elif defined(USE_FFTWF_THRROW_SQUARE)
+    transpose_fftwf_thrrow_square(A, nrows, nthreads);
+#elif defined(USE_FFTWF_THRROW_SQUARE_BLOCKED)
+    transpose_fftwf_thrrow_square_blocked(A, nrows, nthreads, nblkrows);
+#elif defined(USE_FFTWF_SQUARE_AVX512_INTR)
+    transpose_fftwf_square_avx512_intr(A, nrows);
+#elif defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR)
+    transpose_fftwf_thrrow_square_avx512_intr(A, nrows, nthreads);
+#elif defined(USE_FFTWF_INPLACE)
+    transpose_fftwf_inplace(A, nrows, ncols);
+#elif defined(USE_FFTWF_THRCYC_INPLACE)
+    transpose_fftwf_thrcyc_inplace(A, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_GURU_INPLACE)
+    FFTW_EXECUTE(guru_plan);
+#elif defined(USE_FFTW_SQUARE_NAIVE)
+    transpose_fftw_square_naive(A, nrows);
+#elif defined(USE_FFTW_SQUARE_BLOCKED)
+    transpose_fftw_square_blocked(A, nrows, nblkrows);
+#elif defined(USE_FFTW_THRROW_SQUARE)
+    transpose_fftw_thrrow_square(A, nrows, nthreads);
+#elif defined(USE_FFTW_THRROW_SQUARE_BLOCKED)
+    transpose_fftw_thrrow_square_blocked(A, nrows, nthreads, nblkrows);
+#elif defined(USE_FFTW_SQUARE_AVX512_INTR)
+    transpose_fftw_square_avx512_intr(A, nrows);
+#elif defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR)
+    transpose_fftw_thrrow_square_avx512_intr(A, nrows, nthreads);
+#elif defined(USE_FFTW_INPLACE)
+    transpose_fftw_inplace(A, nrows, ncols);
+#elif defined(USE_FFTW_THRCYC_INPLACE)
+    transpose_fftw_thrcyc_inplace(A, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_GURU_INPLACE)
+    FFTW_EXECUTE(guru_plan);
+#else
+    #error "No matching in-place transpose implementation found!"
+#endif
+}
+
+static void fft_ct_1d_inplace(void)
+{
+    FFTW_COMPLEX_T *fft_in, *fft_out;
+    FFTW_PLAN_T *p1, *p2;
+    size_t np1, np2;
+
+    // Setup FFT 1 (before transpose) and FFT 2 (after transpose), where FFT 2
+    // reads the transposed output of FFT 1 and writes to the input of FFT 1
+    np1 = data_alloc(&fft_in, &fft_out, &p1, nrows, ncols, ncols, "plan-1");
+    np2 = plans_alloc(&p2, fft_out, fft_in, ncols, nrows, nrows, "plan-2");
+    plans_report();
+
+#if defined(_USE_TRANSP_GURU)
+    // Plan the transpose
+    transpose_guru_setup(fft_out, fft_out);
+
+#endif
+    // Populate input with random data
+    ptime_gettime_monotonic(&t1);
+    FILL_RAND(fft_in, nrows * ncols);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+
+    if (do_init) {
+        ptime_gettime_monotonic(&t1);
+        memset(fft_out, 0, nrows * ncols * sizeof(FFTW_COMPLEX_T));
+        ptime_gettime_monotonic(&t2);
+        PRINT_ELAPSED_TIME("init", &t1, &t2);
+    }
+
+    // Perform first set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p1, np1);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-1", &t1, &t2);
+
+    // Matrix transpose
+    ptime_gettime_monotonic(&t1);
+    transpose_inplace(fft_out);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2);
+
+    // Perform second set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p2, np2);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
+
+    // Cleanup
+    data_page_report("fft-in", fft_in, "fft-out", fft_out);
+#if defined(_USE_TRANSP_THREADS)
+    data_numa_report("fft-in", fft_in, "fft-out", fft_out, nrows * ncols);
+#endif
+#if defined(_USE_TRANSP_GURU)
+    transpose_guru_teardown();
+#endif
+    plans_free(p2, np2);
+    data_free(fft_in, fft_out, p1, np1);
+}
+#else
+// without a corner turn, both FFTs' outputs are ROWS x COLS
+#if defined(_USE_FFT_COLS)
+#define LDB_COLS ncols
+#else
+#define LDB_COLS nrows
+#endif
+
+static void ld_init(void)
+{
+#if defined(_USE_TRANSP_LD)
+    if (!lda) {
+        lda = do_pad ? ld_padded(ncols, sizeof(FFTW_COMPLEX_T)) : ncols;
+    }
+    if (!ldb) {
+        ldb = do_pad ? ld_padded(LDB_COLS, sizeof(FFTW_COMPLEX_T)) : LDB_COLS;
+    }
+    if (lda != ncols || ldb != LDB_COLS) {
+        printf("lda: %zu\n", lda);
+        printf("ldb: %zu\n", ldb);
+    }
+#else
+    lda = ncols;
+    ldb = nrows;
+#endif
+}
+
+#if defined(_USE_TRANSP_EPI)
+static void transpose_epi(const FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B,
+                          size_t A_rows, size_t A_cols, size_t ld_A,
+                          size_t ld_B, const transpose_epilogue *e)
+{
+#if defined(USE_FFTWF_NAIVE_EPI)
+    transpose_fftwf_naive_epi(A, B, A_rows, A_cols, ld_A, ld_B, e);
+#elif defined(USE_FFTWF_BLOCKED_EPI)
+    transpose_fftwf_blocked_epi(A, B, A_rows, A_cols, ld_A, ld_B,
+                                nblkrows, nblkcols, e);
+#elif defined(USE_FFTWF_THRROW_EPI)
+    transpose_fftwf_thrrow_epi(A, B, A_rows, A_cols, ld_A, ld_B, nthreads, e);
+#elif defined(USE_FFTWF_AVX512_INTR_EPI)
+    transpose_fftwf_avx512_intr_epi(A, B, A_rows, A_cols, ld_A, ld_B, e);
+#elif defined(USE_FFTWF_THRROW_AVX512_INTR_EPI)
+    transpose_fftwf_thrrow_avx512_intr_epi(A, B, A_rows, A_cols, ld_A, ld_B,
+                                           nthreads, e);
+#elif defined(USE_FFTW_NAIVE_EPI)
+    transpose_fftw_naive_epi(A, B, A_rows, A_cols, ld_A, ld_B, e);
+#elif defined(USE_FFTW_BLOCKED_EPI)
+    transpose_fftw_blocked_epi(A, B, A_rows, A_cols, ld_A, ld_B,
+                               nblkrows, nblkcols, e);
+#elif defined(USE_FFTW_THRROW_EPI)
+    transpose_fftw_thrrow_epi(A, B, A_rows, A_cols, ld_A, ld_B, nthreads, e);
+#elif defined(USE_FFTW_AVX512_INTR_EPI)
+    transpose_fftw_avx512_intr_epi(A, B, A_rows, A_cols, ld_A, ld_B, e);
+#elif defined(USE_FFTW_THRROW_AVX512_INTR_EPI)
+    transpose_fftw_thrrow_avx512_intr_epi(A, B, A_rows, A_cols, ld_A, ld_B,
+                                          nthreads, e);
+#else
+    #error "No matching epilogue transpose implementation found!"
+#endif
+}
+#endif
+
+#if defined(_USE_FFT_COLS)
+static void fft_cols_radix2(const FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B,
+                            const FFTW_COMPLEX_T *tw)
+{
+#if defined(_USE_TRANSP_THREADS)
+    THR_COLS_RADIX2(A, B, nrows, ncols, lda, ldb, col_panel, tw, nthreads);
+#else
+    FFT_COLS_RADIX2(A, B, nrows, lda, ldb, 0, ncols, col_panel, tw);
+#endif
+}
+
+/*
+ * No corner turn: the second set of 1-D FFTs runs down the columns of the
+ * output of the first set, a panel of adjacent columns at a time, either with
+ * an FFTW plan per panel or the built-in radix-2 kernel.  The output is the
+ * transpose of the other benchmarks' output, with row stride ldb.
+ */
+static void fft_ct_1d_cols(void)
+{
+    FFTW_COMPLEX_T *fft1_in, *fft1_out, *fft2_out, *tw = NULL;
+    FFTW_PLAN_T *p1, *p2 = NULL;
+    size_t np1, np2 = 0;
+
+    // Setup FFT 1 (by row) and FFT 2 (by column)
+    ld_init();
+    np1 = data_alloc(&fft1_in, &fft1_out, &p1, nrows, ncols, lda, "plan-1");
+    buf_alloc(&fft2_out, nrows, ldb);
+    if (do_col_radix2) {
+        ptime_gettime_monotonic(&t1);
+        tw = FFT_COLS_TWIDDLE(nrows);
+        ptime_gettime_monotonic(&t2);
+        PRINT_ELAPSED_TIME("twiddle", &t1, &t2);
+    } else {
+        np2 = plans_alloc_strided(&p2, fft1_out, fft2_out, ncols, nrows,
+                                  lda, 1, ldb, 1, col_panel, "plan-2");
+    }
+    plans_report();
+
+    // Populate input with random data
+    ptime_gettime_monotonic(&t1);
+    FILL_RAND(fft1_in, nrows * lda);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+
+    if (do_init) {
+        ptime_gettime_monotonic(&t1);
+        memset(fft1_out, 0, nrows * lda * sizeof(FFTW_COMPLEX_T));
+        memset(fft2_out, 0, nrows * ldb * sizeof(FFTW_COMPLEX_T));
+        ptime_gettime_monotonic(&t2);
+        PRINT_ELAPSED_TIME("init", &t1, &t2);
+    }
+
+    // Perform first set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p1, np1);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-1", &t1, &t2);
+
+    // Perform second set of 1D FFTs, down the columns
+    ptime_gettime_monotonic(&t1);
+    if (do_col_radix2) {
+        fft_cols_radix2(fft1_out, fft2_out, tw);
+    } else {
+        fft_1d(p2, np2);
+    }
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
+
+    // Cleanup
+    data_page_report("fft1-in", fft1_in, "fft1-out", fft1_out);
+#if defined(_USE_TRANSP_THREADS)
+    data_numa_report("fft1-in", fft1_in, "fft1-out", fft1_out, nrows * lda);
+#endif
+    if (do_col_radix2) {
+        free(tw);
+    } else {
+        plans_free(p2, np2);
+    }
+    FFTW_FREE(fft2_out);
+    data_free(fft1_in, fft1_out, p1, np1);
+}
+#else
 static void transpose(const FFTW_COMPLEX_T *A, FFTW_COMPLEX_T *B)
 {
 #if defined(USE_FFTWF_NAIVE)
-    transpose_fftwf_naive(A, B, nrows, ncols);
+    transpose_fftwf_naive_ld(A, B, nrows, ncols, lda, ldb);
 #elif defined(USE_FFTWF_BLOCKED)
-    transpose_fftwf_blocked(A, B, nrows, ncols, nblkrows, nblkcols);
+    transpose_fftwf_blocked_ld(A, B, nrows, ncols, lda, ldb,
+                               nblkrows, nblkcols);
 #elif defined(USE_FFTWF_THRROW)
-    transpose_fftwf_thrrow(A, B, nrows, ncols, nthreads);
+    transpose_fftwf_thrrow_ld(A, B, nrows, ncols, lda, ldb, nthreads);
 #elif defined(USE_FFTWF_THRCOL)
-    transpose_fftwf_thrcol(A, B, nrows, ncols, nthreads);
+    transpose_fftwf_thrcol_ld(A, B, nrows, ncols, lda, ldb, nthreads);
 #elif defined(USE_FFTWF_THRROW_BLOCKED)
-    transpose_fftwf_thrrow_blocked(A, B, nrows, ncols, nthreads,
-                                   nblkrows, nblkcols);
+    transpose_fftwf_thrrow_blocked_ld(A, B, nrows, ncols, lda, ldb,
+                                      nthreads, nblkrows, nblkcols);
 #elif defined(USE_FFTWF_THRCOL_BLOCKED)
-    transpose_fftwf_thrcol_blocked(A, B, nrows, ncols, nthreads,
-                                   nblkrows, nblkcols);
+    transpose_fftwf_thrcol_blocked_ld(A, B, nrows, ncols, lda, ldb,
+                                      nthreads, nblkrows, nblkcols);
 #elif defined(USE_FFTWF_AVX512_INTR)
-    transpose_fftwf_avx512_intr(A, B, nrows, ncols);
+    transpose_fftwf_avx512_intr_ld(A, B, nrows, ncols, lda, ldb);
 #elif defined(USE_FFTWF_THRROW_AVX512_INTR)
-    transpose_fftwf_thrrow_avx512_intr(A, B, nrows, ncols, nthreads);
+    transpose_fftwf_thrrow_avx512_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                          nthreads);
 #elif defined(USE_FFTWF_THRCOL_AVX512_INTR)
-    transpose_fftwf_thrcol_avx512_intr(A, B, nrows, ncols, nthreads);
+    transpose_fftwf_thrcol_avx512_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                          nthreads);
+#elif defined(USE_FFTWF_AVX2_INTR)
+    transpose_fftwf_avx2_intr_ld(A, B, nrows, ncols, lda, ldb);
+#elif defined(USE_FFTWF_THRROW_AVX2_INTR)
+    transpose_fftwf_thrrow_avx2_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                        nthreads);
+#elif defined(USE_FFTWF_THRCOL_AVX2_INTR)
+    transpose_fftwf_thrcol_avx2_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                        nthreads);
+#elif defined(USE_FFTWF_DISPATCH)
+    transpose_fftwf_dispatch(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_RECURSIVE)
+    transpose_fftwf_recursive(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_MORTON)
+    transpose_fftwf_morton(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_HILBERT)
+    transpose_fftwf_hilbert(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_TLB)
+    transpose_fftwf_tlb(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_THRREC)
+    transpose_fftwf_thrrec(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_THRMORTON)
+    transpose_fftwf_thrmorton(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_THRHILBERT)
+    transpose_fftwf_thrhilbert(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_THRTILE)
+    transpose_fftwf_thrtile(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_THRNUMA)
+    transpose_fftwf_thrnuma(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_THRTLB)
+    transpose_fftwf_thrtlb(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTWF_RECURSIVE_AVX512_INTR)
+    transpose_fftwf_recursive_avx512_intr(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_PLAN)
+    TRANSPOSE_EXECUTE(plan, A, B);
 #elif defined(USE_FFTWF_MKL)
     transpose_fftwf_mkl(A, B, nrows, ncols);
+#elif defined(USE_FFTWF_GURU)
+    FFTW_EXECUTE(guru_plan);
 #elif defined(USE_FFTW_NAIVE)
-    transpose_fftw_naive(A, B, nrows, ncols);
+    transpose_fftw_naive_ld(A, B, nrows, ncols, lda, ldb);
 #elif defined(USE_FFTW_BLOCKED)
-    transpose_fftw_blocked(A, B, nrows, ncols, nblkrows, nblkcols);
+    transpose_fftw_blocked_ld(A, B, nrows, ncols, lda, ldb,
+                              nblkrows, nblkcols);
 #elif defined(USE_FFTW_THRROW)
-    transpose_fftw_thrrow(A, B, nrows, ncols, nthreads);
+    transpose_fftw_thrrow_ld(A, B, nrows, ncols, lda, ldb, nthreads);
 #elif defined(USE_FFTW_THRCOL)
-    transpose_fftw_thrcol(A, B, nrows, ncols, nthreads);
+    transpose_fftw_thrcol_ld(A, B, nrows, ncols, lda, ldb, nthreads);
 #elif defined(USE_FFTW_THRROW_BLOCKED)
-    transpose_fftw_thrrow_blocked(A, B, nrows, ncols, nthreads,
-                                  nblkrows, nblkcols);
+    transpose_fftw_thrrow_blocked_ld(A, B, nrows, ncols, lda, ldb,
+                                     nthreads, nblkrows, nblkcols);
 #elif defined(USE_FFTW_THRCOL_BLOCKED)
-    transpose_fftw_thrcol_blocked(A, B, nrows, ncols, nthreads,
-                                  nblkrows, nblkcols);
+    transpose_fftw_thrcol_blocked_ld(A, B, nrows, ncols, lda, ldb,
+                                     nthreads, nblkrows, nblkcols);
+#elif defined(USE_FFTW_AVX512_INTR)
+    transpose_fftw_avx512_intr_ld(A, B, nrows, ncols, lda, ldb);
+#elif defined(USE_FFTW_THRROW_AVX512_INTR)
+    transpose_fftw_thrrow_avx512_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                         nthreads);
+#elif defined(USE_FFTW_THRCOL_AVX512_INTR)
+    transpose_fftw_thrcol_avx512_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                         nthreads);
+#elif defined(USE_FFTW_AVX2_INTR)
+    transpose_fftw_avx2_intr_ld(A, B, nrows, ncols, lda, ldb);
+#elif defined(USE_FFTW_THRROW_AVX2_INTR)
+    transpose_fftw_thrrow_avx2_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                       nthreads);
+#elif defined(USE_FFTW_THRCOL_AVX2_INTR)
+    transpose_fftw_thrcol_avx2_intr_ld(A, B, nrows, ncols, lda, ldb,
+                                       nthreads);
+#elif defined(USE_FFTW_DISPATCH)
+    transpose_fftw_dispatch(A, B, nrows, ncols);
+#elif defined(USE_FFTW_RECURSIVE)
+    transpose_fftw_recursive(A, B, nrows, ncols);
+#elif defined(USE_FFTW_MORTON)
+    transpose_fftw_morton(A, B, nrows, ncols);
+#elif defined(USE_FFTW_HILBERT)
+    transpose_fftw_hilbert(A, B, nrows, ncols);
+#elif defined(USE_FFTW_TLB)
+    transpose_fftw_tlb(A, B, nrows, ncols);
+#elif defined(USE_FFTW_THRREC)
+    transpose_fftw_thrrec(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_THRMORTON)
+    transpose_fftw_thrmorton(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_THRHILBERT)
+    transpose_fftw_thrhilbert(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_THRTILE)
+    transpose_fftw_thrtile(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_THRNUMA)
+    transpose_fftw_thrnuma(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_THRTLB)
+    transpose_fftw_thrtlb(A, B, nrows, ncols, nthreads);
+#elif defined(USE_FFTW_RECURSIVE_AVX512_INTR)
+    transpose_fftw_recursive_avx512_intr(A, B, nrows, ncols);
+#elif defined(USE_FFTW_PLAN)
+    TRANSPOSE_EXECUTE(plan, A, B);
 #elif defined(USE_FFTW_MKL)
     transpose_fftw_mkl(A, B, nrows, ncols);
+#elif defined(USE_FFTW_GURU)
+    FFTW_EXECUTE(guru_plan);
+#elif defined(_USE_TRANSP_EPI)
+    transpose_epi(A, B, nrows, ncols, lda, ldb, &epi);
 #else
     #error "No matching transpose implementation found!"
 #endif
 }
 
+#if defined(_USE_TRANSP_PLAN)
+static void transpose_plan_setup(void)
+{
+    char plan_desc[64];
+    // a wisdom file that doesn't exist yet is created on teardown
+    if (wisdom_file && transpose_wisdom_import(wisdom_file) &&
+        errno != ENOENT) {
+        perror(wisdom_file);
+        exit(errno);
+    }
+    ptime_gettime_monotonic(&t1);
+    plan = TRANSPOSE_PLAN(nrows, ncols, nthreads, plan_mode);
+    ptime_gettime_monotonic(&t2);
+    if (!plan) {
+        perror("transpose_plan");
+        exit(errno);
+    }
+    PRINT_ELAPSED_TIME("transpose-plan", &t1, &t2);
+    transpose_plan_describe(plan, plan_desc, sizeof(plan_desc));
+    printf("transpose-plan: %s\n", plan_desc);
+}
+
+static void transpose_plan_teardown(void)
+{
+    transpose_plan_destroy(plan);
+    if (wisdom_file && transpose_wisdom_export(wisdom_file)) {
+        perror(wisdom_file);
+    }
+}
+#endif
+
 static void fft_ct_1d(void)
 {
     FFTW_COMPLEX_T *fft1_in, *fft1_out, *fft2_in, *fft2_out;
     FFTW_PLAN_T *p1, *p2;
+    size_t np1, np2;
 
     // Setup FFT 1 (before transpose) and FFT 2 (after transpose)
-    data_alloc(&fft1_in, &fft1_out, &p1, nrows, ncols);
-    data_alloc(&fft2_in, &fft2_out, &p2, ncols, nrows);
+    ld_init();
+    np1 = data_alloc(&fft1_in, &fft1_out, &p1, nrows, ncols, lda, "plan-1");
+    np2 = data_alloc(&fft2_in, &fft2_out, &p2, ncols, nrows, ldb, "plan-2");
+    plans_report();
+
+#if defined(_USE_TRANSP_PLAN)
+    // Plan the transpose
+    transpose_plan_setup();
 
+#endif
+#if defined(_USE_TRANSP_GURU)
+    // Plan the transpose
+    transpose_guru_setup(fft1_out, fft2_in);
+
+#endif
+#if defined(_USE_TRANSP_SCRATCH)
+    // Allocate and place the transpose's scratch matrix
+    ptime_gettime_monotonic(&t1);
+    TRANSPOSE_SCRATCH_RESERVE(nrows, ncols, nthreads);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("scratch", &t1, &t2);
+
+#endif
     // Populate input with random data
     ptime_gettime_monotonic(&t1);
-    FILL_RAND(fft1_in, nrows * ncols);
+    FILL_RAND(fft1_in, nrows * lda);
     ptime_gettime_monotonic(&t2);
     PRINT_ELAPSED_TIME("fill", &t1, &t2);
 
     if (do_init) {
         ptime_gettime_monotonic(&t1);
-        memset(fft1_out, 0, nrows * ncols * sizeof(FFTW_COMPLEX_T));
-        memset(fft2_in, 0, nrows * ncols * sizeof(FFTW_COMPLEX_T));
-        memset(fft2_out, 0, nrows * ncols * sizeof(FFTW_COMPLEX_T));
+        memset(fft1_out, 0, nrows * lda * sizeof(FFTW_COMPLEX_T));
+        memset(fft2_in, 0, ncols * ldb * sizeof(FFTW_COMPLEX_T));
+        memset(fft2_out, 0, ncols * ldb * sizeof(FFTW_COMPLEX_T));
         ptime_gettime_monotonic(&t2);
         PRINT_ELAPSED_TIME("init", &t1, &t2);
     }
 
     // Perform first set of 1D FFTs
     ptime_gettime_monotonic(&t1);
-    fft_1d(p1, nrows);
+    fft_1d(p1, np1);
     ptime_gettime_monotonic(&t2);
     PRINT_ELAPSED_TIME("fft-1d-1", &t1, &t2);
 
@@ -222,13 +1042,269 @@ static void fft_ct_1d(void)
 
     // Perform second set of 1D FFTs
     ptime_gettime_monotonic(&t1);
-    fft_1d(p2, ncols);
+    fft_1d(p2, np2);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
+
+    // Cleanup
+    data_page_report("fft1-in", fft1_in, "fft1-out", fft1_out);
+    data_page_report("fft2-in", fft2_in, "fft2-out", fft2_out);
+#if defined(_USE_TRANSP_THREADS)
+    data_numa_report("fft1-in", fft1_in, "fft1-out", fft1_out, nrows * lda);
+    data_numa_report("fft2-in", fft2_in, "fft2-out", fft2_out, ncols * ldb);
+#endif
+#if defined(_USE_TRANSP_PLAN)
+    transpose_plan_teardown();
+#endif
+#if defined(_USE_TRANSP_GURU)
+    transpose_guru_teardown();
+#endif
+#if defined(_USE_TRANSP_SCRATCH)
+    TRANSPOSE_SCRATCH_RELEASE();
+#endif
+    data_free(fft2_in, fft2_out, p2, np2);
+    data_free(fft1_in, fft1_out, p1, np1);
+}
+
+/*
+ * The corner turn without a transpose: FFT 1 stores element j of its row i at
+ * row j and column i of FFT 2's input, i.e., with stride ldb.  With -B, each
+ * plan's batch of rows writes a narrow block of columns of every output row,
+ * so the strided writes stay within a few cache lines per row.
+ */
+static void fft_ct_1d_strided(void)
+{
+    FFTW_COMPLEX_T *fft1_in, *fft2_in, *fft2_out;
+    FFTW_PLAN_T *p1, *p2;
+    size_t np1, np2;
+
+    // Setup FFT 1 (writes transposed) and FFT 2
+    ld_init();
+    buf_alloc(&fft1_in, nrows, lda);
+    buf_alloc(&fft2_in, ncols, ldb);
+    buf_alloc(&fft2_out, ncols, ldb);
+    np1 = plans_alloc_strided(&p1, fft1_in, fft2_in, nrows, ncols, 1, lda,
+                              ldb, 1, do_row_plans ? 1 : batch_rows, "plan-1");
+    np2 = plans_alloc(&p2, fft2_in, fft2_out, ncols, nrows, ldb, "plan-2");
+    plans_report();
+
+    // Populate input with random data
+    ptime_gettime_monotonic(&t1);
+    FILL_RAND(fft1_in, nrows * lda);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+
+    if (do_init) {
+        ptime_gettime_monotonic(&t1);
+        memset(fft2_in, 0, ncols * ldb * sizeof(FFTW_COMPLEX_T));
+        memset(fft2_out, 0, ncols * ldb * sizeof(FFTW_COMPLEX_T));
+        ptime_gettime_monotonic(&t2);
+        PRINT_ELAPSED_TIME("init", &t1, &t2);
+    }
+
+    // Perform first set of 1D FFTs, which also transposes
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p1, np1);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-1", &t1, &t2);
+
+    // Perform second set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p2, np2);
     ptime_gettime_monotonic(&t2);
     PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
 
     // Cleanup
-    data_free(fft2_in, fft2_out, p2, ncols);
-    data_free(fft1_in, fft1_out, p1, nrows);
+    data_page_report("fft2-in", fft2_in, "fft2-out", fft2_out);
+#if defined(_USE_TRANSP_THREADS)
+    data_numa_report("fft2-in", fft2_in, "fft2-out", fft2_out, ncols * ldb);
+#endif
+    data_free(fft2_in, fft2_out, p2, np2);
+    plans_free(p1, np1);
+    FFTW_FREE(fft1_in);
+}
+#endif
+
+#if defined(_USE_TRANSP_EPI)
+/*
+ * Returns the relative RMS error of the six-step FFT X of x, compared to a
+ * direct 1-D FFT of length n = nrows * ncols.  x is stored as ncols rows of
+ * nrows elements with stride ldb, and X as nrows rows of ncols with stride lda.
+ */
+static double verify_six_step(const FFTW_COMPLEX_T *x, const FFTW_COMPLEX_T *X)
+{
+    const size_t n = nrows * ncols;
+    FFTW_COMPLEX_T *in = ASSERT_FFTW_MALLOC(n * sizeof(FFTW_COMPLEX_T));
+    FFTW_COMPLEX_T *out = ASSERT_FFTW_MALLOC(n * sizeof(FFTW_COMPLEX_T));
+    FFTW_PLAN_T p = FFTW_PLAN_1D(n, in, out, FFTW_FORWARD, FFTW_ESTIMATE);
+    double err = 0, ref = 0;
+    size_t r, c;
+    for (r = 0; r < ncols; r++) {
+        memcpy(&in[r * nrows], &x[r * ldb], nrows * sizeof(FFTW_COMPLEX_T));
+    }
+    FFTW_EXECUTE(p);
+    for (r = 0; r < nrows; r++) {
+        for (c = 0; c < ncols; c++) {
+            err += pow(cabs(X[r * lda + c] - out[r * ncols + c]), 2);
+            ref += pow(cabs(out[r * ncols + c]), 2);
+        }
+    }
+    FFTW_PLAN_DESTROY(p);
+    FFTW_FREE(out);
+    FFTW_FREE(in);
+    return ref ? sqrt(err / ref) : sqrt(err);
+}
+
+/*
+ * A six-step 1-D FFT of length n = nrows * ncols: element j1 + nrows * j2 of
+ * the input is at row j2 and column j1 of an ncols x nrows matrix.
+ * Its transpose gets 1-D FFTs of length ncols by row, then is transposed back
+ * with twiddle factors, gets 1-D FFTs of length nrows by row, and is
+ * transposed once more, so element k2 + ncols * k1 of the output is at row k1
+ * and column k2 of an nrows x ncols matrix.
+ * The input is in fft2-out, which FFT 2 overwrites, and the output in fft1-in.
+ */
+static int fft_six_step_1d(void)
+{
+    const transpose_epilogue identity = { 1, 0, 0, 0, NULL };
+    FFTW_COMPLEX_T *fft1_in, *fft1_out, *fft2_in, *fft2_out, *x = NULL;
+    FFTW_PLAN_T *p1, *p2;
+    size_t np1, np2;
+    transpose_twiddle *tw;
+    double err;
+    int rc = 0;
+
+    // Setup FFT 1 (before twiddles) and FFT 2 (after twiddles)
+    ld_init();
+    np1 = data_alloc(&fft1_in, &fft1_out, &p1, nrows, ncols, lda, "plan-1");
+    np2 = data_alloc(&fft2_in, &fft2_out, &p2, ncols, nrows, ldb, "plan-2");
+    plans_report();
+
+    // Compute twiddle factors
+    ptime_gettime_monotonic(&t1);
+    tw = TWIDDLE_CREATE(nrows, ncols, FFTW_FORWARD, do_twiddle_full);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("twiddle", &t1, &t2);
+    printf("twiddle-size (KiB): %zu\n", tw->size / 1024);
+    epi.tw = tw;
+
+    // Populate input with random data
+    ptime_gettime_monotonic(&t1);
+    FILL_RAND(fft2_out, ncols * ldb);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fill", &t1, &t2);
+
+    if (do_verify) {
+        // keep a copy of the input to verify against
+        x = ASSERT_FFTW_MALLOC(ncols * ldb * sizeof(FFTW_COMPLEX_T));
+        memcpy(x, fft2_out, ncols * ldb * sizeof(FFTW_COMPLEX_T));
+    }
+
+    if (do_init) {
+        ptime_gettime_monotonic(&t1);
+        memset(fft1_in, 0, nrows * lda * sizeof(FFTW_COMPLEX_T));
+        memset(fft1_out, 0, nrows * lda * sizeof(FFTW_COMPLEX_T));
+        memset(fft2_in, 0, ncols * ldb * sizeof(FFTW_COMPLEX_T));
+        ptime_gettime_monotonic(&t2);
+        PRINT_ELAPSED_TIME("init", &t1, &t2);
+    }
+
+    // Transpose the input
+    ptime_gettime_monotonic(&t1);
+    transpose_epi(fft2_out, fft1_in, ncols, nrows, ldb, lda, &identity);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("transpose-1", &t1, &t2);
+
+    // Perform first set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p1, np1);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-1", &t1, &t2);
+
+    // Matrix transpose, multiplying by twiddle factors
+    ptime_gettime_monotonic(&t1);
+    transpose_epi(fft1_out, fft2_in, nrows, ncols, lda, ldb, &epi);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("transpose-2", &t1, &t2);
+
+    // Perform second set of 1D FFTs
+    ptime_gettime_monotonic(&t1);
+    fft_1d(p2, np2);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("fft-1d-2", &t1, &t2);
+
+    // Transpose the output
+    ptime_gettime_monotonic(&t1);
+    transpose_epi(fft2_out, fft1_in, ncols, nrows, ldb, lda, &identity);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("transpose-3", &t1, &t2);
+
+    if (do_verify) {
+        ptime_gettime_monotonic(&t1);
+        err = verify_six_step(x, fft1_in);
+        ptime_gettime_monotonic(&t2);
+        PRINT_ELAPSED_TIME("verify", &t1, &t2);
+        printf("verify-error: %e\n", err);
+        rc = !(err <= FFT_TOLERANCE);
+        FFTW_FREE(x);
+    }
+
+    // Cleanup
+    data_page_report("fft1-in", fft1_in, "fft1-out", fft1_out);
+    data_page_report("fft2-in", fft2_in, "fft2-out", fft2_out);
+#if defined(_USE_TRANSP_THREADS)
+    data_numa_report("fft1-in", fft1_in, "fft1-out", fft1_out, nrows * lda);
+    data_numa_report("fft2-in", fft2_in, "fft2-out", fft2_out, ncols * ldb);
+#endif
+    epi.tw = NULL;
+    transpose_twiddle_destroy(tw);
+    data_free(fft2_in, fft2_out, p2, np2);
+    data_free(fft1_in, fft1_out, p1, np1);
+    return rc;
+}
+#endif
+#endif
+
+/*
+ * FFTW wisdom is kept in a file in wisdom_dir for each matrix size, data type,
+ * and thread count, which determine the plans.
+ */
+static void fft_wisdom_path(char *buf, size_t len)
+{
+#if defined(_USE_TRANSP_THREADS)
+    const size_t thr = nthreads;
+#else
+    const size_t thr = 1;
+#endif
+    if ((size_t) WISDOM_PATH(buf, len, wisdom_dir, nrows, ncols, thr) >= len) {
+        errno = ENAMETOOLONG;
+        perror(wisdom_dir);
+        exit(errno);
+    }
+}
+
+static void fft_wisdom_import(void)
+{
+    char path[4096];
+    if (wisdom_dir) {
+        fft_wisdom_path(path, sizeof(path));
+        // a wisdom file that doesn't exist yet is created on export
+        if (WISDOM_IMPORT(path) && errno != ENOENT) {
+            perror(path);
+            exit(errno);
+        }
+    }
+}
+
+static void fft_wisdom_export(void)
+{
+    char path[4096];
+    if (wisdom_dir) {
+        fft_wisdom_path(path, sizeof(path));
+        if (WISDOM_EXPORT(path)) {
+            perror(path);
+        }
+    }
 }
 
 static void usage(const char *pname, int code)
@@ -239,21 +1315,96 @@ static void usage(const char *pname, int code)
             " [-R ROWS] [-C COLS]"
 #endif
 #if defined(_USE_TRANSP_THREADS)
-            " [-t THREADS]"
+            " [-t THREADS] [-N]"
+#endif
+#if defined(_USE_TRANSP_PLAN)
+            " [-M] [-w FILE]"
+#endif
+#if defined(_USE_TRANSP_LD)
+            " [-l LDA] [-L LDB] [-P]"
+#endif
+#if defined(_USE_TRANSP_EPI)
+            " [-S] [-T] [-v]"
 #endif
-            " [-h]\n"
+#if defined(_USE_FFT_COLS)
+            " [-E ENGINE] [-K COLS]"
+#elif !defined(_USE_TRANSP_INPLACE)
+            " [-X]"
+#endif
+            " [-F RIGOR] [-W DIR] [-B ROWS] [--row-plans] [-H] [-h]\n"
             "  -r, --rows=ROWS          Matrix row count, in [1, ULONG_MAX]\n"
             "  -c, --cols=COLS          Matrix column count, in [1, ULONG_MAX]\n"
+#if defined(_USE_TRANSP_SQUARE)
+            "                           ROWS and COLS must be equal (in-place, square)\n"
+#endif
 #if defined(_USE_TRANSP_BLOCKED)
             "  -R, --block-rows=ROWS    Rows per block, in [0, ULONG_MAX]\n"
             "  -C, --block-cols=COLS    Columns per block, in [0, ULONG_MAX]\n"
             "                           ROWS/COLS must be divisors of the corresponding\n"
             "                           matrix dimension\n"
             "                           (default=0, implies no blocking in that dimension)\n"
+#if defined(_USE_TRANSP_SQUARE)
+            "                           Block ROWS and COLS must be equal\n"
+#endif
 #endif
 #if defined(_USE_TRANSP_THREADS)
             "  -t, --threads=THREADS    Number of threads, in (0, ULONG_MAX] (default=1)\n"
+            "  -N, --numa               Print the NUMA nodes the matrices' pages are on\n"
+#endif
+#if defined(_USE_TRANSP_PLAN)
+            "  -M, --measure            Plan the transpose by timing candidates instead of\n"
+            "                           estimating\n"
+            "  -w, --wisdom=FILE        Load transpose plans from FILE, if it exists, and\n"
+            "                           save plans to FILE after the benchmark\n"
+#endif
+#if defined(_USE_FFT_COLS)
+            "  -l, --lda=LDA            Row stride of the input and the first FFTs' output\n"
+            "                           in elements, in [COLS, ULONG_MAX] (default=COLS)\n"
+            "  -L, --ldb=LDB            Row stride of the column FFTs' output in elements,\n"
+            "                           in [COLS, ULONG_MAX] (default=COLS)\n"
+#elif defined(_USE_TRANSP_LD)
+            "  -l, --lda=LDA            Transpose input row stride in elements, in\n"
+            "                           [COLS, ULONG_MAX] (default=COLS)\n"
+            "  -L, --ldb=LDB            Transpose output row stride in elements, in\n"
+            "                           [ROWS, ULONG_MAX] (default=ROWS)\n"
+            "                           FFT plans use the same row strides\n"
+#endif
+#if defined(_USE_TRANSP_LD)
+            "  -P, --pad                Pad rows whose stride isn't given to an odd number\n"
+            "                           of cache lines, to avoid cache set conflicts\n"
 #endif
+#if defined(_USE_TRANSP_EPI)
+            "  -S, --six-step           Compute one 1-D FFT of length ROWS*COLS with the\n"
+            "                           six-step algorithm, fusing the twiddle factors into\n"
+            "                           the transpose between the sets of 1-D FFTs\n"
+            "  -T, --twiddle-table      Precompute all ROWS*COLS twiddle factors, instead\n"
+            "                           of computing them from two tables of ~sqrt(ROWS*COLS)\n"
+            "  -v, --verify             Verify the six-step FFT against a direct 1-D FFT\n"
+#endif
+#if defined(_USE_FFT_COLS)
+            "  -E, --col-engine=ENGINE  Second set of 1-D FFTs, down the columns: fftw or\n"
+            "                           radix2 (built-in, ROWS must be a power of two)\n"
+            "                           (default=fftw)\n"
+            "  -K, --col-panel=COLS     Columns per panel of column FFTs, in [1, ULONG_MAX]\n"
+            "                           (default=16 for fftwf, 8 for fftw)\n"
+#elif !defined(_USE_TRANSP_INPLACE)
+            "  -X, --no-transpose       Write the output of the first set of 1-D FFTs\n"
+            "                           transposed, instead of performing a transpose\n"
+#endif
+            "  -F, --plan-flags=RIGOR   FFTW planner rigor for the 1-D FFTs: estimate,\n"
+            "                           measure, patient, or exhaustive (default=estimate)\n"
+#if defined(_USE_TRANSP_GURU)
+            "                           Also applies to the FFTW transpose plan\n"
+#endif
+            "  -W, --fftw-wisdom=DIR    Load FFTW plans from the wisdom file in DIR for the\n"
+            "                           matrix size, type, and thread count, if it exists,\n"
+            "                           and save plans to it after the benchmark\n"
+            "  -B, --batch-rows=ROWS    Rows per batched 1-D FFT plan, in [0, ULONG_MAX]\n"
+            "                           (default=0, implies each thread's rows)\n"
+            "      --row-plans          Create a 1-D FFT plan for every row, instead of a\n"
+            "                           batched plan for each thread's rows\n"
+            "  -H, --huge-pages         Back matrices with huge pages, if possible, and\n"
+            "                           print the page size obtained for each\n"
             "  -i, --init               Initialize all matrices (simulates buffer reuse)\n"
             "                           Note: input matrix is always initialized\n"
             "  -h, --help               Print this message and exit\n",
@@ -270,13 +1421,33 @@ static size_t assert_to_size_t(const char* str, const char* pname)
     return s;
 }
 
-static const char opts_short[] = "r:c:R:C:t:ih";
+// long-only options, whose letters transp uses for something else
+#define OPT_ROW_PLANS 256
+
+static const char opts_short[] = "r:c:R:C:t:NMw:l:L:PSTvXE:K:F:W:B:Hih";
 static const struct option opts_long[] = {
     {"rows",        required_argument,  NULL,   'r'},
     {"cols",        required_argument,  NULL,   'c'},
     {"block-rows",  required_argument,  NULL,   'R'},
     {"block-cols",  required_argument,  NULL,   'C'},
     {"threads",     required_argument,  NULL,   't'},
+    {"numa",        no_argument,        NULL,   'N'},
+    {"measure",     no_argument,        NULL,   'M'},
+    {"wisdom",      required_argument,  NULL,   'w'},
+    {"lda",         required_argument,  NULL,   'l'},
+    {"ldb",         required_argument,  NULL,   'L'},
+    {"pad",         no_argument,        NULL,   'P'},
+    {"six-step",    no_argument,        NULL,   'S'},
+    {"twiddle-table", no_argument,      NULL,   'T'},
+    {"verify",      no_argument,        NULL,   'v'},
+    {"no-transpose", no_argument,       NULL,   'X'},
+    {"col-engine",  required_argument,  NULL,   'E'},
+    {"col-panel",   required_argument,  NULL,   'K'},
+    {"plan-flags",  required_argument,  NULL,   'F'},
+    {"fftw-wisdom", required_argument,  NULL,   'W'},
+    {"batch-rows",  required_argument,  NULL,   'B'},
+    {"row-plans",   no_argument,        NULL,   OPT_ROW_PLANS},
+    {"huge-pages",  no_argument,        NULL,   'H'},
     {"init",        no_argument,        NULL,   'i'},
     {"help",        no_argument,        NULL,   'h'},
     {0, 0, 0, 0}
@@ -284,6 +1455,9 @@ static const struct option opts_long[] = {
 
 int main(int argc, char **argv)
 {
+#if defined(_USE_TRANSP_EPI)
+    int rc;
+#endif
     int c;
 
     while ((c = getopt_long(argc, argv, opts_short, opts_long, NULL)) != -1) {
@@ -309,7 +1483,79 @@ int main(int argc, char **argv)
                 usage(argv[0], EINVAL);
             }
             break;
+        case 'N':
+            do_numa = true;
+            break;
 #endif
+#if defined(_USE_TRANSP_PLAN)
+        case 'M':
+            plan_mode = TRANSPOSE_PLAN_MEASURE;
+            break;
+        case 'w':
+            wisdom_file = optarg;
+            break;
+#endif
+#if defined(_USE_TRANSP_LD)
+        case 'l':
+            lda = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'L':
+            ldb = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'P':
+            do_pad = true;
+            break;
+#endif
+#if defined(_USE_TRANSP_EPI)
+        case 'S':
+            do_six_step = true;
+            break;
+        case 'T':
+            do_twiddle_full = true;
+            break;
+        case 'v':
+            do_verify = true;
+            break;
+#endif
+#if defined(_USE_FFT_COLS)
+        case 'E':
+            if (!strcmp(optarg, "radix2")) {
+                do_col_radix2 = true;
+            } else if (!strcmp(optarg, "fftw")) {
+                do_col_radix2 = false;
+            } else {
+                usage(argv[0], EINVAL);
+            }
+            break;
+        case 'K':
+            col_panel = assert_to_size_t(optarg, argv[0]);
+            if (!col_panel) {
+                usage(argv[0], EINVAL);
+            }
+            break;
+#elif !defined(_USE_TRANSP_INPLACE)
+        case 'X':
+            do_no_transpose = true;
+            break;
+#endif
+        case 'F':
+            if (PLAN_FLAGS(optarg, &plan_flags)) {
+                usage(argv[0], EINVAL);
+            }
+            break;
+        case 'W':
+            wisdom_dir = optarg;
+            break;
+        case 'B':
+            batch_rows = assert_to_size_t(optarg, argv[0]);
+            break;
+        case OPT_ROW_PLANS:
+            do_row_plans = true;
+            break;
+        case 'H':
+            do_huge = true;
+            alloc_huge_pages(1);
+            break;
         case 'i':
             do_init = true;
             break;
@@ -324,6 +1570,12 @@ int main(int argc, char **argv)
     if (!nrows || !ncols) {
         usage(argv[0], EINVAL);
     }
+#if defined(_USE_TRANSP_LD)
+    // rows may be padded, but not overlap
+    if ((lda && lda < ncols) || (ldb && ldb < LDB_COLS)) {
+        usage(argv[0], EINVAL);
+    }
+#endif
 #if defined(_USE_TRANSP_BLOCKED)
     // fall back to default values
     if (!nblkrows) {
@@ -332,11 +1584,61 @@ int main(int argc, char **argv)
     if (!nblkcols) {
         nblkcols = ncols;
     }
-    // check divisibility
+#if !defined(_USE_TRANSP_EPI)
+    // check divisibility (epilogue transposes support partial blocks)
     if ((nrows % nblkrows) || (ncols % nblkcols)) {
         usage(argv[0], EINVAL);
     }
 #endif
-    fft_ct_1d();
+#if defined(_USE_TRANSP_SQUARE)
+    // in-place tiles are swapped with their mirror tiles, so must be square
+    if (nblkrows != nblkcols) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#endif
+#if defined(_USE_TRANSP_SQUARE)
+    if (nrows != ncols) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#if defined(_USE_FFT_COLS)
+    // the radix-2 kernel only supports powers of two
+    if (do_col_radix2 && (nrows & (nrows - 1))) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#if defined(_USE_TRANSP_DISPATCH) || defined(_USE_TRANSP_PLAN)
+    printf("isa: %s\n", transpose_dispatch_isa());
+#endif
+#if defined(_USE_TRANSP_EPI)
+    // twiddle factors and verification are only for six-step FFTs, whose
+    // dimensions the vector kernels compute exponents from in 32 bits
+    if ((!do_six_step && (do_twiddle_full || do_verify)) ||
+        (do_six_step && (do_no_transpose ||
+                         nrows > UINT32_MAX || ncols > UINT32_MAX))) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+    fft_wisdom_import();
+#if defined(_USE_TRANSP_EPI)
+    if (do_six_step) {
+        rc = fft_six_step_1d();
+        fft_wisdom_export();
+        return rc;
+    }
+#endif
+#if defined(_USE_TRANSP_INPLACE)
+    fft_ct_1d_inplace();
+#elif defined(_USE_FFT_COLS)
+    fft_ct_1d_cols();
+#else
+    if (do_no_transpose) {
+        fft_ct_1d_strided();
+    } else {
+        fft_ct_1d();
+    }
+#endif
+    fft_wisdom_export();
     return 0;
 }
@@ -5,13 +5,11 @@
  * @date 2019-09-11
  */
 #include <complex.h>
-#include <errno.h>
-#include <pthread.h>
 #include <stdlib.h>
 
 #include <fftw3.h>
 
-#include "util.h"
+#include "thread-pool.h"
 #include "fft-threads-fftwf.h"
 
 struct fft_thread_arg {
@@ -39,14 +37,13 @@ static void *fft_thread_fftwf(void *args)
     size_t i;
     for (i = ft_arg->r_min; i < ft_arg->r_max; i++)
         fftwf_execute(ft_arg->p[i]);
-    pthread_exit((void *)ft_arg->thr_num);
+    return (void *)ft_arg->thr_num;
 }
 
 void fft_thr_fftwf(const fftwf_plan *p, size_t A_rows, size_t num_thr)
 {
     size_t r_min, r_max, thr_num;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct fft_thread_arg *args = assert_malloc(num_thr * sizeof(struct fft_thread_arg));
+    struct fft_thread_arg *args = thread_pool_args(sizeof(struct fft_thread_arg), num_thr);
     // divide the rows as evenly as possible among the threads
     const size_t num_thr_with_max_rows = A_rows % num_thr;
     const size_t min_rows_per_thread = A_rows / num_thr;
@@ -62,23 +59,7 @@ void fft_thr_fftwf(const fftwf_plan *p, size_t A_rows, size_t num_thr)
             r_max = r_min + min_rows_per_thread;
         }
         ft_arg_init(&args[thr_num], p, A_rows, r_min, r_max, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, fft_thread_fftwf,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
-        }
-    }
-
-    // wait for the other threads
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
     }
 
-    free(args);
-    free(threads);
+    thread_pool_run(fft_thread_fftwf, args, sizeof(*args), num_thr);
 }
@@ -0,0 +1,145 @@
+/**
+ * NUMA placement of matrices for the threaded benchmarks.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+// for syscall
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include "numa-util.h"
+#include "thread-pool.h"
+
+// pages to query per system call
+#define NUMA_QUERY_PAGES 1024
+
+struct touch_arg {
+    char *buf;
+    size_t size;
+    size_t num_thr;
+    size_t page;
+    size_t thr_num;
+};
+
+static void *first_touch_thread(void *args)
+{
+    const struct touch_arg *arg = (const struct touch_arg *)args;
+    const size_t start = arg->thr_num * arg->size / arg->num_thr;
+    const size_t end = (arg->thr_num + 1) * arg->size / arg->num_thr;
+    size_t i = start;
+    while (i < end) {
+        arg->buf[i] = 0;
+        // the start of the next page
+        i += arg->page - ((uintptr_t)&arg->buf[i] % arg->page);
+    }
+    return (void *)arg->thr_num;
+}
+
+void numa_first_touch(void *buf, size_t size, size_t num_thr)
+{
+    size_t thr_num;
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    struct touch_arg *args = thread_pool_args(sizeof(struct touch_arg), num_thr);
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        args[thr_num].buf = (char *)buf;
+        args[thr_num].size = size;
+        args[thr_num].num_thr = num_thr;
+        args[thr_num].page = page;
+        args[thr_num].thr_num = thr_num;
+    }
+    thread_pool_run(first_touch_thread, args, sizeof(*args), num_thr);
+}
+
+#if defined(__linux__) && defined(SYS_move_pages)
+/* Returns the thread whose partition (as in first_touch_thread) has offset */
+static size_t partition_of(size_t offset, size_t size, size_t num_thr)
+{
+    size_t thr_num = offset * num_thr / size;
+    while (thr_num + 1 < num_thr && (thr_num + 1) * size / num_thr <= offset) {
+        thr_num++;
+    }
+    while (thr_num > 0 && thr_num * size / num_thr > offset) {
+        thr_num--;
+    }
+    return thr_num;
+}
+
+/* Count pages per node, and pages on the node of their partition's thread */
+static void count_pages(const char *buf, size_t size, size_t num_thr,
+                        size_t *per_node, size_t max_nodes, size_t *none,
+                        size_t *local, size_t *known)
+{
+    void *pages[NUMA_QUERY_PAGES];
+    int status[NUMA_QUERY_PAGES];
+    size_t thr[NUMA_QUERY_PAGES];
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const char *p = buf - ((uintptr_t)buf % page);
+    size_t n, i, offset;
+    int node;
+    while (p < buf + size) {
+        for (n = 0; n < NUMA_QUERY_PAGES && p < buf + size; n++, p += page) {
+            pages[n] = (void *)p;
+            // the partition of the first byte of the page that's in buf
+            offset = p < buf ? 0 : (size_t)(p - buf);
+            thr[n] = partition_of(offset, size, num_thr);
+        }
+        // with no target nodes, move_pages only reports each page's node
+        if (syscall(SYS_move_pages, 0, n, pages, NULL, status, 0)) {
+            perror("move_pages");
+            return;
+        }
+        for (i = 0; i < n; i++) {
+            if (status[i] < 0) {
+                (*none)++;
+                continue;
+            }
+            if ((size_t)status[i] < max_nodes) {
+                per_node[status[i]]++;
+            }
+            node = thread_pool_node(thr[i]);
+            if (node >= 0) {
+                (*known)++;
+                *local += node == status[i];
+            }
+        }
+    }
+}
+#endif
+
+void numa_print_locality(const char *name, const void *buf, size_t size,
+                         size_t num_thr)
+{
+#if defined(__linux__) && defined(SYS_move_pages)
+    size_t per_node[64] = { 0 };
+    size_t none = 0;
+    size_t local = 0;
+    size_t known = 0;
+    size_t node;
+    count_pages((const char *)buf, size, num_thr, per_node,
+                sizeof(per_node) / sizeof(per_node[0]), &none, &local, &known);
+    for (node = 0; node < sizeof(per_node) / sizeof(per_node[0]); node++) {
+        if (per_node[node]) {
+            printf("%s-pages-node%zu: %zu\n", name, node, per_node[node]);
+        }
+    }
+    if (none) {
+        printf("%s-pages-unplaced: %zu\n", name, none);
+    }
+    if (known) {
+        printf("%s-local (%%): %f\n", name, 100.0 * local / known);
+    }
+#else
+    (void) buf;
+    (void) size;
+    (void) num_thr;
+    printf("%s: NUMA locality not supported on this platform\n", name);
+#endif
+}
@@ -0,0 +1,33 @@
+/**
+ * NUMA placement of matrices for the threaded benchmarks.
+ *
+ * Linux places a page on the NUMA node of the thread that first touches it.
+ * A matrix allocated and filled by one thread therefore lives on one node, and
+ * threads on the other nodes read it remotely.  These functions instead touch
+ * each thread's contiguous partition of a buffer from that (pinned) thread, as
+ * the row-partitioned transposes and 1-D FFT stages divide it, and report
+ * where the pages actually landed.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef NUMA_UTIL_H
+#define NUMA_UTIL_H
+
+#include <stdlib.h>
+
+/**
+ * Touch the pages of buf, giving thread i of num_thr the i-th contiguous
+ * partition, so that each partition is placed on its thread's node.
+ * Must be called before anything else writes to buf; overwrites its contents.
+ */
+void numa_first_touch(void *buf, size_t size, size_t num_thr);
+
+/**
+ * Print the number of pages of buf on each NUMA node, and the percentage of
+ * pages that are on the node of the thread whose partition they're in.
+ */
+void numa_print_locality(const char *name, const void *buf, size_t size,
+                         size_t num_thr);
+
+#endif /* NUMA_UTIL_H */
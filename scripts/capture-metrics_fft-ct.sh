@@ -11,7 +11,10 @@ THRS=(1 16)
 
 SER=(
     fft-ct-fftwf-naive
+    fft-ct-fftwf-tlb
     fft-ct-fftwf-lib-lmkl
+    fft-ct-fftwf-lib-lfftwf
+    fft-ct-fftwf-lib-inplace-lfftwf
     fft-ct-fftwf-avx512-intr
     fft-ct-fftwf-avx512-intr-ss
 )
@@ -21,6 +24,9 @@ SER_BLK=(
 THR=(
     fft-ct-fftwf-thrrow
     fft-ct-fftwf-thrcol
+    fft-ct-fftwf-thrtile
+    fft-ct-fftwf-thrnuma
+    fft-ct-fftwf-thrtlb
     fft-ct-fftwf-thrrow-avx512-intr
     fft-ct-fftwf-thrrow-avx512-intr-ss
     fft-ct-fftwf-thrcol-avx512-intr
@@ -30,6 +36,23 @@ THR_BLK=(
     fft-ct-fftwf-thrrow-blocked
     fft-ct-fftwf-thrcol-blocked
 )
+# Transpose-free (-X), with rows per batched FFT plan (0 = each thread's rows)
+BATCHES=(0 8 64)
+SER_NOTRANSP=(
+    fft-ct-fftwf-naive
+)
+THR_NOTRANSP=(
+    fft-ct-fftwf-thrrow
+)
+# Column FFTs (no corner turn), with each engine and columns per panel
+ENGINES=(fftw radix2)
+PANELS=(8 16)
+SER_COLS=(
+    fft-ct-fftwf-cols-avx512-intr
+)
+THR_COLS=(
+    fft-ct-fftwf-thrcols-avx512-intr
+)
 
 function capture() {
     local log=$1
@@ -100,6 +123,62 @@ function capture_thr_blk() {
     done # ROWS
 }
 
+function capture_ser_notransp() {
+    local bin=$1
+    for r in "${ROWS[@]}"; do
+    for c in "${COLS[@]}"; do
+    for b in "${BATCHES[@]}"; do
+        capture "${bin}_r-${r}_c-${c}_X_B-${b}.log" 1 "$bin" \
+                -r "$r" -c "$c" -X -B "$b"
+    done # BATCHES
+    done # COLS
+    done # ROWS
+}
+
+function capture_thr_notransp() {
+    local bin=$1
+    for r in "${ROWS[@]}"; do
+    for c in "${COLS[@]}"; do
+    for t in "${THRS[@]}"; do
+    for b in "${BATCHES[@]}"; do
+        capture "${bin}_r-${r}_c-${c}_t-${t}_X_B-${b}.log" "$t" "$bin" \
+                -r "$r" -c "$c" -t "$t" -X -B "$b"
+    done # BATCHES
+    done # THRS
+    done # COLS
+    done # ROWS
+}
+
+function capture_ser_cols() {
+    local bin=$1
+    for r in "${ROWS[@]}"; do
+    for c in "${COLS[@]}"; do
+    for e in "${ENGINES[@]}"; do
+    for k in "${PANELS[@]}"; do
+        capture "${bin}_r-${r}_c-${c}_E-${e}_K-${k}.log" 1 "$bin" \
+                -r "$r" -c "$c" -E "$e" -K "$k"
+    done # PANELS
+    done # ENGINES
+    done # COLS
+    done # ROWS
+}
+
+function capture_thr_cols() {
+    local bin=$1
+    for r in "${ROWS[@]}"; do
+    for c in "${COLS[@]}"; do
+    for t in "${THRS[@]}"; do
+    for e in "${ENGINES[@]}"; do
+    for k in "${PANELS[@]}"; do
+        capture "${bin}_r-${r}_c-${c}_t-${t}_E-${e}_K-${k}.log" "$t" "$bin" \
+                -r "$r" -c "$c" -t "$t" -E "$e" -K "$k"
+    done # PANELS
+    done # ENGINES
+    done # THRS
+    done # COLS
+    done # ROWS
+}
+
 
 for bin in "${SER[@]}"; do
     capture_ser "$bin"
@@ -113,3 +192,15 @@ done
 for bin in "${THR_BLK[@]}"; do
     capture_thr_blk "$bin"
 done
+for bin in "${SER_NOTRANSP[@]}"; do
+    capture_ser_notransp "$bin"
+done
+for bin in "${THR_NOTRANSP[@]}"; do
+    capture_thr_notransp "$bin"
+done
+for bin in "${SER_COLS[@]}"; do
+    capture_ser_cols "$bin"
+done
+for bin in "${THR_COLS[@]}"; do
+    capture_thr_cols "$bin"
+done
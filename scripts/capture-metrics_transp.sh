@@ -11,7 +11,10 @@ THRS=(1 16)
 
 SER=(
     transp-fftwf-naive
+    transp-fftwf-tlb
     transp-fftwf-lib-lmkl
+    transp-fftwf-lib-lfftwf
+    transp-fftwf-lib-inplace-lfftwf
     transp-fftwf-avx512-intr
     transp-fftwf-avx512-intr-ss
 )
@@ -21,10 +24,14 @@ SER_BLK=(
 THR=(
     transp-fftwf-thrrow
     transp-fftwf-thrcol
+    transp-fftwf-thrtile
+    transp-fftwf-thrnuma
+    transp-fftwf-thrtlb
     transp-fftwf-thrrow-avx512-intr
     transp-fftwf-thrrow-avx512-intr-ss
     transp-fftwf-thrcol-avx512-intr
     transp-fftwf-thrcol-avx512-intr-ss
+    transp-fftwf-plan
 )
 THR_BLK=(
     transp-fftwf-thrrow-blocked
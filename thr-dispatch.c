@@ -0,0 +1,178 @@
+/**
+ * FFT Corner Turn benchmark.
+ *
+ * Thread dispatch overhead: creating and joining threads for every call vs.
+ * submitting to the persistent thread pool, with argument arrays allocated for
+ * every call vs. taken from the pool's reusable storage.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <errno.h>
+#include <getopt.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ptime.h"
+#include "thread-pool.h"
+#include "util.h"
+
+static size_t nthreads = 1;
+static size_t niters = 10000;
+static struct timespec t1;
+static struct timespec t2;
+
+#define PRINT_ELAPSED_TIME(prefix, t1, t2) \
+    printf("%s (ms): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000000.0);
+
+#define PRINT_ELAPSED_TIME_PER_CALL(prefix, t1, t2) \
+    printf("%s (us): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000.0 / niters);
+
+struct thread_count {
+    size_t count;
+    // one cache line per thread
+    char pad[64 - sizeof(size_t)];
+};
+
+struct thread_arg {
+    struct thread_count *counts;
+    size_t thr_num;
+};
+
+static void *thread_noop(void *args)
+{
+    struct thread_arg *arg = (struct thread_arg *)args;
+    arg->counts[arg->thr_num].count++;
+    return (void *)arg->thr_num;
+}
+
+static void thread_arg_init(struct thread_arg *args, struct thread_count *counts)
+{
+    size_t i;
+    for (i = 0; i < nthreads; i++) {
+        args[i].counts = counts;
+        args[i].thr_num = i;
+    }
+}
+
+// like threaded functions did: allocate, fill, and free arguments every call
+static void dispatch_malloc(void (*run)(void *(*)(void *), void *, size_t,
+                                        size_t),
+                            struct thread_count *counts)
+{
+    struct thread_arg *args = assert_malloc(nthreads * sizeof(*args));
+    thread_arg_init(args, counts);
+    run(thread_noop, args, sizeof(*args), nthreads);
+    free(args);
+}
+
+// like threaded functions do: fill the pool's argument storage every call
+static void dispatch_args(struct thread_count *counts)
+{
+    struct thread_arg *args = thread_pool_args(sizeof(*args), nthreads);
+    thread_arg_init(args, counts);
+    thread_pool_run(thread_noop, args, sizeof(*args), nthreads);
+}
+
+static void usage(const char *pname, int code)
+{
+    fprintf(code ? stderr : stdout,
+            "Usage: %s [-t THREADS] [-n ITERATIONS] [-h]\n"
+            "  -t, --threads=THREADS    Number of threads, in (0, ULONG_MAX] (default=1)\n"
+            "  -n, --iterations=N       Dispatches to time, in (0, ULONG_MAX] (default=10000)\n"
+            "  -h, --help               Print this message and exit\n",
+            pname);
+    exit(code);
+}
+
+static size_t assert_to_size_t(const char* str, const char* pname)
+{
+    size_t s = strtoul(str, NULL, 0);
+    if (s == ULONG_MAX && errno == ERANGE) {
+        usage(pname, errno);
+    }
+    return s;
+}
+
+static const char opts_short[] = "t:n:h";
+static const struct option opts_long[] = {
+    {"threads",     required_argument,  NULL,   't'},
+    {"iterations",  required_argument,  NULL,   'n'},
+    {"help",        no_argument,        NULL,   'h'},
+    {0, 0, 0, 0}
+};
+
+int main(int argc, char **argv)
+{
+    struct thread_count *counts;
+    size_t i;
+    int c;
+
+    while ((c = getopt_long(argc, argv, opts_short, opts_long, NULL)) != -1) {
+        switch (c) {
+        case 't':
+            nthreads = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'n':
+            niters = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'h':
+            usage(argv[0], 0);
+            break;
+        default:
+            usage(argv[0], EINVAL);
+            break;
+        }
+    }
+    if (!nthreads || !niters) {
+        usage(argv[0], EINVAL);
+    }
+
+    counts = assert_malloc_al(nthreads * sizeof(struct thread_count));
+    for (i = 0; i < nthreads; i++) {
+        counts[i].count = 0;
+    }
+
+    ptime_gettime_monotonic(&t1);
+    for (i = 0; i < niters; i++) {
+        dispatch_malloc(thread_spawn_run, counts);
+    }
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("spawn", &t1, &t2);
+    PRINT_ELAPSED_TIME_PER_CALL("spawn-per-call", &t1, &t2);
+
+    // the first call creates the workers
+    ptime_gettime_monotonic(&t1);
+    dispatch_args(counts);
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("pool-create", &t1, &t2);
+
+    ptime_gettime_monotonic(&t1);
+    for (i = 0; i < niters; i++) {
+        dispatch_malloc(thread_pool_run, counts);
+    }
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("pool-malloc", &t1, &t2);
+    PRINT_ELAPSED_TIME_PER_CALL("pool-malloc-per-call", &t1, &t2);
+
+    ptime_gettime_monotonic(&t1);
+    for (i = 0; i < niters; i++) {
+        dispatch_args(counts);
+    }
+    ptime_gettime_monotonic(&t2);
+    PRINT_ELAPSED_TIME("pool", &t1, &t2);
+    PRINT_ELAPSED_TIME_PER_CALL("pool-per-call", &t1, &t2);
+
+    // every thread must have run every dispatch
+    for (i = 0; i < nthreads; i++) {
+        if (counts[i].count != 3 * niters + 1) {
+            fprintf(stderr, "Thread %zu ran %zu times, expected %zu\n",
+                    i, counts[i].count, 3 * niters + 1);
+            return EINVAL;
+        }
+    }
+    free_al(counts);
+    return 0;
+}
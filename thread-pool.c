@@ -0,0 +1,424 @@
+/**
+ * Persistent thread pool for the threaded transposes and FFTs.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+// for CPU affinity
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "thread-pool.h"
+#include "util.h"
+
+// how long to spin waiting for work or for workers, before sleeping
+#define THREAD_POOL_SPIN 16384
+
+#if defined(__x86_64__) || defined(__i386__)
+#define cpu_relax() __builtin_ia32_pause()
+#else
+#define cpu_relax()
+#endif
+
+struct pool_worker {
+    // cache line aligned, so workers don't share lines
+    _Alignas(64) atomic_uint go;
+    atomic_uint sleeping;
+    size_t thr_num;
+    pthread_t thread;
+};
+
+struct thread_pool {
+    pthread_mutex_t lock;
+    struct pool_worker **workers;
+    size_t num_workers;
+    // CPUs to pin threads to, ordered by NUMA node, and their nodes
+    size_t *cpus;
+    int *nodes;
+    size_t num_cpus;
+    size_t spin;
+    int enabled;
+    // the current job, written by the caller before waking the workers
+    void *(*start_routine)(void *);
+    char *args;
+    size_t arg_size;
+    unsigned int job;
+    // the number of workers still running the current job
+    _Alignas(64) atomic_size_t pending;
+    // the last completed job
+    _Alignas(64) atomic_uint done;
+    atomic_uint caller_sleeping;
+};
+
+static struct thread_pool pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+// per-thread argument storage, one buffer per nesting level
+struct arg_buf {
+    char *buf;
+    size_t size;
+};
+
+struct arg_store {
+    struct arg_buf *levels;
+    size_t num_levels;
+};
+
+static pthread_key_t args_key;
+static pthread_once_t args_once = PTHREAD_ONCE_INIT;
+
+// set in workers, and in callers while they run a job
+static _Thread_local int in_pool = 0;
+// set in callers once they're pinned
+static _Thread_local int pinned = 0;
+// how many jobs the calling thread is running itself, i.e., whose arguments
+// are still in use
+static _Thread_local size_t args_depth = 0;
+
+static void futex_wait(atomic_uint *addr, unsigned int val)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+#else
+    (void) addr;
+    (void) val;
+    sched_yield();
+#endif
+}
+
+static void futex_wake(atomic_uint *addr)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else
+    (void) addr;
+#endif
+}
+
+/*
+ * Wait until *word != old: spin for a while, then sleep.
+ * The sleeping flag tells the waker whether a futex wake is needed -- since
+ * both sides store then load with sequential consistency, either the waker
+ * sees the flag or the waiter sees the new value.
+ */
+static void wait_while_eq(atomic_uint *word, unsigned int old,
+                          atomic_uint *sleeping)
+{
+    size_t i;
+    for (i = 0; i < pool.spin; i++) {
+        if (atomic_load_explicit(word, memory_order_acquire) != old) {
+            return;
+        }
+        cpu_relax();
+    }
+    while (atomic_load(word) == old) {
+        atomic_store(sleeping, 1);
+        if (atomic_load(word) == old) {
+            futex_wait(word, old);
+        }
+        atomic_store(sleeping, 0);
+    }
+}
+
+static void wake(atomic_uint *word, unsigned int val, atomic_uint *sleeping)
+{
+    atomic_store(word, val);
+    if (atomic_load(sleeping)) {
+        futex_wake(word);
+    }
+}
+
+#if defined(__linux__)
+/* Returns the NUMA node of a CPU, as reported by sysfs, or -1 if unknown */
+static int cpu_node(size_t cpu)
+{
+    char path[64];
+    DIR *dir;
+    struct dirent *ent;
+    int node = -1;
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu", cpu);
+    if (!(dir = opendir(path))) {
+        return -1;
+    }
+    while ((ent = readdir(dir))) {
+        if (sscanf(ent->d_name, "node%d", &node) == 1) {
+            break;
+        }
+        node = -1;
+    }
+    closedir(dir);
+    return node;
+}
+#endif
+
+static void pool_init(void)
+{
+    const char *env = getenv("THREAD_POOL");
+    const char *env_pin = getenv("THREAD_POOL_PIN");
+    size_t cpu, i;
+    int node;
+#if defined(__linux__)
+    cpu_set_t set;
+#endif
+    pool.enabled = !(env && !strcmp(env, "0"));
+    pool.num_cpus = 0;
+#if defined(__linux__)
+    // pin to the CPUs we're allowed to use, e.g., as set by numactl or taskset
+    if (!(env_pin && !strcmp(env_pin, "0")) &&
+        !sched_getaffinity(0, sizeof(set), &set)) {
+        pool.cpus = assert_malloc(CPU_COUNT(&set) * sizeof(size_t));
+        pool.nodes = assert_malloc(CPU_COUNT(&set) * sizeof(int));
+        // fill one node before the next, so threads with neighbouring
+        // partitions of a matrix share a node
+        for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (!CPU_ISSET(cpu, &set)) {
+                continue;
+            }
+            node = cpu_node(cpu);
+            for (i = pool.num_cpus; i > 0 && pool.nodes[i - 1] > node; i--) {
+                pool.cpus[i] = pool.cpus[i - 1];
+                pool.nodes[i] = pool.nodes[i - 1];
+            }
+            pool.cpus[i] = cpu;
+            pool.nodes[i] = node;
+            pool.num_cpus++;
+        }
+    }
+#else
+    (void) env_pin;
+    (void) cpu;
+    (void) i;
+    (void) node;
+#endif
+    // with only one CPU, spinning just delays the thread we're waiting for
+    pool.spin = pool.num_cpus == 1 ? 0 : THREAD_POOL_SPIN;
+}
+
+static void args_free(void *ptr)
+{
+    struct arg_store *st = (struct arg_store *)ptr;
+    size_t i;
+    for (i = 0; i < st->num_levels; i++) {
+        free(st->levels[i].buf);
+    }
+    free(st->levels);
+    free(st);
+}
+
+static void args_init(void)
+{
+    errno = pthread_key_create(&args_key, args_free);
+    if (errno) {
+        perror("pthread_key_create");
+        exit(errno);
+    }
+}
+
+void *thread_pool_args(size_t arg_size, size_t num_thr)
+{
+    struct arg_store *st;
+    struct arg_buf *b;
+    const size_t size = arg_size * num_thr;
+    size_t i;
+    pthread_once(&args_once, args_init);
+    if (!(st = pthread_getspecific(args_key))) {
+        st = assert_malloc(sizeof(*st));
+        st->levels = NULL;
+        st->num_levels = 0;
+        pthread_setspecific(args_key, st);
+    }
+    if (args_depth >= st->num_levels) {
+        st->levels = realloc(st->levels, (args_depth + 1) * sizeof(*st->levels));
+        if (!st->levels) {
+            perror("realloc");
+            exit(ENOMEM);
+        }
+        for (i = st->num_levels; i <= args_depth; i++) {
+            st->levels[i].buf = NULL;
+            st->levels[i].size = 0;
+        }
+        st->num_levels = args_depth + 1;
+    }
+    b = &st->levels[args_depth];
+    if (size > b->size) {
+        free(b->buf);
+        b->buf = assert_malloc(size);
+        b->size = size;
+    }
+    return b->buf;
+}
+
+static void pool_pin(size_t thr_num)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    if (!pool.num_cpus) {
+        return;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(pool.cpus[thr_num % pool.num_cpus], &set);
+    errno = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (errno) {
+        perror("pthread_setaffinity_np");
+    }
+#else
+    (void) thr_num;
+#endif
+}
+
+static void *pool_worker_run(void *arg)
+{
+    struct pool_worker *w = (struct pool_worker *)arg;
+    unsigned int seen = 0;
+    in_pool = 1;
+    pool_pin(w->thr_num);
+    for (;;) {
+        wait_while_eq(&w->go, seen, &w->sleeping);
+        seen = atomic_load_explicit(&w->go, memory_order_acquire);
+        pool.start_routine(pool.args + w->thr_num * pool.arg_size);
+        if (atomic_fetch_sub(&pool.pending, 1) == 1) {
+            wake(&pool.done, pool.job, &pool.caller_sleeping);
+        }
+    }
+    return NULL;
+}
+
+static void pool_grow(size_t num_thr)
+{
+    struct pool_worker *w;
+    size_t thr_num;
+    if (num_thr <= pool.num_workers) {
+        return;
+    }
+    pool.workers = realloc(pool.workers, num_thr * sizeof(*pool.workers));
+    if (!pool.workers) {
+        perror("realloc");
+        exit(ENOMEM);
+    }
+    // thread 0 is the caller
+    for (thr_num = pool.num_workers ? pool.num_workers : 1; thr_num < num_thr;
+         thr_num++) {
+        w = assert_malloc_al(sizeof(struct pool_worker));
+        atomic_init(&w->go, 0);
+        atomic_init(&w->sleeping, 0);
+        w->thr_num = thr_num;
+        errno = pthread_create(&w->thread, NULL, pool_worker_run, w);
+        if (errno) {
+            perror("pthread_create");
+            exit(errno);
+        }
+        pool.workers[thr_num] = w;
+    }
+    pool.workers[0] = NULL;
+    pool.num_workers = num_thr;
+}
+
+void thread_pool_run(void *(*start_routine)(void *), void *args,
+                     size_t arg_size, size_t num_thr)
+{
+    size_t thr_num;
+    unsigned int job;
+    pthread_once(&pool_once, pool_init);
+    if (!pool.enabled || in_pool) {
+        thread_spawn_run(start_routine, args, arg_size, num_thr);
+        return;
+    }
+    // the caller is thread 0
+    if (!pinned) {
+        pool_pin(0);
+        pinned = 1;
+    }
+    if (num_thr == 1) {
+        args_depth++;
+        start_routine(args);
+        args_depth--;
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    in_pool = 1;
+    pool_grow(num_thr);
+    pool.start_routine = start_routine;
+    pool.args = (char *)args;
+    pool.arg_size = arg_size;
+    job = ++pool.job;
+    atomic_store(&pool.pending, num_thr - 1);
+    for (thr_num = 1; thr_num < num_thr; thr_num++) {
+        wake(&pool.workers[thr_num]->go,
+             atomic_load(&pool.workers[thr_num]->go) + 1,
+             &pool.workers[thr_num]->sleeping);
+    }
+
+    args_depth++;
+    start_routine(args);
+    args_depth--;
+
+    // wait for the other threads
+    wait_while_eq(&pool.done, job - 1, &pool.caller_sleeping);
+    in_pool = 0;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+void thread_spawn_run(void *(*start_routine)(void *), void *args,
+                      size_t arg_size, size_t num_thr)
+{
+    size_t thr_num;
+    pthread_attr_t attr;
+    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
+#if defined(__linux__)
+    cpu_set_t set;
+#endif
+    pthread_once(&pool_once, pool_init);
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        pthread_attr_init(&attr);
+#if defined(__linux__)
+        // pin the same as the pool would
+        if (pool.num_cpus) {
+            CPU_ZERO(&set);
+            CPU_SET(pool.cpus[thr_num % pool.num_cpus], &set);
+            pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+        }
+#endif
+        errno = pthread_create(&threads[thr_num], &attr, start_routine,
+                               (char *)args + thr_num * arg_size);
+        pthread_attr_destroy(&attr);
+        if (errno) {
+            perror("pthread_create");
+            exit(errno);
+        }
+    }
+
+    // wait for the other threads
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        errno = pthread_join(threads[thr_num], NULL);
+        if (errno) {
+            perror("pthread_join");
+            exit(errno);
+        }
+    }
+
+    free(threads);
+}
+
+int thread_pool_node(size_t thr_num)
+{
+    pthread_once(&pool_once, pool_init);
+    return pool.num_cpus ? pool.nodes[thr_num % pool.num_cpus] : -1;
+}
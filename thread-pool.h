@@ -0,0 +1,62 @@
+/**
+ * Persistent thread pool for the threaded transposes and FFTs.
+ *
+ * Rather than creating and joining threads on every call, threaded functions
+ * submit their per-thread work to a pool of worker threads that are created
+ * once (when first needed) and pinned to the CPUs the process may run on.
+ * The calling thread runs the first piece of work itself.
+ * Workers spin briefly while waiting for work, then sleep on a futex, so
+ * back-to-back calls avoid system calls and idle workers don't burn CPU.
+ *
+ * Threads are pinned in NUMA node order, i.e., thread numbers fill the CPUs of
+ * one node before moving to the next, so threads that work on neighbouring
+ * partitions of a matrix share a node.
+ *
+ * Threaded functions get their per-thread argument arrays from
+ * thread_pool_args(), which reuses storage owned by the calling thread, so
+ * they don't allocate and free an array on every call either.
+ *
+ * Set the THREAD_POOL environment variable to 0 to create and join threads on
+ * every call instead, e.g., to compare the dispatch overhead.
+ * Set THREAD_POOL_PIN to 0 to leave threads unpinned.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdlib.h>
+
+/**
+ * Call start_routine(&args[i]) for i in [0, num_thr), each in its own thread,
+ * and wait for all to return.  args is an array of num_thr elements, each of
+ * size arg_size bytes.
+ * Calls from within start_routine (nested parallelism) create their own
+ * threads rather than using the pool.
+ */
+void thread_pool_run(void *(*start_routine)(void *), void *args,
+                     size_t arg_size, size_t num_thr);
+
+/**
+ * Returns storage for num_thr arguments of arg_size bytes each, to pass to
+ * thread_pool_run() or thread_spawn_run().
+ * The storage belongs to the calling thread and is reused by its next call to
+ * thread_pool_args() at the same nesting level, i.e., it's valid until the
+ * caller gets arguments for another run.  Don't free it.
+ */
+void *thread_pool_args(size_t arg_size, size_t num_thr);
+
+/**
+ * Like thread_pool_run(), but always create and join num_thr threads.
+ */
+void thread_spawn_run(void *(*start_routine)(void *), void *args,
+                      size_t arg_size, size_t num_thr);
+
+/**
+ * Returns the NUMA node of the CPU that thread thr_num is pinned to, or -1 if
+ * threads aren't pinned or the node is unknown.
+ */
+int thread_pool_node(size_t thr_num);
+
+#endif /* THREAD_POOL_H */
@@ -0,0 +1,144 @@
+/**
+ * Tile-contiguous intermediate buffers for multi-pass transposes.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tile-buffer.h"
+
+#define TILE_TRANSPOSE(datatype, src, dst, rows, cols, src_stride, \
+                       dst_stride) { \
+    const datatype* restrict s = (const datatype* restrict)(src); \
+    datatype* restrict d = (datatype* restrict)(dst); \
+    size_t r, c; \
+    for (r = 0; r < (rows); r++) { \
+        for (c = 0; c < (cols); c++) { \
+            d[c * (dst_stride) + r] = s[r * (src_stride) + c]; \
+        } \
+    } \
+}
+
+void tile_transpose_flt(const void* restrict src, void* restrict dst,
+                        size_t rows, size_t cols,
+                        size_t src_stride, size_t dst_stride)
+{
+    TILE_TRANSPOSE(float, src, dst, rows, cols, src_stride, dst_stride);
+}
+
+void tile_transpose_dbl(const void* restrict src, void* restrict dst,
+                        size_t rows, size_t cols,
+                        size_t src_stride, size_t dst_stride)
+{
+    TILE_TRANSPOSE(double, src, dst, rows, cols, src_stride, dst_stride);
+}
+
+void tile_transpose_fcmplx(const void* restrict src, void* restrict dst,
+                           size_t rows, size_t cols,
+                           size_t src_stride, size_t dst_stride)
+{
+    TILE_TRANSPOSE(float complex, src, dst, rows, cols, src_stride,
+                   dst_stride);
+}
+
+void tile_transpose_dcmplx(const void* restrict src, void* restrict dst,
+                           size_t rows, size_t cols,
+                           size_t src_stride, size_t dst_stride)
+{
+    TILE_TRANSPOSE(double complex, src, dst, rows, cols, src_stride,
+                   dst_stride);
+}
+
+size_t tile_buffer_blk_rows(size_t elsize)
+{
+    const size_t blk_rows = TILE_BUFFER_PAGE / (TILE_BUFFER_BLK_COLS * elsize);
+    return blk_rows ? blk_rows : 1;
+}
+
+size_t tile_buffer_size(size_t A_rows, size_t A_cols, size_t elsize)
+{
+    const size_t blk_rows = tile_buffer_blk_rows(elsize);
+    const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows;
+    const size_t n_cblks = (A_cols + TILE_BUFFER_BLK_COLS - 1) /
+                           TILE_BUFFER_BLK_COLS;
+    return n_rblks * n_cblks * blk_rows * TILE_BUFFER_BLK_COLS * elsize;
+}
+
+void tile_buffer_touch(void* restrict T,
+                       size_t A_rows, size_t A_cols, size_t elsize,
+                       size_t rblk_min, size_t rblk_max)
+{
+    const size_t blk_rows = tile_buffer_blk_rows(elsize);
+    const size_t blk_bytes = blk_rows * TILE_BUFFER_BLK_COLS * elsize;
+    const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows;
+    const size_t n_cblks = (A_cols + TILE_BUFFER_BLK_COLS - 1) /
+                           TILE_BUFFER_BLK_COLS;
+    size_t cblk;
+    // the tile rows of each tile column are a contiguous run of pages
+    for (cblk = 0; cblk < n_cblks; cblk++) {
+        memset((char *)T + (cblk * n_rblks + rblk_min) * blk_bytes, 0,
+               (rblk_max - rblk_min) * blk_bytes);
+    }
+}
+
+void tile_buffer_gather(const void* restrict A, void* restrict T,
+                        size_t A_rows, size_t A_cols, size_t elsize,
+                        size_t rblk_min, size_t rblk_max)
+{
+    const size_t blk_rows = tile_buffer_blk_rows(elsize);
+    const size_t blk_bytes = blk_rows * TILE_BUFFER_BLK_COLS * elsize;
+    const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows;
+    const size_t n_cblks = (A_cols + TILE_BUFFER_BLK_COLS - 1) /
+                           TILE_BUFFER_BLK_COLS;
+    size_t rblk, cblk, r, r_min, r_max, c_min, c_max;
+    char *tile;
+    for (rblk = rblk_min; rblk < rblk_max; rblk++) {
+        r_min = rblk * blk_rows;
+        r_max = r_min + blk_rows < A_rows ? r_min + blk_rows : A_rows;
+        for (cblk = 0; cblk < n_cblks; cblk++) {
+            c_min = cblk * TILE_BUFFER_BLK_COLS;
+            c_max = c_min + TILE_BUFFER_BLK_COLS < A_cols ?
+                    c_min + TILE_BUFFER_BLK_COLS : A_cols;
+            tile = (char *)T + (cblk * n_rblks + rblk) * blk_bytes;
+            for (r = r_min; r < r_max; r++) {
+                memcpy(tile + (r - r_min) * TILE_BUFFER_BLK_COLS * elsize,
+                       (const char *)A + (r * A_cols + c_min) * elsize,
+                       (c_max - c_min) * elsize);
+            }
+        }
+    }
+}
+
+void tile_buffer_scatter(const void* restrict T, void* restrict B,
+                         size_t A_rows, size_t A_cols, size_t elsize,
+                         size_t cblk_min, size_t cblk_max,
+                         tile_transpose_fn fn)
+{
+    // the transposed tile, which stays in cache
+    _Alignas(64) char tile_tr[TILE_BUFFER_PAGE];
+    const size_t blk_rows = tile_buffer_blk_rows(elsize);
+    const size_t blk_bytes = blk_rows * TILE_BUFFER_BLK_COLS * elsize;
+    const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows;
+    size_t rblk, cblk, c, r_min, r_max, c_min, c_max;
+    const char *tile;
+    for (cblk = cblk_min; cblk < cblk_max; cblk++) {
+        c_min = cblk * TILE_BUFFER_BLK_COLS;
+        c_max = c_min + TILE_BUFFER_BLK_COLS < A_cols ?
+                c_min + TILE_BUFFER_BLK_COLS : A_cols;
+        for (rblk = 0; rblk < n_rblks; rblk++) {
+            r_min = rblk * blk_rows;
+            r_max = r_min + blk_rows < A_rows ? r_min + blk_rows : A_rows;
+            tile = (const char *)T + (cblk * n_rblks + rblk) * blk_bytes;
+            fn(tile, tile_tr, r_max - r_min, c_max - c_min,
+               TILE_BUFFER_BLK_COLS, blk_rows);
+            for (c = c_min; c < c_max; c++) {
+                memcpy((char *)B + (c * A_rows + r_min) * elsize,
+                       tile_tr + (c - c_min) * blk_rows * elsize,
+                       (r_max - r_min) * elsize);
+            }
+        }
+    }
+}
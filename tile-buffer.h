@@ -0,0 +1,80 @@
+/**
+ * Tile-contiguous intermediate buffers for multi-pass transposes.
+ *
+ * A single-pass transpose writes (or reads) one matrix with a stride of a whole
+ * row, so once a row is larger than a page, every element of a tile row is on
+ * a different page, and TLB misses dominate for very large matrices.
+ * Instead, a multi-pass transpose:
+ * 1. gathers the tiles of A into a buffer where each tile is one contiguous
+ *    page, reading A sequentially, a few rows at a time;
+ * 2. transposes each tile in cache; and
+ * 3. scatters the transposed tiles to B, writing a few rows of B at a time,
+ *    sequentially.
+ * Every pass touches only a few pages at once, at the cost of copying the
+ * matrix twice.
+ *
+ * Tiles have TILE_BUFFER_BLK_COLS columns and as many rows as fill a page.
+ * Tile (rblk, cblk) is at page cblk * n_rblks + rblk of the buffer, so the
+ * tiles that scatter to the same rows of B are adjacent.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TILE_BUFFER_H
+#define TILE_BUFFER_H
+
+#include <stdlib.h>
+
+#define TILE_BUFFER_PAGE 4096
+#define TILE_BUFFER_BLK_COLS 32
+
+/*
+ * Transpose the rows x cols tile at src (with row stride src_stride elements)
+ * into dst (with row stride dst_stride elements).
+ */
+typedef void (*tile_transpose_fn)(const void* restrict src, void* restrict dst,
+                                  size_t rows, size_t cols,
+                                  size_t src_stride, size_t dst_stride);
+
+void tile_transpose_flt(const void* restrict src, void* restrict dst,
+                        size_t rows, size_t cols,
+                        size_t src_stride, size_t dst_stride);
+void tile_transpose_dbl(const void* restrict src, void* restrict dst,
+                        size_t rows, size_t cols,
+                        size_t src_stride, size_t dst_stride);
+void tile_transpose_fcmplx(const void* restrict src, void* restrict dst,
+                           size_t rows, size_t cols,
+                           size_t src_stride, size_t dst_stride);
+void tile_transpose_dcmplx(const void* restrict src, void* restrict dst,
+                           size_t rows, size_t cols,
+                           size_t src_stride, size_t dst_stride);
+
+/* Returns the number of rows in a tile of elements of size elsize */
+size_t tile_buffer_blk_rows(size_t elsize);
+
+/* Returns the size in bytes of a buffer for an A_rows x A_cols matrix */
+size_t tile_buffer_size(size_t A_rows, size_t A_cols, size_t elsize);
+
+/*
+ * First touch the pages of T that tile rows [rblk_min, rblk_max) are gathered
+ * to, so they're placed on the node of the thread that gathers them.
+ */
+void tile_buffer_touch(void* restrict T,
+                       size_t A_rows, size_t A_cols, size_t elsize,
+                       size_t rblk_min, size_t rblk_max);
+
+/* Pass 1: copy the tiles in tile rows [rblk_min, rblk_max) of A to T */
+void tile_buffer_gather(const void* restrict A, void* restrict T,
+                        size_t A_rows, size_t A_cols, size_t elsize,
+                        size_t rblk_min, size_t rblk_max);
+
+/*
+ * Passes 2 and 3: transpose the tiles in tile columns [cblk_min, cblk_max) of
+ * T and write them to B.
+ */
+void tile_buffer_scatter(const void* restrict T, void* restrict B,
+                         size_t A_rows, size_t A_cols, size_t elsize,
+                         size_t cblk_min, size_t cblk_max,
+                         tile_transpose_fn fn);
+
+#endif /* TILE_BUFFER_H */
@@ -0,0 +1,192 @@
+/**
+ * Cache-friendly traversal orders of the tiles of a matrix.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <stdlib.h>
+
+#include "tile-order.h"
+
+void tile_order_recursive(size_t r_min, size_t r_max, size_t c_min,
+                          size_t c_max, size_t base, size_t align,
+                          tile_region_fn fn, void *ctx)
+{
+    const size_t rows = r_max - r_min;
+    const size_t cols = c_max - c_min;
+    size_t half;
+    if (rows <= base && cols <= base) {
+        fn(ctx, r_min, r_max, c_min, c_max);
+    } else if (rows >= cols) {
+        half = rows / 2 / align * align;
+        if (!half) {
+            half = align;
+        }
+        tile_order_recursive(r_min, r_min + half, c_min, c_max,
+                             base, align, fn, ctx);
+        tile_order_recursive(r_min + half, r_max, c_min, c_max,
+                             base, align, fn, ctx);
+    } else {
+        half = cols / 2 / align * align;
+        if (!half) {
+            half = align;
+        }
+        tile_order_recursive(r_min, r_max, c_min, c_min + half,
+                             base, align, fn, ctx);
+        tile_order_recursive(r_min, r_max, c_min + half, c_max,
+                             base, align, fn, ctx);
+    }
+}
+
+size_t tile_order_count(size_t rows, size_t cols, size_t blk)
+{
+    return ((rows + blk - 1) / blk) * ((cols + blk - 1) / blk);
+}
+
+struct tile_grid {
+    size_t rows, cols, blk;
+    size_t first, last;
+    tile_region_fn fn;
+    void *ctx;
+};
+
+// visit the tile at block row rblk and block column cblk, clipped to the matrix
+static void tile_visit(const struct tile_grid *g, size_t rblk, size_t cblk)
+{
+    const size_t r_min = rblk * g->blk;
+    const size_t c_min = cblk * g->blk;
+    const size_t r_max = r_min + g->blk < g->rows ? r_min + g->blk : g->rows;
+    const size_t c_max = c_min + g->blk < g->cols ? c_min + g->blk : g->cols;
+    g->fn(g->ctx, r_min, r_max, c_min, c_max);
+}
+
+/*
+ * Visit the nr x nc tiles starting at block (rblk, cblk), which occupy
+ * positions [pos, pos + nr * nc) along the curve.
+ */
+static void morton(const struct tile_grid *g, size_t rblk, size_t cblk,
+                   size_t nr, size_t nc, size_t pos)
+{
+    size_t half;
+    if (pos >= g->last || pos + nr * nc <= g->first) {
+        return;
+    }
+    if (nr == 1 && nc == 1) {
+        tile_visit(g, rblk, cblk);
+    } else if (nr >= nc) {
+        half = nr / 2;
+        morton(g, rblk, cblk, half, nc, pos);
+        morton(g, rblk + half, cblk, nr - half, nc, pos + half * nc);
+    } else {
+        half = nc / 2;
+        morton(g, rblk, cblk, nr, half, pos);
+        morton(g, rblk, cblk + half, nr, nc - half, pos + nr * half);
+    }
+}
+
+void tile_order_morton(size_t rows, size_t cols, size_t blk,
+                       size_t first, size_t last,
+                       tile_region_fn fn, void *ctx)
+{
+    const struct tile_grid g = { rows, cols, blk, first, last, fn, ctx };
+    if (!rows || !cols) {
+        return;
+    }
+    morton(&g, 0, 0, (rows + blk - 1) / blk, (cols + blk - 1) / blk, 0);
+}
+
+static long sgn(long v)
+{
+    return (v > 0) - (v < 0);
+}
+
+// floor(v / 2), also for negative v
+static long floor_half(long v)
+{
+    return v >= 0 ? v / 2 : -((1 - v) / 2);
+}
+
+static long abs_l(long v)
+{
+    return v < 0 ? -v : v;
+}
+
+/*
+ * Generalized Hilbert curve over the rectangle of tiles spanned by the vectors
+ * (ax, ay) and (bx, by) from tile (x, y), where x is the block column and y the
+ * block row, occupying positions [pos, pos + w * h) along the curve.
+ */
+static void gilbert(const struct tile_grid *g, long x, long y,
+                    long ax, long ay, long bx, long by, size_t pos)
+{
+    const long w = abs_l(ax + ay);
+    const long h = abs_l(bx + by);
+    const long dax = sgn(ax), day = sgn(ay);
+    const long dbx = sgn(bx), dby = sgn(by);
+    long ax2, ay2, bx2, by2, w2, h2, i;
+
+    if (pos >= g->last || pos + (size_t) (w * h) <= g->first) {
+        return;
+    }
+    if (h == 1 || w == 1) {
+        // a single row or column of tiles
+        const long dx = h == 1 ? dax : dbx;
+        const long dy = h == 1 ? day : dby;
+        const long len = h == 1 ? w : h;
+        for (i = 0; i < len; i++, pos++, x += dx, y += dy) {
+            if (pos >= g->first && pos < g->last) {
+                tile_visit(g, (size_t) y, (size_t) x);
+            }
+        }
+        return;
+    }
+
+    ax2 = floor_half(ax);
+    ay2 = floor_half(ay);
+    bx2 = floor_half(bx);
+    by2 = floor_half(by);
+    w2 = abs_l(ax2 + ay2);
+    h2 = abs_l(bx2 + by2);
+
+    if (2 * w > 3 * h) {
+        // long case: split in two along the long side, preferring even steps
+        if ((w2 % 2) && w > 2) {
+            ax2 += dax;
+            ay2 += day;
+            w2 = abs_l(ax2 + ay2);
+        }
+        gilbert(g, x, y, ax2, ay2, bx, by, pos);
+        gilbert(g, x + ax2, y + ay2, ax - ax2, ay - ay2, bx, by,
+                pos + (size_t) (w2 * h));
+    } else {
+        // standard case: one step up, one long horizontal, one step down
+        if ((h2 % 2) && h > 2) {
+            bx2 += dbx;
+            by2 += dby;
+            h2 = abs_l(bx2 + by2);
+        }
+        gilbert(g, x, y, bx2, by2, ax2, ay2, pos);
+        gilbert(g, x + bx2, y + by2, ax, ay, bx - bx2, by - by2,
+                pos + (size_t) (w2 * h2));
+        gilbert(g, x + (ax - dax) + (bx2 - dbx), y + (ay - day) + (by2 - dby),
+                -bx2, -by2, -(ax - ax2), -(ay - ay2),
+                pos + (size_t) (w2 * h2 + w * (h - h2)));
+    }
+}
+
+void tile_order_hilbert(size_t rows, size_t cols, size_t blk,
+                        size_t first, size_t last,
+                        tile_region_fn fn, void *ctx)
+{
+    const struct tile_grid g = { rows, cols, blk, first, last, fn, ctx };
+    const long nr = (long) ((rows + blk - 1) / blk);
+    const long nc = (long) ((cols + blk - 1) / blk);
+    if (!rows || !cols) {
+        return;
+    }
+    if (nc >= nr) {
+        gilbert(&g, 0, 0, nc, 0, 0, nr, 0);
+    } else {
+        gilbert(&g, 0, 0, 0, nr, nc, 0, 0);
+    }
+}
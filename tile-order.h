@@ -0,0 +1,53 @@
+/**
+ * Cache-friendly traversal orders of the tiles of a matrix.
+ *
+ * Each traversal calls a function for every region (tile) of a matrix in
+ * turn, in an order that keeps consecutive tiles close together, so that a
+ * transpose reads and writes memory with good locality at every cache level,
+ * without tuning a block size to the cache.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TILE_ORDER_H
+#define TILE_ORDER_H
+
+#include <stdlib.h>
+
+/* Called for the region in rows [r_min, r_max) and columns [c_min, c_max) */
+typedef void (*tile_region_fn)(void *ctx, size_t r_min, size_t r_max,
+                               size_t c_min, size_t c_max);
+
+/*
+ * Cache-oblivious traversal of rows [r_min, r_max) and columns [c_min, c_max):
+ * recursively halve the longer dimension until the region is at most base x
+ * base.  Split points are rounded to multiples of align, e.g., a SIMD tile
+ * size (r_min and c_min must be multiples of align, and base at least align).
+ */
+void tile_order_recursive(size_t r_min, size_t r_max, size_t c_min,
+                          size_t c_max, size_t base, size_t align,
+                          tile_region_fn fn, void *ctx);
+
+/* Returns the number of blk x blk tiles (including partial edge tiles) */
+size_t tile_order_count(size_t rows, size_t cols, size_t blk);
+
+/*
+ * Traverse the blk x blk tiles of a rows x cols matrix in Z (Morton) order,
+ * generalized to grids of any shape by halving the longer side of the grid.
+ * Only tiles in positions [first, last) along the curve are visited, so that
+ * threads may take contiguous segments of the curve.
+ */
+void tile_order_morton(size_t rows, size_t cols, size_t blk,
+                       size_t first, size_t last,
+                       tile_region_fn fn, void *ctx);
+
+/*
+ * Like tile_order_morton(), but in Hilbert curve order, generalized to grids of
+ * any shape (i.e., the "gilbert" curve), so consecutive tiles are adjacent
+ * (a single diagonal step is unavoidable for some grids with odd sides).
+ */
+void tile_order_hilbert(size_t rows, size_t cols, size_t blk,
+                        size_t first, size_t last,
+                        tile_region_fn fn, void *ctx);
+
+#endif /* TILE_ORDER_H */
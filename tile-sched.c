@@ -0,0 +1,113 @@
+/**
+ * Work-stealing scheduler for the tiles of a matrix.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "tile-sched.h"
+#include "util.h"
+
+/*
+ * A deque holds the range [head, tail) of tile numbers, packed in one word so
+ * that the owner (taking from the head) and thieves (taking from the tail)
+ * both update it with a single compare-and-swap.
+ * Every tile is handed out exactly once, so a range never repeats (no ABA).
+ */
+#define RANGE(head, tail) (((uint_fast64_t)(head) << 32) | (uint_fast64_t)(tail))
+#define RANGE_HEAD(range) ((size_t)((range) >> 32))
+#define RANGE_TAIL(range) ((size_t)((range) & 0xFFFFFFFF))
+
+struct tile_deque {
+    // cache line aligned, so threads don't share lines
+    _Alignas(64) atomic_uint_fast64_t range;
+};
+
+struct tile_sched {
+    struct tile_deque *deques;
+    size_t num_thr;
+};
+
+struct tile_sched *tile_sched_create(size_t n_tiles, size_t num_thr)
+{
+    struct tile_sched *sched;
+    size_t thr_num;
+    if (n_tiles > 0xFFFFFFFF) {
+        fprintf(stderr, "tile_sched_create: too many tiles: %zu\n", n_tiles);
+        exit(EINVAL);
+    }
+    sched = assert_malloc(sizeof(struct tile_sched));
+    sched->deques = assert_malloc_al(num_thr * sizeof(struct tile_deque));
+    sched->num_thr = num_thr;
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        atomic_init(&sched->deques[thr_num].range,
+                    RANGE(thr_num * n_tiles / num_thr,
+                          (thr_num + 1) * n_tiles / num_thr));
+    }
+    return sched;
+}
+
+static int deque_pop(struct tile_deque *dq, size_t *tile)
+{
+    uint_fast64_t range = atomic_load(&dq->range);
+    size_t head;
+    do {
+        head = RANGE_HEAD(range);
+        if (head >= RANGE_TAIL(range)) {
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak(&dq->range, &range,
+                                           RANGE(head + 1, RANGE_TAIL(range))));
+    *tile = head;
+    return 1;
+}
+
+/* Take the back half (rounded up) of the victim's range into [*first, *last) */
+static int deque_steal(struct tile_deque *victim, size_t *first, size_t *last)
+{
+    uint_fast64_t range = atomic_load(&victim->range);
+    size_t head, tail, mid;
+    do {
+        head = RANGE_HEAD(range);
+        tail = RANGE_TAIL(range);
+        if (head >= tail) {
+            return 0;
+        }
+        mid = head + (tail - head) / 2;
+    } while (!atomic_compare_exchange_weak(&victim->range, &range,
+                                           RANGE(head, mid)));
+    *first = mid;
+    *last = tail;
+    return 1;
+}
+
+int tile_sched_next(struct tile_sched *sched, size_t thr_num, size_t *tile)
+{
+    struct tile_deque *dq = &sched->deques[thr_num];
+    size_t i, first, last;
+    if (deque_pop(dq, tile)) {
+        return 1;
+    }
+    for (i = 1; i < sched->num_thr; i++) {
+        if (deque_steal(&sched->deques[(thr_num + i) % sched->num_thr],
+                        &first, &last)) {
+            // our deque is empty, so thieves don't touch it until this store
+            atomic_store(&dq->range, RANGE(first + 1, last));
+            *tile = first;
+            return 1;
+        }
+    }
+    // a tile being stolen is always run by its thief, so we can stop here
+    return 0;
+}
+
+void tile_sched_destroy(struct tile_sched *sched)
+{
+    free(sched->deques);
+    free(sched);
+}
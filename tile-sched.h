@@ -0,0 +1,32 @@
+/**
+ * Work-stealing scheduler for the tiles of a matrix.
+ *
+ * Tiles are numbered [0, n_tiles).  Each thread starts with a contiguous range
+ * of tiles in its own deque and takes tiles from the front of it, one at a
+ * time.  When its deque is empty, a thread steals the back half of a
+ * neighbour's remaining range (trying thread thr_num + 1 first, then the next,
+ * and so on), so that threads that finish early help the others without any
+ * central queue, and tiles stay mostly in contiguous runs per thread.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TILE_SCHED_H
+#define TILE_SCHED_H
+
+#include <stdlib.h>
+
+struct tile_sched;
+
+/* Distribute n_tiles evenly between num_thr deques */
+struct tile_sched *tile_sched_create(size_t n_tiles, size_t num_thr);
+
+/*
+ * Get the next tile for thread thr_num, stealing if its own deque is empty.
+ * Returns 1 and sets *tile, or returns 0 when no work remains anywhere.
+ */
+int tile_sched_next(struct tile_sched *sched, size_t thr_num, size_t *tile);
+
+void tile_sched_destroy(struct tile_sched *sched);
+
+#endif /* TILE_SCHED_H */
@@ -19,60 +19,366 @@
 #include "ptime.h"
 #include "transpose.h"
 #include "transpose-avx.h"
+#include "transpose-avx2.h"
+#include "transpose-dispatch.h"
+#include "transpose-plan.h"
 #include "transpose-threads.h"
 #include "transpose-threads-avx.h"
+#include "transpose-threads-avx2.h"
 #include "util.h"
 
 #if defined(USE_FLT_BLOCKED) || \
     defined(USE_FLT_THRROW_BLOCKED) || \
     defined(USE_FLT_THRCOL_BLOCKED) || \
+    defined(USE_FLT_SQUARE_BLOCKED) || \
+    defined(USE_FLT_THRROW_SQUARE_BLOCKED) || \
     defined(USE_DBL_BLOCKED) || \
     defined(USE_DBL_THRROW_BLOCKED) || \
     defined(USE_DBL_THRCOL_BLOCKED) || \
+    defined(USE_DBL_SQUARE_BLOCKED) || \
+    defined(USE_DBL_THRROW_SQUARE_BLOCKED) || \
     defined(USE_FCMPLX_BLOCKED) || \
     defined(USE_FCMPLX_THRROW_BLOCKED) || \
     defined(USE_FCMPLX_THRCOL_BLOCKED) || \
+    defined(USE_FCMPLX_SQUARE_BLOCKED) || \
+    defined(USE_FCMPLX_THRROW_SQUARE_BLOCKED) || \
     defined(USE_DCMPLX_BLOCKED) || \
     defined(USE_DCMPLX_THRROW_BLOCKED) || \
     defined(USE_DCMPLX_THRCOL_BLOCKED) || \
+    defined(USE_DCMPLX_SQUARE_BLOCKED) || \
+    defined(USE_DCMPLX_THRROW_SQUARE_BLOCKED) || \
     defined(USE_FFTWF_BLOCKED) || \
     defined(USE_FFTWF_THRROW_BLOCKED) || \
     defined(USE_FFTWF_THRCOL_BLOCKED) || \
+    defined(USE_FFTWF_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
     defined(USE_FFTW_BLOCKED) || \
     defined(USE_FFTW_THRROW_BLOCKED) || \
-    defined(USE_FFTW_THRCOL_BLOCKED)
+    defined(USE_FFTW_THRCOL_BLOCKED) || \
+    defined(USE_FFTW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FCMPLX_BLOCKED_EPI) || \
+    defined(USE_DCMPLX_BLOCKED_EPI) || \
+    defined(USE_FFTWF_BLOCKED_EPI) || \
+    defined(USE_FFTW_BLOCKED_EPI)
 #define _USE_TRANSP_BLOCKED 1
 #endif
 
 #if defined(USE_FLT_THRROW) || \
     defined(USE_FLT_THRCOL) || \
+    defined(USE_FLT_THRREC) || \
+    defined(USE_FLT_THRBATCH) || \
+    defined(USE_FLT_THRBATCH_AVX512_INTR) || \
+    defined(USE_FLT_THRMORTON) || \
+    defined(USE_FLT_THRHILBERT) || \
+    defined(USE_FLT_THRTILE) || \
+    defined(USE_FLT_THRNUMA) || \
+    defined(USE_FLT_THRTLB) || \
+    defined(USE_FLT_PLAN) || \
     defined(USE_FLT_THRROW_BLOCKED) || \
     defined(USE_FLT_THRCOL_BLOCKED) || \
+    defined(USE_FLT_THRROW_SQUARE) || \
+    defined(USE_FLT_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FLT_THRCYC_INPLACE) || \
+    defined(USE_FLT_THRROW_AVX2_INTR) || \
+    defined(USE_FLT_THRCOL_AVX2_INTR) || \
+    defined(USE_FLT_THRROW_AVX512_INTR) || \
+    defined(USE_FLT_THRCOL_AVX512_INTR) || \
     defined(USE_DBL_THRROW) || \
     defined(USE_DBL_THRCOL) || \
+    defined(USE_DBL_THRREC) || \
+    defined(USE_DBL_THRBATCH) || \
+    defined(USE_DBL_THRBATCH_AVX512_INTR) || \
+    defined(USE_DBL_THRMORTON) || \
+    defined(USE_DBL_THRHILBERT) || \
+    defined(USE_DBL_THRTILE) || \
+    defined(USE_DBL_THRNUMA) || \
+    defined(USE_DBL_THRTLB) || \
+    defined(USE_DBL_PLAN) || \
     defined(USE_DBL_THRROW_BLOCKED) || \
     defined(USE_DBL_THRCOL_BLOCKED) || \
     defined(USE_DBL_THRROW_AVX512_INTR) || \
     defined(USE_DBL_THRCOL_AVX512_INTR) || \
+    defined(USE_DBL_THRROW_SQUARE) || \
+    defined(USE_DBL_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_DBL_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_DBL_THRCYC_INPLACE) || \
+    defined(USE_DBL_THRROW_AVX2_INTR) || \
+    defined(USE_DBL_THRCOL_AVX2_INTR) || \
     defined(USE_FCMPLX_THRROW) || \
     defined(USE_FCMPLX_THRCOL) || \
+    defined(USE_FCMPLX_THRREC) || \
+    defined(USE_FCMPLX_THRBATCH) || \
+    defined(USE_FCMPLX_THRMORTON) || \
+    defined(USE_FCMPLX_THRHILBERT) || \
+    defined(USE_FCMPLX_THRTILE) || \
+    defined(USE_FCMPLX_THRNUMA) || \
+    defined(USE_FCMPLX_THRTLB) || \
+    defined(USE_FCMPLX_PLAN) || \
     defined(USE_FCMPLX_THRROW_BLOCKED) || \
     defined(USE_FCMPLX_THRCOL_BLOCKED) || \
+    defined(USE_FCMPLX_THRROW_SQUARE) || \
+    defined(USE_FCMPLX_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FCMPLX_THRCYC_INPLACE) || \
+    defined(USE_FCMPLX_THRROW_AVX2_INTR) || \
+    defined(USE_FCMPLX_THRCOL_AVX2_INTR) || \
     defined(USE_DCMPLX_THRROW) || \
     defined(USE_DCMPLX_THRCOL) || \
+    defined(USE_DCMPLX_THRREC) || \
+    defined(USE_DCMPLX_THRBATCH) || \
+    defined(USE_DCMPLX_THRBATCH_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRMORTON) || \
+    defined(USE_DCMPLX_THRHILBERT) || \
+    defined(USE_DCMPLX_THRTILE) || \
+    defined(USE_DCMPLX_THRNUMA) || \
+    defined(USE_DCMPLX_THRTLB) || \
+    defined(USE_DCMPLX_PLAN) || \
     defined(USE_DCMPLX_THRROW_BLOCKED) || \
     defined(USE_DCMPLX_THRCOL_BLOCKED) || \
+    defined(USE_DCMPLX_THRROW_SQUARE) || \
+    defined(USE_DCMPLX_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_DCMPLX_THRCYC_INPLACE) || \
+    defined(USE_DCMPLX_THRROW_AVX2_INTR) || \
+    defined(USE_DCMPLX_THRCOL_AVX2_INTR) || \
+    defined(USE_DCMPLX_THRROW_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRCOL_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRROW_SQUARE_AVX512_INTR) || \
     defined(USE_FFTWF_THRROW) || \
     defined(USE_FFTWF_THRCOL) || \
+    defined(USE_FFTWF_THRREC) || \
+    defined(USE_FFTWF_THRBATCH) || \
+    defined(USE_FFTWF_THRBATCH_AVX512_INTR) || \
+    defined(USE_FFTWF_THRMORTON) || \
+    defined(USE_FFTWF_THRHILBERT) || \
+    defined(USE_FFTWF_THRTILE) || \
+    defined(USE_FFTWF_THRNUMA) || \
+    defined(USE_FFTWF_THRTLB) || \
+    defined(USE_FFTWF_PLAN) || \
     defined(USE_FFTWF_THRROW_BLOCKED) || \
     defined(USE_FFTWF_THRCOL_BLOCKED) || \
     defined(USE_FFTWF_THRROW_AVX512_INTR) || \
     defined(USE_FFTWF_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_SQUARE) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_THRCYC_INPLACE) || \
+    defined(USE_FFTWF_THRROW_AVX2_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX2_INTR) || \
     defined(USE_FFTW_THRROW) || \
     defined(USE_FFTW_THRCOL) || \
+    defined(USE_FFTW_THRREC) || \
+    defined(USE_FFTW_THRBATCH) || \
+    defined(USE_FFTW_THRBATCH_AVX512_INTR) || \
+    defined(USE_FFTW_THRMORTON) || \
+    defined(USE_FFTW_THRHILBERT) || \
+    defined(USE_FFTW_THRTILE) || \
+    defined(USE_FFTW_THRNUMA) || \
+    defined(USE_FFTW_THRTLB) || \
+    defined(USE_FFTW_PLAN) || \
     defined(USE_FFTW_THRROW_BLOCKED) || \
-    defined(USE_FFTW_THRCOL_BLOCKED)
+    defined(USE_FFTW_THRCOL_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRCYC_INPLACE) || \
+    defined(USE_FFTW_THRROW_AVX2_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FCMPLX_THRROW_EPI) || \
+    defined(USE_FCMPLX_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_DCMPLX_THRROW_EPI) || \
+    defined(USE_DCMPLX_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_THRROW_EPI) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_THRROW_EPI) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR_EPI)
 #define _USE_TRANSP_THREADS 1
+#include "numa-util.h"
+#endif
+
+#if defined(USE_FLT_SQUARE_NAIVE) || \
+    defined(USE_FLT_SQUARE_BLOCKED) || \
+    defined(USE_FLT_THRROW_SQUARE) || \
+    defined(USE_FLT_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_DBL_SQUARE_NAIVE) || \
+    defined(USE_DBL_SQUARE_BLOCKED) || \
+    defined(USE_DBL_THRROW_SQUARE) || \
+    defined(USE_DBL_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_DBL_SQUARE_AVX512_INTR) || \
+    defined(USE_DBL_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FCMPLX_SQUARE_NAIVE) || \
+    defined(USE_FCMPLX_SQUARE_BLOCKED) || \
+    defined(USE_FCMPLX_THRROW_SQUARE) || \
+    defined(USE_FCMPLX_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_DCMPLX_SQUARE_NAIVE) || \
+    defined(USE_DCMPLX_SQUARE_BLOCKED) || \
+    defined(USE_DCMPLX_THRROW_SQUARE) || \
+    defined(USE_DCMPLX_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_DCMPLX_SQUARE_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_SQUARE_NAIVE) || \
+    defined(USE_FFTWF_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_SQUARE_NAIVE) || \
+    defined(USE_FFTW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR)
+#define _USE_TRANSP_SQUARE 1
+#endif
+
+#if defined(USE_FLT_DISPATCH) || \
+    defined(USE_DBL_DISPATCH) || \
+    defined(USE_FCMPLX_DISPATCH) || \
+    defined(USE_DCMPLX_DISPATCH) || \
+    defined(USE_FFTWF_DISPATCH) || \
+    defined(USE_FFTW_DISPATCH)
+#define _USE_TRANSP_DISPATCH 1
+#endif
+
+#if defined(USE_FLT_PLAN) || \
+    defined(USE_DBL_PLAN) || \
+    defined(USE_FCMPLX_PLAN) || \
+    defined(USE_DCMPLX_PLAN) || \
+    defined(USE_FFTWF_PLAN) || \
+    defined(USE_FFTW_PLAN)
+#define _USE_TRANSP_PLAN 1
+#endif
+
+#if defined(USE_FFTWF_GURU) || defined(USE_FFTWF_GURU_INPLACE)
+#define _USE_TRANSP_GURU 1
+#define GURU_PLAN_T fftwf_plan
+#define PLAN_FLAGS plan_flags_fftwf
+#elif defined(USE_FFTW_GURU) || defined(USE_FFTW_GURU_INPLACE)
+#define _USE_TRANSP_GURU 1
+#define GURU_PLAN_T fftw_plan
+#define PLAN_FLAGS plan_flags_fftw
+#endif
+
+#if defined(USE_FLT_BATCH) || \
+    defined(USE_FLT_THRBATCH) || \
+    defined(USE_FLT_BATCH_AVX512_INTR) || \
+    defined(USE_FLT_THRBATCH_AVX512_INTR) || \
+    defined(USE_DBL_BATCH) || \
+    defined(USE_DBL_THRBATCH) || \
+    defined(USE_DBL_BATCH_AVX512_INTR) || \
+    defined(USE_DBL_THRBATCH_AVX512_INTR) || \
+    defined(USE_FCMPLX_BATCH) || \
+    defined(USE_FCMPLX_THRBATCH) || \
+    defined(USE_DCMPLX_BATCH) || \
+    defined(USE_DCMPLX_THRBATCH) || \
+    defined(USE_DCMPLX_BATCH_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRBATCH_AVX512_INTR) || \
+    defined(USE_FFTWF_BATCH) || \
+    defined(USE_FFTWF_THRBATCH) || \
+    defined(USE_FFTWF_BATCH_AVX512_INTR) || \
+    defined(USE_FFTWF_THRBATCH_AVX512_INTR) || \
+    defined(USE_FFTW_BATCH) || \
+    defined(USE_FFTW_THRBATCH) || \
+    defined(USE_FFTW_BATCH_AVX512_INTR) || \
+    defined(USE_FFTW_THRBATCH_AVX512_INTR)
+#define _USE_TRANSP_BATCH 1
+#endif
+
+#if defined(USE_FCMPLX_NAIVE_EPI) || \
+    defined(USE_FCMPLX_BLOCKED_EPI) || \
+    defined(USE_FCMPLX_THRROW_EPI) || \
+    defined(USE_FCMPLX_AVX512_INTR_EPI) || \
+    defined(USE_FCMPLX_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_DCMPLX_NAIVE_EPI) || \
+    defined(USE_DCMPLX_BLOCKED_EPI) || \
+    defined(USE_DCMPLX_THRROW_EPI) || \
+    defined(USE_DCMPLX_AVX512_INTR_EPI) || \
+    defined(USE_DCMPLX_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_NAIVE_EPI) || \
+    defined(USE_FFTWF_BLOCKED_EPI) || \
+    defined(USE_FFTWF_THRROW_EPI) || \
+    defined(USE_FFTWF_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_NAIVE_EPI) || \
+    defined(USE_FFTW_BLOCKED_EPI) || \
+    defined(USE_FFTW_THRROW_EPI) || \
+    defined(USE_FFTW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR_EPI)
+#define _USE_TRANSP_EPI 1
+#endif
+
+#if defined(USE_FLT_NAIVE) || \
+    defined(USE_FLT_BLOCKED) || \
+    defined(USE_FLT_THRROW) || \
+    defined(USE_FLT_THRCOL) || \
+    defined(USE_FLT_THRROW_BLOCKED) || \
+    defined(USE_FLT_THRCOL_BLOCKED) || \
+    defined(USE_FLT_AVX512_INTR) || \
+    defined(USE_FLT_THRROW_AVX512_INTR) || \
+    defined(USE_FLT_THRCOL_AVX512_INTR) || \
+    defined(USE_FLT_AVX2_INTR) || \
+    defined(USE_FLT_THRROW_AVX2_INTR) || \
+    defined(USE_FLT_THRCOL_AVX2_INTR) || \
+    defined(USE_DBL_NAIVE) || \
+    defined(USE_DBL_BLOCKED) || \
+    defined(USE_DBL_THRROW) || \
+    defined(USE_DBL_THRCOL) || \
+    defined(USE_DBL_THRROW_BLOCKED) || \
+    defined(USE_DBL_THRCOL_BLOCKED) || \
+    defined(USE_DBL_AVX512_INTR) || \
+    defined(USE_DBL_THRROW_AVX512_INTR) || \
+    defined(USE_DBL_THRCOL_AVX512_INTR) || \
+    defined(USE_DBL_AVX2_INTR) || \
+    defined(USE_DBL_THRROW_AVX2_INTR) || \
+    defined(USE_DBL_THRCOL_AVX2_INTR) || \
+    defined(USE_FCMPLX_NAIVE) || \
+    defined(USE_FCMPLX_BLOCKED) || \
+    defined(USE_FCMPLX_THRROW) || \
+    defined(USE_FCMPLX_THRCOL) || \
+    defined(USE_FCMPLX_THRROW_BLOCKED) || \
+    defined(USE_FCMPLX_THRCOL_BLOCKED) || \
+    defined(USE_FCMPLX_AVX2_INTR) || \
+    defined(USE_FCMPLX_THRROW_AVX2_INTR) || \
+    defined(USE_FCMPLX_THRCOL_AVX2_INTR) || \
+    defined(USE_DCMPLX_NAIVE) || \
+    defined(USE_DCMPLX_BLOCKED) || \
+    defined(USE_DCMPLX_THRROW) || \
+    defined(USE_DCMPLX_THRCOL) || \
+    defined(USE_DCMPLX_THRROW_BLOCKED) || \
+    defined(USE_DCMPLX_THRCOL_BLOCKED) || \
+    defined(USE_DCMPLX_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRROW_AVX512_INTR) || \
+    defined(USE_DCMPLX_THRCOL_AVX512_INTR) || \
+    defined(USE_DCMPLX_AVX2_INTR) || \
+    defined(USE_DCMPLX_THRROW_AVX2_INTR) || \
+    defined(USE_DCMPLX_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTWF_NAIVE) || \
+    defined(USE_FFTWF_BLOCKED) || \
+    defined(USE_FFTWF_THRROW) || \
+    defined(USE_FFTWF_THRCOL) || \
+    defined(USE_FFTWF_THRROW_BLOCKED) || \
+    defined(USE_FFTWF_THRCOL_BLOCKED) || \
+    defined(USE_FFTWF_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTWF_AVX2_INTR) || \
+    defined(USE_FFTWF_THRROW_AVX2_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTW_NAIVE) || \
+    defined(USE_FFTW_BLOCKED) || \
+    defined(USE_FFTW_THRROW) || \
+    defined(USE_FFTW_THRCOL) || \
+    defined(USE_FFTW_THRROW_BLOCKED) || \
+    defined(USE_FFTW_THRCOL_BLOCKED) || \
+    defined(USE_FFTW_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTW_AVX2_INTR) || \
+    defined(USE_FFTW_THRROW_AVX2_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX2_INTR) || \
+    defined(_USE_TRANSP_EPI)
+#define _USE_TRANSP_LD 1
 #endif
 
 #if defined(USE_FFTWF_NAIVE) || \
@@ -84,13 +390,53 @@
     defined(USE_FFTWF_AVX512_INTR) || \
     defined(USE_FFTWF_THRROW_AVX512_INTR) || \
     defined(USE_FFTWF_THRCOL_AVX512_INTR) || \
-    defined(USE_FFTWF_MKL)
+    defined(USE_FFTWF_SQUARE_NAIVE) || \
+    defined(USE_FFTWF_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_THRROW_SQUARE) || \
+    defined(USE_FFTWF_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTWF_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTWF_INPLACE) || \
+    defined(USE_FFTWF_THRCYC_INPLACE) || \
+    defined(USE_FFTWF_AVX2_INTR) || \
+    defined(USE_FFTWF_THRROW_AVX2_INTR) || \
+    defined(USE_FFTWF_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTWF_DISPATCH) || \
+    defined(USE_FFTWF_RECURSIVE) || \
+    defined(USE_FFTWF_MORTON) || \
+    defined(USE_FFTWF_HILBERT) || \
+    defined(USE_FFTWF_TLB) || \
+    defined(USE_FFTWF_THRREC) || \
+    defined(USE_FFTWF_BATCH) || \
+    defined(USE_FFTWF_THRBATCH) || \
+    defined(USE_FFTWF_BATCH_AVX512_INTR) || \
+    defined(USE_FFTWF_THRBATCH_AVX512_INTR) || \
+    defined(USE_FFTWF_THRMORTON) || \
+    defined(USE_FFTWF_THRHILBERT) || \
+    defined(USE_FFTWF_THRTILE) || \
+    defined(USE_FFTWF_THRNUMA) || \
+    defined(USE_FFTWF_THRTLB) || \
+    defined(USE_FFTWF_RECURSIVE_AVX512_INTR) || \
+    defined(USE_FFTWF_PLAN) || \
+    defined(USE_FFTWF_NAIVE_EPI) || \
+    defined(USE_FFTWF_BLOCKED_EPI) || \
+    defined(USE_FFTWF_THRROW_EPI) || \
+    defined(USE_FFTWF_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTWF_MKL) || \
+    defined(USE_FFTWF_GURU) || \
+    defined(USE_FFTWF_GURU_INPLACE)
 #include <fftw3.h>
 #include "transpose-fftwf.h"
 #include "transpose-fftwf-avx.h"
+#include "transpose-fftwf-avx2.h"
+#include "transpose-fftwf-dispatch.h"
+#include "transpose-fftwf-guru.h"
 #include "transpose-fftwf-mkl.h"
+#include "transpose-fftwf-plan.h"
 #include "transpose-fftwf-threads.h"
 #include "transpose-fftwf-threads-avx.h"
+#include "transpose-fftwf-threads-avx2.h"
 #include "util-fftwf.h"
 #endif
 #if defined(USE_FFTW_NAIVE) || \
@@ -99,11 +445,56 @@
     defined(USE_FFTW_THRCOL) || \
     defined(USE_FFTW_THRROW_BLOCKED) || \
     defined(USE_FFTW_THRCOL_BLOCKED) || \
-    defined(USE_FFTW_MKL)
+    defined(USE_FFTW_SQUARE_NAIVE) || \
+    defined(USE_FFTW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_THRROW_SQUARE) || \
+    defined(USE_FFTW_THRROW_SQUARE_BLOCKED) || \
+    defined(USE_FFTW_INPLACE) || \
+    defined(USE_FFTW_THRCYC_INPLACE) || \
+    defined(USE_FFTW_AVX2_INTR) || \
+    defined(USE_FFTW_THRROW_AVX2_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX2_INTR) || \
+    defined(USE_FFTW_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR) || \
+    defined(USE_FFTW_THRCOL_AVX512_INTR) || \
+    defined(USE_FFTW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR) || \
+    defined(USE_FFTW_DISPATCH) || \
+    defined(USE_FFTW_RECURSIVE) || \
+    defined(USE_FFTW_MORTON) || \
+    defined(USE_FFTW_HILBERT) || \
+    defined(USE_FFTW_TLB) || \
+    defined(USE_FFTW_THRREC) || \
+    defined(USE_FFTW_BATCH) || \
+    defined(USE_FFTW_THRBATCH) || \
+    defined(USE_FFTW_BATCH_AVX512_INTR) || \
+    defined(USE_FFTW_THRBATCH_AVX512_INTR) || \
+    defined(USE_FFTW_THRMORTON) || \
+    defined(USE_FFTW_THRHILBERT) || \
+    defined(USE_FFTW_THRTILE) || \
+    defined(USE_FFTW_THRNUMA) || \
+    defined(USE_FFTW_THRTLB) || \
+    defined(USE_FFTW_RECURSIVE_AVX512_INTR) || \
+    defined(USE_FFTW_PLAN) || \
+    defined(USE_FFTW_NAIVE_EPI) || \
+    defined(USE_FFTW_BLOCKED_EPI) || \
+    defined(USE_FFTW_THRROW_EPI) || \
+    defined(USE_FFTW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_THRROW_AVX512_INTR_EPI) || \
+    defined(USE_FFTW_MKL) || \
+    defined(USE_FFTW_GURU) || \
+    defined(USE_FFTW_GURU_INPLACE)
 #include <fftw3.h>
 #include "transpose-fftw.h"
+#include "transpose-fftw-avx.h"
+#include "transpose-fftw-avx2.h"
+#include "transpose-fftw-dispatch.h"
+#include "transpose-fftw-guru.h"
 #include "transpose-fftw-mkl.h"
+#include "transpose-fftw-plan.h"
 #include "transpose-fftw-threads.h"
+#include "transpose-fftw-threads-avx.h"
+#include "transpose-fftw-threads-avx2.h"
 #include "util-fftw.h"
 #endif
 
@@ -126,33 +517,162 @@ static size_t nblkcols = 0;
 
 #if defined(_USE_TRANSP_THREADS)
 static size_t nthreads = 1;
+static bool do_numa = false;
+#endif
+
+#if defined(_USE_TRANSP_EPI)
+// applied to each element as it's written to B
+static transpose_epilogue epi = { 1, 0, 0, 0, NULL };
+static bool do_fftshift = false;
+#endif
+
+#if defined(_USE_TRANSP_BATCH)
+// the number of matrices, stored back to back
+static size_t batch = 1;
+#endif
+
+#if defined(_USE_TRANSP_PLAN)
+static transpose_plan_mode plan_mode = TRANSPOSE_PLAN_ESTIMATE;
+static const char *wisdom_file = NULL;
+#elif defined(_USE_TRANSP_GURU)
+static unsigned plan_flags = FFTW_ESTIMATE;
+static const char *wisdom_file = NULL;
+#endif
+
+// leading dimensions (row strides) of A and B, or 0 to choose
+static size_t lda = 0;
+static size_t ldb = 0;
+// the transpose is of a window of a larger frame, at this row and column
+static size_t row_off = 0;
+static size_t col_off = 0;
+#if defined(_USE_TRANSP_LD)
+static bool do_pad = false;
 #endif
 
 static bool do_print = false;
 static bool do_verify = false;
 static bool do_init = false;
+static bool do_huge = false;
 static int rc = 0;
 
 #define PRINT_ELAPSED_TIME(prefix, t1, t2) \
     printf("%s (ms): %f\n", prefix, ptime_elapsed_ns(t1, t2) / 1000000.0);
 
+static void print_page_size(const char *name, const void *ptr)
+{
+    printf("%s-page-size (KiB): %zu\n", name, alloc_page_size(ptr) / 1024);
+}
+
+static void ld_init(size_t elsize)
+{
+#if defined(_USE_TRANSP_LD)
+    if (!lda) {
+        lda = do_pad ? ld_padded(col_off + ncols, elsize) : col_off + ncols;
+    }
+    if (!ldb) {
+        ldb = do_pad ? ld_padded(row_off + nrows, elsize) : row_off + nrows;
+    }
+    if (row_off || col_off) {
+        printf("row-offset: %zu\n", row_off);
+        printf("col-offset: %zu\n", col_off);
+    }
+    if (lda != ncols || ldb != nrows) {
+        printf("lda: %zu\n", lda);
+        printf("ldb: %zu\n", ldb);
+    }
+#else
+    (void) elsize;
+    lda = col_off + ncols;
+    ldb = row_off + nrows;
+#endif
+}
+
+#if defined(_USE_TRANSP_EPI)
+// B's elements are scaled, conjugated, and shifted copies of A's
+#define VERIFY_TRANSPOSE(A, B, fn_is_eq) { \
+    size_t r, c, br, bc; \
+    double complex x; \
+    for (r = 0; r < nrows && !rc; r++) { \
+        for (c = 0; c < ncols && !rc; c++) { \
+            x = A[r * lda + c]; \
+            x = (epi.conj ? conj(x) : x) * epi.scale; \
+            br = (c + epi.row_shift) % ncols; \
+            bc = (r + epi.col_shift) % nrows; \
+            rc = !fn_is_eq(x, B[br * ldb + bc]); \
+        } \
+    } \
+}
+#else
 #define VERIFY_TRANSPOSE(A, B, fn_is_eq) { \
     size_t r, c; \
     for (r = 0; r < nrows && !rc; r++) { \
         for (c = 0; c < ncols && !rc; c++) { \
-            rc = !fn_is_eq(A[r * ncols + c], B[c * nrows + r]); \
+            rc = !fn_is_eq(A[r * lda + c], B[c * ldb + r]); \
         } \
     } \
 }
+#endif
 
-#define TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print) \
-    datatype *A = fn_malloc(nrows * ncols * sizeof(datatype)); \
-    datatype *B = fn_malloc(nrows * ncols * sizeof(datatype)); \
+#if defined(_USE_TRANSP_THREADS)
+// place each thread's partition of the matrices on the thread's NUMA node
+#define TRANSP_FIRST_TOUCH(A, B, A_size, B_size) { \
     ptime_gettime_monotonic(&t1); \
-    fn_fill(A, nrows * ncols); \
+    numa_first_touch(A, A_size, nthreads); \
+    if (B) { \
+        numa_first_touch(B, B_size, nthreads); \
+    } \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("first-touch", &t1, &t2); \
+}
+
+#define TRANSP_NUMA_REPORT(A, B, A_size, B_size) \
+    if (do_numa) { \
+        numa_print_locality("A", A, A_size, nthreads); \
+        if (B) { \
+            numa_print_locality("B", B, B_size, nthreads); \
+        } \
+    }
+#else
+#define TRANSP_FIRST_TOUCH(A, B, A_size, B_size)
+#define TRANSP_NUMA_REPORT(A, B, A_size, B_size)
+#endif
+
+#define TRANSP_PAGE_REPORT(A, B) \
+    if (do_huge) { \
+        print_page_size("A", A); \
+        if (B) { \
+            print_page_size("B", B); \
+        } \
+    }
+
+// print a matrix row by row, skipping the padding at the end of each row
+#define MATRIX_PRINT_LD(A, rows, cols, ld, fn_mat_print) { \
+    size_t r; \
+    for (r = 0; r < rows; r++) { \
+        fn_mat_print(&A[r * ld], 1, cols); \
+    } \
+}
+
+// A and B are windows of the frames A_frame and B_frame, which are the same
+// matrices unless offsets are given; frame lengths are rounded up to a multiple
+// of 64 elements, so their sizes suit the aligned allocator
+#define TRANSP_ALLOC(datatype, fn_malloc) \
+    ld_init(sizeof(datatype)); \
+    const size_t A_len = ((row_off + nrows) * lda + 63) / 64 * 64; \
+    const size_t B_len = ((col_off + ncols) * ldb + 63) / 64 * 64; \
+    datatype *A_frame = fn_malloc(A_len * sizeof(datatype)); \
+    datatype *B_frame = fn_malloc(B_len * sizeof(datatype)); \
+    datatype *A = &A_frame[row_off * lda + col_off]; \
+    datatype *B = &B_frame[col_off * ldb + row_off]; \
+    TRANSP_FIRST_TOUCH(A_frame, B_frame, A_len * sizeof(datatype), \
+                       B_len * sizeof(datatype));
+
+#define TRANSP_FILL(datatype, fn_fill, fn_mat_print) \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A_frame, A_len); \
     if (do_init) { \
         ptime_gettime_monotonic(&t1); \
-        memset(B, 0, nrows * ncols * sizeof(datatype)); \
+        memset(B_frame, 0, B_len * sizeof(datatype)); \
         ptime_gettime_monotonic(&t2); \
         PRINT_ELAPSED_TIME("init", &t1, &t2); \
     } \
@@ -161,18 +681,22 @@ static int rc = 0;
     if (do_print) { \
         ptime_gettime_monotonic(&t1); \
         printf("In:\n"); \
-        fn_mat_print(A, nrows, ncols); \
+        MATRIX_PRINT_LD(A, nrows, ncols, lda, fn_mat_print); \
         ptime_gettime_monotonic(&t2); \
         PRINT_ELAPSED_TIME("print", &t1, &t2); \
     } \
     ptime_gettime_monotonic(&t1);
 
+#define TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print) \
+    TRANSP_ALLOC(datatype, fn_malloc); \
+    TRANSP_FILL(datatype, fn_fill, fn_mat_print);
+
 #define TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free) \
     ptime_gettime_monotonic(&t2); \
     PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
     if (do_print) { \
         printf("Out:\n"); \
-        fn_mat_print(B, ncols, nrows); \
+        MATRIX_PRINT_LD(B, ncols, nrows, ldb, fn_mat_print); \
     } \
     if (do_verify) { \
         ptime_gettime_monotonic(&t1); \
@@ -180,8 +704,11 @@ static int rc = 0;
         ptime_gettime_monotonic(&t2); \
         PRINT_ELAPSED_TIME("verify", &t1, &t2); \
     } \
-    fn_free(B); \
-    fn_free(A);
+    TRANSP_NUMA_REPORT(A_frame, B_frame, A_len * sizeof(*A), \
+                       B_len * sizeof(*B)); \
+    TRANSP_PAGE_REPORT(A_frame, B_frame); \
+    fn_free(B_frame); \
+    fn_free(A_frame);
 
 #define TRANSP(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, fn_transp, \
                fn_is_eq) { \
@@ -204,6 +731,42 @@ static int rc = 0;
     TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
 }
 
+// the scratch matrix is allocated and placed before the timed transpose
+#define TRANSP_THREADED_NUMA(datatype, fn_malloc, fn_free, fn_fill, \
+                             fn_mat_print, fn_transp, fn_is_eq) { \
+    ptime_gettime_monotonic(&t1); \
+    transpose_thrnuma_reserve(nrows, ncols, sizeof(datatype), nthreads); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("scratch", &t1, &t2); \
+    TRANSP_THREADED(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                    fn_transp, fn_is_eq); \
+    transpose_thrnuma_release(); \
+}
+
+// the tile buffer is allocated and faulted in before the timed transpose
+#define TRANSP_TLB(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                   fn_transp, fn_is_eq) { \
+    ptime_gettime_monotonic(&t1); \
+    transpose_tlb_reserve(nrows, ncols, sizeof(datatype)); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("scratch", &t1, &t2); \
+    TRANSP(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, fn_transp, \
+           fn_is_eq); \
+    transpose_tlb_release(); \
+}
+
+// the tile buffer is allocated and first touched before the timed transpose
+#define TRANSP_THREADED_TLB(datatype, fn_malloc, fn_free, fn_fill, \
+                            fn_mat_print, fn_transp, fn_is_eq) { \
+    ptime_gettime_monotonic(&t1); \
+    transpose_thrtlb_reserve(nrows, ncols, sizeof(datatype), nthreads); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("scratch", &t1, &t2); \
+    TRANSP_THREADED(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                    fn_transp, fn_is_eq); \
+    transpose_thrtlb_release(); \
+}
+
 #define TRANSP_THREADED_BLOCKED(datatype, fn_malloc, fn_free, fn_fill, \
                                 fn_mat_print, fn_transp, fn_is_eq) { \
     TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
@@ -211,6 +774,306 @@ static int rc = 0;
     TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
 }
 
+#define TRANSP_LD(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                  fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_BLOCKED_LD(datatype, fn_malloc, fn_free, fn_fill, \
+                          fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb, nblkrows, nblkcols); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_THREADED_LD(datatype, fn_malloc, fn_free, fn_fill, \
+                           fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb, nthreads); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_THREADED_BLOCKED_LD(datatype, fn_malloc, fn_free, fn_fill, \
+                                   fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb, nthreads, nblkrows, nblkcols); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_EPI(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                   fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb, &epi); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_BLOCKED_EPI(datatype, fn_malloc, fn_free, fn_fill, \
+                           fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb, nblkrows, nblkcols, &epi); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_THREADED_EPI(datatype, fn_malloc, fn_free, fn_fill, \
+                            fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, lda, ldb, nthreads, &epi); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_PLANNED(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                       fn_plan, fn_execute, fn_is_eq) { \
+    transpose_plan *plan; \
+    char plan_desc[64]; \
+    wisdom_import(); \
+    ptime_gettime_monotonic(&t1); \
+    plan = fn_plan(nrows, ncols, nthreads, plan_mode); \
+    ptime_gettime_monotonic(&t2); \
+    if (!plan) { \
+        perror("transpose_plan"); \
+        exit(errno); \
+    } \
+    PRINT_ELAPSED_TIME("plan", &t1, &t2); \
+    transpose_plan_describe(plan, plan_desc, sizeof(plan_desc)); \
+    printf("plan: %s\n", plan_desc); \
+    TRANSP_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_execute(plan, A, B); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    transpose_plan_destroy(plan); \
+    wisdom_export(); \
+}
+
+// lengths are rounded up to a multiple of 64 elements, so sizes suit the
+// aligned allocator for any matrix shape
+#define TRANSP_INPLACE_ALLOC(datatype, fn_malloc) \
+    const size_t len = (nrows * ncols + 63) / 64 * 64; \
+    datatype *A = fn_malloc(len * sizeof(datatype)); \
+    datatype *B = NULL; \
+    ld_init(sizeof(datatype)); \
+    TRANSP_FIRST_TOUCH(A, B, len * sizeof(datatype), 0);
+
+#define TRANSP_INPLACE_FILL(datatype, fn_malloc, fn_fill, fn_mat_print) \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A, len); \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("fill", &t1, &t2); \
+    if (do_verify) { \
+        /* keep a copy of the input to verify against */ \
+        B = fn_malloc(len * sizeof(datatype)); \
+        memcpy(B, A, len * sizeof(datatype)); \
+    } \
+    if (do_print) { \
+        ptime_gettime_monotonic(&t1); \
+        printf("In:\n"); \
+        fn_mat_print(A, nrows, ncols); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("print", &t1, &t2); \
+    } \
+    ptime_gettime_monotonic(&t1);
+
+#define TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print) \
+    TRANSP_INPLACE_ALLOC(datatype, fn_malloc); \
+    TRANSP_INPLACE_FILL(datatype, fn_malloc, fn_fill, fn_mat_print);
+
+#define TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free) \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
+    if (do_print) { \
+        printf("Out:\n"); \
+        fn_mat_print(A, ncols, nrows); \
+    } \
+    if (do_verify) { \
+        ptime_gettime_monotonic(&t1); \
+        VERIFY_TRANSPOSE(B, A, fn_is_eq); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("verify", &t1, &t2); \
+        fn_free(B); \
+    } \
+    TRANSP_NUMA_REPORT(A, NULL, len * sizeof(*A), 0); \
+    TRANSP_PAGE_REPORT(A, NULL); \
+    fn_free(A);
+
+#define TRANSP_SQUARE(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                      fn_transp, fn_is_eq) { \
+    TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, nrows); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_SQUARE_BLOCKED(datatype, fn_malloc, fn_free, fn_fill, \
+                              fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, nrows, nblkrows); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_SQUARE_THREADED(datatype, fn_malloc, fn_free, fn_fill, \
+                               fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, nrows, nthreads); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_SQUARE_THREADED_BLOCKED(datatype, fn_malloc, fn_free, fn_fill, \
+                                       fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, nrows, nthreads, nblkrows); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_INPLACE(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                       fn_transp, fn_is_eq) { \
+    TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, nrows, ncols); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+// planning with more rigor than FFTW_ESTIMATE may overwrite A and B, so FFTW
+// plans the transpose after the matrices are allocated but before A is filled
+#define TRANSP_GURU_PLAN(fn_plan, A, B) \
+    wisdom_import(); \
+    ptime_gettime_monotonic(&t1); \
+    GURU_PLAN_T plan = fn_plan(A, B, nrows, ncols, plan_flags); \
+    ptime_gettime_monotonic(&t2); \
+    if (!plan) { \
+        fprintf(stderr, "FFTW can't plan a%s %zux%zu transpose\n", \
+                (void *) (A) == (void *) (B) ? "n in-place" : "", \
+                nrows, ncols); \
+        exit(EINVAL); \
+    } \
+    PRINT_ELAPSED_TIME("plan", &t1, &t2);
+
+#define TRANSP_GURU(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                    fn_plan, fn_execute, fn_destroy, fn_is_eq) { \
+    TRANSP_ALLOC(datatype, fn_malloc); \
+    TRANSP_GURU_PLAN(fn_plan, A, B); \
+    TRANSP_FILL(datatype, fn_fill, fn_mat_print); \
+    fn_execute(plan); \
+    TRANSP_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    fn_destroy(plan); \
+    wisdom_export(); \
+}
+
+#define TRANSP_GURU_INPLACE(datatype, fn_malloc, fn_free, fn_fill, \
+                            fn_mat_print, fn_plan, fn_execute, fn_destroy, \
+                            fn_is_eq) { \
+    TRANSP_INPLACE_ALLOC(datatype, fn_malloc); \
+    TRANSP_GURU_PLAN(fn_plan, A, A); \
+    TRANSP_INPLACE_FILL(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_execute(plan); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+    fn_destroy(plan); \
+    wisdom_export(); \
+}
+
+#define TRANSP_INPLACE_THREADED(datatype, fn_malloc, fn_free, fn_fill, \
+                                fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_INPLACE_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, nrows, ncols, nthreads); \
+    TRANSP_INPLACE_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+// a batch of matrices, each transposed into the same place in B
+#define TRANSP_BATCH_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print) \
+    const size_t stride = nrows * ncols; \
+    const size_t len = (stride * batch + 63) / 64 * 64; \
+    datatype *A = fn_malloc(len * sizeof(datatype)); \
+    datatype *B = fn_malloc(len * sizeof(datatype)); \
+    size_t i; \
+    ld_init(sizeof(datatype)); \
+    printf("batch: %zu\n", batch); \
+    TRANSP_FIRST_TOUCH(A, B, len * sizeof(datatype), \
+                       len * sizeof(datatype)); \
+    ptime_gettime_monotonic(&t1); \
+    fn_fill(A, len); \
+    if (do_init) { \
+        ptime_gettime_monotonic(&t1); \
+        memset(B, 0, len * sizeof(datatype)); \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("init", &t1, &t2); \
+    } \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("fill", &t1, &t2); \
+    if (do_print) { \
+        ptime_gettime_monotonic(&t1); \
+        printf("In:\n"); \
+        for (i = 0; i < batch; i++) { \
+            fn_mat_print(&A[i * stride], nrows, ncols); \
+        } \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("print", &t1, &t2); \
+    } \
+    ptime_gettime_monotonic(&t1);
+
+#define TRANSP_BATCH_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free) \
+    ptime_gettime_monotonic(&t2); \
+    PRINT_ELAPSED_TIME("transpose", &t1, &t2); \
+    if (do_print) { \
+        printf("Out:\n"); \
+        for (i = 0; i < batch; i++) { \
+            fn_mat_print(&B[i * stride], ncols, nrows); \
+        } \
+    } \
+    if (do_verify) { \
+        ptime_gettime_monotonic(&t1); \
+        for (i = 0; i < batch && !rc; i++) { \
+            VERIFY_TRANSPOSE((&A[i * stride]), (&B[i * stride]), fn_is_eq); \
+        } \
+        ptime_gettime_monotonic(&t2); \
+        PRINT_ELAPSED_TIME("verify", &t1, &t2); \
+    } \
+    TRANSP_NUMA_REPORT(A, B, len * sizeof(*A), len * sizeof(*B)); \
+    TRANSP_PAGE_REPORT(A, B); \
+    fn_free(B); \
+    fn_free(A);
+
+#define TRANSP_BATCH(datatype, fn_malloc, fn_free, fn_fill, fn_mat_print, \
+                     fn_transp, fn_is_eq) { \
+    TRANSP_BATCH_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, batch, stride); \
+    TRANSP_BATCH_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#define TRANSP_BATCH_THREADED(datatype, fn_malloc, fn_free, fn_fill, \
+                              fn_mat_print, fn_transp, fn_is_eq) { \
+    TRANSP_BATCH_SETUP(datatype, fn_malloc, fn_fill, fn_mat_print); \
+    fn_transp(A, B, nrows, ncols, batch, stride, nthreads); \
+    TRANSP_BATCH_TEARDOWN(A, B, fn_mat_print, fn_is_eq, fn_free); \
+}
+
+#if defined(_USE_TRANSP_PLAN)
+#define WISDOM_IMPORT transpose_wisdom_import
+#define WISDOM_EXPORT transpose_wisdom_export
+#elif defined(USE_FFTWF_GURU) || defined(USE_FFTWF_GURU_INPLACE)
+#define WISDOM_IMPORT wisdom_import_fftwf
+#define WISDOM_EXPORT wisdom_export_fftwf
+#elif defined(USE_FFTW_GURU) || defined(USE_FFTW_GURU_INPLACE)
+#define WISDOM_IMPORT wisdom_import_fftw
+#define WISDOM_EXPORT wisdom_export_fftw
+#endif
+
+#if defined(_USE_TRANSP_PLAN) || defined(_USE_TRANSP_GURU)
+static void wisdom_import(void)
+{
+    // a wisdom file that doesn't exist yet is created on export
+    if (wisdom_file && WISDOM_IMPORT(wisdom_file) &&
+        errno != ENOENT) {
+        perror(wisdom_file);
+        exit(errno);
+    }
+}
+
+static void wisdom_export(void)
+{
+    if (wisdom_file && WISDOM_EXPORT(wisdom_file)) {
+        perror(wisdom_file);
+        rc = errno;
+    }
+}
+#endif
+
 static void usage(const char *pname, int code)
 {
     fprintf(code ? stderr : stdout,
@@ -219,21 +1082,76 @@ static void usage(const char *pname, int code)
             " [-R ROWS] [-C COLS]"
 #endif
 #if defined(_USE_TRANSP_THREADS)
-            " [-t THREADS]"
+            " [-t THREADS] [-N]"
+#endif
+#if defined(_USE_TRANSP_PLAN)
+            " [-M] [-w FILE]"
+#elif defined(_USE_TRANSP_GURU)
+            " [-F RIGOR] [-w FILE]"
+#endif
+#if defined(_USE_TRANSP_LD)
+            " [-l LDA] [-L LDB] [-P] [-y ROW] [-x COL]"
+#endif
+#if defined(_USE_TRANSP_BATCH)
+            " [-b COUNT]"
 #endif
-            " [-p] [-v] [-h]\n"
+#if defined(_USE_TRANSP_EPI)
+            " [-s RE[,IM]] [-j] [-f]"
+#endif
+            " [-H] [-p] [-v] [-h]\n"
             "  -r, --rows=ROWS          Matrix row count, in [1, ULONG_MAX]\n"
             "  -c, --cols=COLS          Matrix column count, in [1, ULONG_MAX]\n"
+#if defined(_USE_TRANSP_SQUARE)
+            "                           ROWS and COLS must be equal (in-place, square)\n"
+#endif
 #if defined(_USE_TRANSP_BLOCKED)
             "  -R, --block-rows=ROWS    Rows per block, in [0, ULONG_MAX]\n"
             "  -C, --block-cols=COLS    Columns per block, in [0, ULONG_MAX]\n"
             "                           ROWS/COLS must be divisors of the corresponding\n"
             "                           matrix dimension\n"
             "                           (default=0, implies no blocking in that dimension)\n"
+#if defined(_USE_TRANSP_SQUARE)
+            "                           Block ROWS and COLS must be equal\n"
+#endif
 #endif
 #if defined(_USE_TRANSP_THREADS)
             "  -t, --threads=THREADS    Number of threads, in (0, ULONG_MAX] (default=1)\n"
+            "  -N, --numa               Print the NUMA nodes the matrices' pages are on\n"
+#endif
+#if defined(_USE_TRANSP_PLAN)
+            "  -M, --measure            Plan by timing candidates instead of estimating\n"
+            "  -w, --wisdom=FILE        Load plans from FILE, if it exists, and save\n"
+            "                           plans to FILE after the transpose\n"
+#elif defined(_USE_TRANSP_GURU)
+            "  -F, --plan-flags=RIGOR   FFTW planner rigor: estimate, measure, patient,\n"
+            "                           or exhaustive (default=estimate)\n"
+            "  -w, --wisdom=FILE        Load FFTW plans from FILE, if it exists, and save\n"
+            "                           plans to FILE after the transpose\n"
+#endif
+#if defined(_USE_TRANSP_LD)
+            "  -l, --lda=LDA            Input row stride in elements, in [COLS, ULONG_MAX]\n"
+            "  -L, --ldb=LDB            Output row stride in elements, in [ROWS, ULONG_MAX]\n"
+            "                           (default=COLS and ROWS, i.e., no padding)\n"
+            "  -P, --pad                Pad rows whose stride isn't given to an odd number\n"
+            "                           of cache lines, to avoid cache set conflicts\n"
+            "  -y, --row-offset=ROW     Transpose the window at row ROW and column COL of\n"
+            "  -x, --col-offset=COL     a larger input frame into the mirrored window of\n"
+            "                           the output frame (default=0)\n"
+            "                           Strides must then be at least COL+COLS and\n"
+            "                           ROW+ROWS, respectively\n"
+#endif
+#if defined(_USE_TRANSP_BATCH)
+            "  -b, --batch=COUNT        Number of ROWS x COLS matrices, stored back to\n"
+            "                           back, in [1, ULONG_MAX] (default=1)\n"
 #endif
+#if defined(_USE_TRANSP_EPI)
+            "  -s, --scale=RE[,IM]      Multiply the output by a complex factor (default=1)\n"
+            "  -j, --conj               Conjugate the output (before scaling)\n"
+            "  -f, --fftshift           Circularly shift the output's rows and columns by\n"
+            "                           half, to center the zero frequency\n"
+#endif
+            "  -H, --huge-pages         Back matrices with huge pages, if possible, and\n"
+            "                           print the page size obtained for each\n"
             "  -i, --init               Initialize all matrices (simulates buffer reuse)\n"
             "                           Note: input matrix is always initialized\n"
             "  -p, --print              Print matrices\n"
@@ -252,13 +1170,45 @@ static size_t assert_to_size_t(const char* str, const char* pname)
     return s;
 }
 
-static const char opts_short[] = "r:c:R:C:t:ipvh";
+#if defined(_USE_TRANSP_EPI)
+// parse RE or RE,IM
+static double complex assert_to_complex(const char* str, const char* pname)
+{
+    char *end;
+    double re, im = 0;
+    errno = 0;
+    re = strtod(str, &end);
+    if (*end == ',') {
+        im = strtod(end + 1, &end);
+    }
+    if (errno || *end || end == str) {
+        usage(pname, EINVAL);
+    }
+    return re + im * I;
+}
+#endif
+
+static const char opts_short[] = "r:c:R:C:t:NMF:w:l:L:Py:x:b:s:jfHipvh";
 static const struct option opts_long[] = {
     {"rows",        required_argument,  NULL,   'r'},
     {"cols",        required_argument,  NULL,   'c'},
     {"block-rows",  required_argument,  NULL,   'R'},
     {"block-cols",  required_argument,  NULL,   'C'},
     {"threads",     required_argument,  NULL,   't'},
+    {"numa",        no_argument,        NULL,   'N'},
+    {"measure",     no_argument,        NULL,   'M'},
+    {"plan-flags",  required_argument,  NULL,   'F'},
+    {"wisdom",      required_argument,  NULL,   'w'},
+    {"lda",         required_argument,  NULL,   'l'},
+    {"ldb",         required_argument,  NULL,   'L'},
+    {"pad",         no_argument,        NULL,   'P'},
+    {"row-offset",  required_argument,  NULL,   'y'},
+    {"col-offset",  required_argument,  NULL,   'x'},
+    {"batch",       required_argument,  NULL,   'b'},
+    {"scale",       required_argument,  NULL,   's'},
+    {"conj",        no_argument,        NULL,   'j'},
+    {"fftshift",    no_argument,        NULL,   'f'},
+    {"huge-pages",  no_argument,        NULL,   'H'},
     {"init",        no_argument,        NULL,   'i'},
     {"print",       no_argument,        NULL,   'p'},
     {"verify",      no_argument,        NULL,   'v'},
@@ -292,7 +1242,67 @@ static void parse_args(int argc, char **argv)
                 usage(argv[0], EINVAL);
             }
             break;
+        case 'N':
+            do_numa = true;
+            break;
+#endif
+#if defined(_USE_TRANSP_PLAN)
+        case 'M':
+            plan_mode = TRANSPOSE_PLAN_MEASURE;
+            break;
+        case 'w':
+            wisdom_file = optarg;
+            break;
+#elif defined(_USE_TRANSP_GURU)
+        case 'F':
+            if (PLAN_FLAGS(optarg, &plan_flags)) {
+                usage(argv[0], EINVAL);
+            }
+            break;
+        case 'w':
+            wisdom_file = optarg;
+            break;
+#endif
+#if defined(_USE_TRANSP_LD)
+        case 'l':
+            lda = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'L':
+            ldb = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'P':
+            do_pad = true;
+            break;
+        case 'y':
+            row_off = assert_to_size_t(optarg, argv[0]);
+            break;
+        case 'x':
+            col_off = assert_to_size_t(optarg, argv[0]);
+            break;
+#endif
+#if defined(_USE_TRANSP_BATCH)
+        case 'b':
+            batch = assert_to_size_t(optarg, argv[0]);
+            if (!batch) {
+                usage(argv[0], EINVAL);
+            }
+            break;
 #endif
+#if defined(_USE_TRANSP_EPI)
+        case 's':
+            epi.scale = assert_to_complex(optarg, argv[0]);
+            break;
+        case 'j':
+            epi.conj = 1;
+            break;
+        case 'f':
+            do_fftshift = true;
+            break;
+#endif
+        case 'H':
+            do_huge = true;
+            alloc_huge_pages(1);
+            break;
         case 'i':
             do_init = true;
             break;
@@ -313,6 +1323,12 @@ static void parse_args(int argc, char **argv)
     if (!nrows || !ncols) {
         usage(argv[0], EINVAL);
     }
+#if defined(_USE_TRANSP_LD)
+    // rows may be padded, but not overlap
+    if ((lda && lda < col_off + ncols) || (ldb && ldb < row_off + nrows)) {
+        usage(argv[0], EINVAL);
+    }
+#endif
 #if defined(_USE_TRANSP_BLOCKED)
     // fall back to default values
     if (!nblkrows) {
@@ -321,200 +1337,1017 @@ static void parse_args(int argc, char **argv)
     if (!nblkcols) {
         nblkcols = ncols;
     }
-    // check divisibility
+#if !defined(_USE_TRANSP_EPI)
+    // check divisibility (epilogue transposes support partial blocks)
     if ((nrows % nblkrows) || (ncols % nblkcols)) {
         usage(argv[0], EINVAL);
     }
 #endif
+#if defined(_USE_TRANSP_SQUARE)
+    // in-place tiles are swapped with their mirror tiles, so must be square
+    if (nblkrows != nblkcols) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#endif
+#if defined(_USE_TRANSP_SQUARE)
+    if (nrows != ncols) {
+        usage(argv[0], EINVAL);
+    }
+#endif
+#if defined(_USE_TRANSP_EPI)
+    if (do_fftshift) {
+        epi.row_shift = ncols / 2;
+        epi.col_shift = nrows / 2;
+    }
+#endif
 }
 
 int main(int argc, char **argv)
 {
     parse_args(argc, argv);
+#if defined(_USE_TRANSP_DISPATCH) || defined(_USE_TRANSP_PLAN)
+    printf("isa: %s\n", transpose_dispatch_isa());
+#endif
 #if defined(USE_FLT_NAIVE)
-    TRANSP(float, assert_malloc_al, free,
-           fill_rand_flt, matrix_print_flt, transpose_flt_naive, is_eq_flt);
+    TRANSP_LD(float, assert_malloc_al, free_al,
+              fill_rand_flt, matrix_print_flt, transpose_flt_naive_ld,
+              is_eq_flt);
 #elif defined(USE_FLT_BLOCKED)
-    TRANSP_BLOCKED(float, assert_malloc_al, free,
-                   fill_rand_flt, matrix_print_flt, transpose_flt_blocked,
-                   is_eq_flt);
+    TRANSP_BLOCKED_LD(float, assert_malloc_al, free_al,
+                      fill_rand_flt, matrix_print_flt, transpose_flt_blocked_ld,
+                      is_eq_flt);
 #elif defined(USE_FLT_THRROW)
-    TRANSP_THREADED(float, assert_malloc_al, free,
-                    fill_rand_flt, matrix_print_flt, transpose_flt_thrrow,
-                    is_eq_flt);
+    TRANSP_THREADED_LD(float, assert_malloc_al, free_al,
+                       fill_rand_flt, matrix_print_flt, transpose_flt_thrrow_ld,
+                       is_eq_flt);
 #elif defined(USE_FLT_THRCOL)
-    TRANSP_THREADED(float, assert_malloc_al, free,
-                    fill_rand_flt, matrix_print_flt, transpose_flt_thrcol,
-                    is_eq_flt);
+    TRANSP_THREADED_LD(float, assert_malloc_al, free_al,
+                       fill_rand_flt, matrix_print_flt, transpose_flt_thrcol_ld,
+                       is_eq_flt);
 #elif defined(USE_FLT_THRROW_BLOCKED)
-    TRANSP_THREADED_BLOCKED(float, assert_malloc_al, free,
-                            fill_rand_flt, matrix_print_flt,
-                            transpose_flt_thrrow_blocked, is_eq_flt);
+    TRANSP_THREADED_BLOCKED_LD(float, assert_malloc_al, free_al,
+                               fill_rand_flt, matrix_print_flt,
+                               transpose_flt_thrrow_blocked_ld, is_eq_flt);
 #elif defined(USE_FLT_THRCOL_BLOCKED)
-    TRANSP_THREADED_BLOCKED(float, assert_malloc_al, free,
+    TRANSP_THREADED_BLOCKED_LD(float, assert_malloc_al, free_al,
+                               fill_rand_flt, matrix_print_flt,
+                               transpose_flt_thrcol_blocked_ld, is_eq_flt);
+#elif defined(USE_FLT_SQUARE_NAIVE)
+    TRANSP_SQUARE(float, assert_malloc_al, free_al,
+                  fill_rand_flt, matrix_print_flt,
+                  transpose_flt_square_naive, is_eq_flt);
+#elif defined(USE_FLT_SQUARE_BLOCKED)
+    TRANSP_SQUARE_BLOCKED(float, assert_malloc_al, free_al,
+                          fill_rand_flt, matrix_print_flt,
+                          transpose_flt_square_blocked, is_eq_flt);
+#elif defined(USE_FLT_THRROW_SQUARE)
+    TRANSP_SQUARE_THREADED(float, assert_malloc_al, free_al,
+                           fill_rand_flt, matrix_print_flt,
+                           transpose_flt_thrrow_square, is_eq_flt);
+#elif defined(USE_FLT_THRROW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_THREADED_BLOCKED(float, assert_malloc_al, free_al,
+                                   fill_rand_flt, matrix_print_flt,
+                                   transpose_flt_thrrow_square_blocked,
+                                   is_eq_flt);
+#elif defined(USE_FLT_INPLACE)
+    TRANSP_INPLACE(float, assert_malloc_al, free_al,
+                   fill_rand_flt, matrix_print_flt,
+                   transpose_flt_inplace, is_eq_flt);
+#elif defined(USE_FLT_THRCYC_INPLACE)
+    TRANSP_INPLACE_THREADED(float, assert_malloc_al, free_al,
                             fill_rand_flt, matrix_print_flt,
-                            transpose_flt_thrcol_blocked, is_eq_flt);
+                            transpose_flt_thrcyc_inplace, is_eq_flt);
+#elif defined(USE_FLT_AVX2_INTR)
+    TRANSP_LD(float, assert_malloc_al, free_al,
+              fill_rand_flt, matrix_print_flt, transpose_flt_avx2_intr_ld,
+              is_eq_flt);
+#elif defined(USE_FLT_THRROW_AVX2_INTR)
+    TRANSP_THREADED_LD(float, assert_malloc_al, free_al,
+                       fill_rand_flt, matrix_print_flt,
+                       transpose_flt_thrrow_avx2_intr_ld, is_eq_flt);
+#elif defined(USE_FLT_THRCOL_AVX2_INTR)
+    TRANSP_THREADED_LD(float, assert_malloc_al, free_al,
+                       fill_rand_flt, matrix_print_flt,
+                       transpose_flt_thrcol_avx2_intr_ld, is_eq_flt);
+#elif defined(USE_FLT_AVX512_INTR)
+    TRANSP_LD(float, assert_malloc_al, free_al,
+              fill_rand_flt, matrix_print_flt, transpose_flt_avx512_intr_ld,
+              is_eq_flt);
+#elif defined(USE_FLT_THRROW_AVX512_INTR)
+    TRANSP_THREADED_LD(float, assert_malloc_al, free_al,
+                       fill_rand_flt, matrix_print_flt,
+                       transpose_flt_thrrow_avx512_intr_ld, is_eq_flt);
+#elif defined(USE_FLT_THRCOL_AVX512_INTR)
+    TRANSP_THREADED_LD(float, assert_malloc_al, free_al,
+                       fill_rand_flt, matrix_print_flt,
+                       transpose_flt_thrcol_avx512_intr_ld, is_eq_flt);
+#elif defined(USE_FLT_DISPATCH)
+    TRANSP(float, assert_malloc_al, free_al,
+           fill_rand_flt, matrix_print_flt, transpose_flt_dispatch,
+           is_eq_flt);
+#elif defined(USE_FLT_BATCH)
+    TRANSP_BATCH(float, assert_malloc_al, free_al,
+                 fill_rand_flt, matrix_print_flt,
+                 transpose_flt_batch, is_eq_flt);
+#elif defined(USE_FLT_THRBATCH)
+    TRANSP_BATCH_THREADED(float, assert_malloc_al, free_al,
+                          fill_rand_flt, matrix_print_flt,
+                          transpose_flt_thrbatch, is_eq_flt);
+#elif defined(USE_FLT_BATCH_AVX512_INTR)
+    TRANSP_BATCH(float, assert_malloc_al, free_al,
+                 fill_rand_flt, matrix_print_flt,
+                 transpose_flt_batch_avx512_intr, is_eq_flt);
+#elif defined(USE_FLT_THRBATCH_AVX512_INTR)
+    TRANSP_BATCH_THREADED(float, assert_malloc_al, free_al,
+                          fill_rand_flt, matrix_print_flt,
+                          transpose_flt_thrbatch_avx512_intr, is_eq_flt);
+#elif defined(USE_FLT_RECURSIVE)
+    TRANSP(float, assert_malloc_al, free_al,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_recursive, is_eq_flt);
+#elif defined(USE_FLT_MORTON)
+    TRANSP(float, assert_malloc_al, free_al,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_morton, is_eq_flt);
+#elif defined(USE_FLT_HILBERT)
+    TRANSP(float, assert_malloc_al, free_al,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_hilbert, is_eq_flt);
+#elif defined(USE_FLT_TLB)
+    TRANSP_TLB(float, assert_malloc_al, free_al,
+               fill_rand_flt, matrix_print_flt,
+               transpose_flt_tlb, is_eq_flt);
+#elif defined(USE_FLT_THRREC)
+    TRANSP_THREADED(float, assert_malloc_al, free_al,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_thrrec, is_eq_flt);
+#elif defined(USE_FLT_THRMORTON)
+    TRANSP_THREADED(float, assert_malloc_al, free_al,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_thrmorton, is_eq_flt);
+#elif defined(USE_FLT_THRHILBERT)
+    TRANSP_THREADED(float, assert_malloc_al, free_al,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_thrhilbert, is_eq_flt);
+#elif defined(USE_FLT_THRTILE)
+    TRANSP_THREADED(float, assert_malloc_al, free_al,
+                    fill_rand_flt, matrix_print_flt,
+                    transpose_flt_thrtile, is_eq_flt);
+#elif defined(USE_FLT_THRNUMA)
+    TRANSP_THREADED_NUMA(float, assert_malloc_al, free_al,
+                         fill_rand_flt, matrix_print_flt,
+                         transpose_flt_thrnuma, is_eq_flt);
+#elif defined(USE_FLT_THRTLB)
+    TRANSP_THREADED_TLB(float, assert_malloc_al, free_al,
+                        fill_rand_flt, matrix_print_flt,
+                        transpose_flt_thrtlb, is_eq_flt);
+#elif defined(USE_FLT_RECURSIVE_AVX512_INTR)
+    TRANSP(float, assert_malloc_al, free_al,
+           fill_rand_flt, matrix_print_flt,
+           transpose_flt_recursive_avx512_intr, is_eq_flt);
+#elif defined(USE_FLT_PLAN)
+    TRANSP_PLANNED(float, assert_malloc_al, free_al,
+                   fill_rand_flt, matrix_print_flt, transpose_plan_flt,
+                   transpose_execute_flt, is_eq_flt);
 #elif defined(USE_DBL_NAIVE)
-    TRANSP(double, assert_malloc_al, free,
-           fill_rand_dbl, matrix_print_dbl, transpose_dbl_naive, is_eq_dbl);
+    TRANSP_LD(double, assert_malloc_al, free_al,
+              fill_rand_dbl, matrix_print_dbl, transpose_dbl_naive_ld,
+              is_eq_dbl);
 #elif defined(USE_DBL_BLOCKED)
-    TRANSP_BLOCKED(double, assert_malloc_al, free,
-                   fill_rand_dbl, matrix_print_dbl, transpose_dbl_blocked,
-                   is_eq_dbl);
+    TRANSP_BLOCKED_LD(double, assert_malloc_al, free_al,
+                      fill_rand_dbl, matrix_print_dbl, transpose_dbl_blocked_ld,
+                      is_eq_dbl);
 #elif defined(USE_DBL_THRROW)
-    TRANSP_THREADED(double, assert_malloc_al, free,
-                    fill_rand_dbl, matrix_print_dbl, transpose_dbl_thrrow,
-                    is_eq_dbl);
+    TRANSP_THREADED_LD(double, assert_malloc_al, free_al,
+                       fill_rand_dbl, matrix_print_dbl, transpose_dbl_thrrow_ld,
+                       is_eq_dbl);
 #elif defined(USE_DBL_THRCOL)
-    TRANSP_THREADED(double, assert_malloc_al, free,
-                    fill_rand_dbl, matrix_print_dbl, transpose_dbl_thrcol,
-                    is_eq_dbl);
+    TRANSP_THREADED_LD(double, assert_malloc_al, free_al,
+                       fill_rand_dbl, matrix_print_dbl, transpose_dbl_thrcol_ld,
+                       is_eq_dbl);
 #elif defined(USE_DBL_THRROW_BLOCKED)
-    TRANSP_THREADED_BLOCKED(double, assert_malloc_al, free,
-                            fill_rand_dbl, matrix_print_dbl,
-                            transpose_dbl_thrrow_blocked, is_eq_dbl);
+    TRANSP_THREADED_BLOCKED_LD(double, assert_malloc_al, free_al,
+                               fill_rand_dbl, matrix_print_dbl,
+                               transpose_dbl_thrrow_blocked_ld, is_eq_dbl);
 #elif defined(USE_DBL_THRCOL_BLOCKED)
-    TRANSP_THREADED_BLOCKED(double, assert_malloc_al, free,
-                            fill_rand_dbl, matrix_print_dbl,
-                            transpose_dbl_thrcol_blocked, is_eq_dbl);
+    TRANSP_THREADED_BLOCKED_LD(double, assert_malloc_al, free_al,
+                               fill_rand_dbl, matrix_print_dbl,
+                               transpose_dbl_thrcol_blocked_ld, is_eq_dbl);
 #elif defined(USE_DBL_AVX512_INTR)
-    TRANSP(double, assert_malloc_al, free,
-           fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx512_intr,
-           is_eq_dbl);
+    TRANSP_LD(double, assert_malloc_al, free_al,
+              fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx512_intr_ld,
+              is_eq_dbl);
 #elif defined(USE_DBL_THRROW_AVX512_INTR)
-    TRANSP_THREADED(double, assert_malloc_al, free,
-                    fill_rand_dbl, matrix_print_dbl,
-                    transpose_dbl_thrrow_avx512_intr, is_eq_dbl);
+    TRANSP_THREADED_LD(double, assert_malloc_al, free_al,
+                       fill_rand_dbl, matrix_print_dbl,
+                       transpose_dbl_thrrow_avx512_intr_ld, is_eq_dbl);
 #elif defined(USE_DBL_THRCOL_AVX512_INTR)
-    TRANSP_THREADED(double, assert_malloc_al, free,
+    TRANSP_THREADED_LD(double, assert_malloc_al, free_al,
+                       fill_rand_dbl, matrix_print_dbl,
+                       transpose_dbl_thrcol_avx512_intr_ld, is_eq_dbl);
+#elif defined(USE_DBL_SQUARE_NAIVE)
+    TRANSP_SQUARE(double, assert_malloc_al, free_al,
+                  fill_rand_dbl, matrix_print_dbl,
+                  transpose_dbl_square_naive, is_eq_dbl);
+#elif defined(USE_DBL_SQUARE_BLOCKED)
+    TRANSP_SQUARE_BLOCKED(double, assert_malloc_al, free_al,
+                          fill_rand_dbl, matrix_print_dbl,
+                          transpose_dbl_square_blocked, is_eq_dbl);
+#elif defined(USE_DBL_THRROW_SQUARE)
+    TRANSP_SQUARE_THREADED(double, assert_malloc_al, free_al,
+                           fill_rand_dbl, matrix_print_dbl,
+                           transpose_dbl_thrrow_square, is_eq_dbl);
+#elif defined(USE_DBL_THRROW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_THREADED_BLOCKED(double, assert_malloc_al, free_al,
+                                   fill_rand_dbl, matrix_print_dbl,
+                                   transpose_dbl_thrrow_square_blocked,
+                                   is_eq_dbl);
+#elif defined(USE_DBL_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE(double, assert_malloc_al, free_al,
+                  fill_rand_dbl, matrix_print_dbl,
+                  transpose_dbl_square_avx512_intr, is_eq_dbl);
+#elif defined(USE_DBL_THRROW_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE_THREADED(double, assert_malloc_al, free_al,
+                           fill_rand_dbl, matrix_print_dbl,
+                           transpose_dbl_thrrow_square_avx512_intr, is_eq_dbl);
+#elif defined(USE_DBL_INPLACE)
+    TRANSP_INPLACE(double, assert_malloc_al, free_al,
+                   fill_rand_dbl, matrix_print_dbl,
+                   transpose_dbl_inplace, is_eq_dbl);
+#elif defined(USE_DBL_THRCYC_INPLACE)
+    TRANSP_INPLACE_THREADED(double, assert_malloc_al, free_al,
+                            fill_rand_dbl, matrix_print_dbl,
+                            transpose_dbl_thrcyc_inplace, is_eq_dbl);
+#elif defined(USE_DBL_AVX2_INTR)
+    TRANSP_LD(double, assert_malloc_al, free_al,
+              fill_rand_dbl, matrix_print_dbl, transpose_dbl_avx2_intr_ld,
+              is_eq_dbl);
+#elif defined(USE_DBL_THRROW_AVX2_INTR)
+    TRANSP_THREADED_LD(double, assert_malloc_al, free_al,
+                       fill_rand_dbl, matrix_print_dbl,
+                       transpose_dbl_thrrow_avx2_intr_ld, is_eq_dbl);
+#elif defined(USE_DBL_THRCOL_AVX2_INTR)
+    TRANSP_THREADED_LD(double, assert_malloc_al, free_al,
+                       fill_rand_dbl, matrix_print_dbl,
+                       transpose_dbl_thrcol_avx2_intr_ld, is_eq_dbl);
+#elif defined(USE_DBL_DISPATCH)
+    TRANSP(double, assert_malloc_al, free_al,
+           fill_rand_dbl, matrix_print_dbl, transpose_dbl_dispatch,
+           is_eq_dbl);
+#elif defined(USE_DBL_BATCH)
+    TRANSP_BATCH(double, assert_malloc_al, free_al,
+                 fill_rand_dbl, matrix_print_dbl,
+                 transpose_dbl_batch, is_eq_dbl);
+#elif defined(USE_DBL_THRBATCH)
+    TRANSP_BATCH_THREADED(double, assert_malloc_al, free_al,
+                          fill_rand_dbl, matrix_print_dbl,
+                          transpose_dbl_thrbatch, is_eq_dbl);
+#elif defined(USE_DBL_BATCH_AVX512_INTR)
+    TRANSP_BATCH(double, assert_malloc_al, free_al,
+                 fill_rand_dbl, matrix_print_dbl,
+                 transpose_dbl_batch_avx512_intr, is_eq_dbl);
+#elif defined(USE_DBL_THRBATCH_AVX512_INTR)
+    TRANSP_BATCH_THREADED(double, assert_malloc_al, free_al,
+                          fill_rand_dbl, matrix_print_dbl,
+                          transpose_dbl_thrbatch_avx512_intr, is_eq_dbl);
+#elif defined(USE_DBL_RECURSIVE)
+    TRANSP(double, assert_malloc_al, free_al,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_recursive, is_eq_dbl);
+#elif defined(USE_DBL_MORTON)
+    TRANSP(double, assert_malloc_al, free_al,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_morton, is_eq_dbl);
+#elif defined(USE_DBL_HILBERT)
+    TRANSP(double, assert_malloc_al, free_al,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_hilbert, is_eq_dbl);
+#elif defined(USE_DBL_TLB)
+    TRANSP_TLB(double, assert_malloc_al, free_al,
+               fill_rand_dbl, matrix_print_dbl,
+               transpose_dbl_tlb, is_eq_dbl);
+#elif defined(USE_DBL_THRREC)
+    TRANSP_THREADED(double, assert_malloc_al, free_al,
                     fill_rand_dbl, matrix_print_dbl,
-                    transpose_dbl_thrcol_avx512_intr, is_eq_dbl);
+                    transpose_dbl_thrrec, is_eq_dbl);
+#elif defined(USE_DBL_THRMORTON)
+    TRANSP_THREADED(double, assert_malloc_al, free_al,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_thrmorton, is_eq_dbl);
+#elif defined(USE_DBL_THRHILBERT)
+    TRANSP_THREADED(double, assert_malloc_al, free_al,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_thrhilbert, is_eq_dbl);
+#elif defined(USE_DBL_THRTILE)
+    TRANSP_THREADED(double, assert_malloc_al, free_al,
+                    fill_rand_dbl, matrix_print_dbl,
+                    transpose_dbl_thrtile, is_eq_dbl);
+#elif defined(USE_DBL_THRNUMA)
+    TRANSP_THREADED_NUMA(double, assert_malloc_al, free_al,
+                         fill_rand_dbl, matrix_print_dbl,
+                         transpose_dbl_thrnuma, is_eq_dbl);
+#elif defined(USE_DBL_THRTLB)
+    TRANSP_THREADED_TLB(double, assert_malloc_al, free_al,
+                        fill_rand_dbl, matrix_print_dbl,
+                        transpose_dbl_thrtlb, is_eq_dbl);
+#elif defined(USE_DBL_RECURSIVE_AVX512_INTR)
+    TRANSP(double, assert_malloc_al, free_al,
+           fill_rand_dbl, matrix_print_dbl,
+           transpose_dbl_recursive_avx512_intr, is_eq_dbl);
+#elif defined(USE_DBL_PLAN)
+    TRANSP_PLANNED(double, assert_malloc_al, free_al,
+                   fill_rand_dbl, matrix_print_dbl, transpose_plan_dbl,
+                   transpose_execute_dbl, is_eq_dbl);
 #elif defined(USE_FCMPLX_NAIVE)
-    TRANSP(float complex, assert_malloc_al, free,
-           fill_rand_fcmplx, matrix_print_fcmplx, transpose_fcmplx_naive,
-           is_eq_fcmplx);
+    TRANSP_LD(float complex, assert_malloc_al, free_al,
+              fill_rand_fcmplx, matrix_print_fcmplx, transpose_fcmplx_naive_ld,
+              is_eq_fcmplx);
 #elif defined(USE_FCMPLX_BLOCKED)
-    TRANSP_BLOCKED(float complex, assert_malloc_al, free,
-                   fill_rand_fcmplx, matrix_print_fcmplx,
-                   transpose_fcmplx_blocked, is_eq_fcmplx);
+    TRANSP_BLOCKED_LD(float complex, assert_malloc_al, free_al,
+                      fill_rand_fcmplx, matrix_print_fcmplx,
+                      transpose_fcmplx_blocked_ld, is_eq_fcmplx);
 #elif defined(USE_FCMPLX_THRROW)
-    TRANSP_THREADED(float complex, assert_malloc_al, free,
-                    fill_rand_fcmplx, matrix_print_fcmplx,
-                    transpose_fcmplx_thrrow, is_eq_fcmplx);
+    TRANSP_THREADED_LD(float complex, assert_malloc_al, free_al,
+                       fill_rand_fcmplx, matrix_print_fcmplx,
+                       transpose_fcmplx_thrrow_ld, is_eq_fcmplx);
 #elif defined(USE_FCMPLX_THRCOL)
-    TRANSP_THREADED(float complex, assert_malloc_al, free,
-                    fill_rand_fcmplx, matrix_print_fcmplx,
-                    transpose_fcmplx_thrcol, is_eq_fcmplx);
+    TRANSP_THREADED_LD(float complex, assert_malloc_al, free_al,
+                       fill_rand_fcmplx, matrix_print_fcmplx,
+                       transpose_fcmplx_thrcol_ld, is_eq_fcmplx);
 #elif defined(USE_FCMPLX_THRROW_BLOCKED)
-    TRANSP_THREADED_BLOCKED(float complex, assert_malloc_al, free,
-                            fill_rand_fcmplx, matrix_print_fcmplx,
-                            transpose_fcmplx_thrrow_blocked, is_eq_fcmplx);
+    TRANSP_THREADED_BLOCKED_LD(float complex, assert_malloc_al, free_al,
+                               fill_rand_fcmplx, matrix_print_fcmplx,
+                               transpose_fcmplx_thrrow_blocked_ld,
+                               is_eq_fcmplx);
 #elif defined(USE_FCMPLX_THRCOL_BLOCKED)
-    TRANSP_THREADED_BLOCKED(float complex, assert_malloc_al, free,
+    TRANSP_THREADED_BLOCKED_LD(float complex, assert_malloc_al, free_al,
+                               fill_rand_fcmplx, matrix_print_fcmplx,
+                               transpose_fcmplx_thrcol_blocked_ld,
+                               is_eq_fcmplx);
+#elif defined(USE_FCMPLX_SQUARE_NAIVE)
+    TRANSP_SQUARE(float complex, assert_malloc_al, free_al,
+                  fill_rand_fcmplx, matrix_print_fcmplx,
+                  transpose_fcmplx_square_naive, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_SQUARE_BLOCKED)
+    TRANSP_SQUARE_BLOCKED(float complex, assert_malloc_al, free_al,
+                          fill_rand_fcmplx, matrix_print_fcmplx,
+                          transpose_fcmplx_square_blocked, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRROW_SQUARE)
+    TRANSP_SQUARE_THREADED(float complex, assert_malloc_al, free_al,
+                           fill_rand_fcmplx, matrix_print_fcmplx,
+                           transpose_fcmplx_thrrow_square, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRROW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_THREADED_BLOCKED(float complex, assert_malloc_al, free_al,
+                                   fill_rand_fcmplx, matrix_print_fcmplx,
+                                   transpose_fcmplx_thrrow_square_blocked,
+                                   is_eq_fcmplx);
+#elif defined(USE_FCMPLX_INPLACE)
+    TRANSP_INPLACE(float complex, assert_malloc_al, free_al,
+                   fill_rand_fcmplx, matrix_print_fcmplx,
+                   transpose_fcmplx_inplace, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRCYC_INPLACE)
+    TRANSP_INPLACE_THREADED(float complex, assert_malloc_al, free_al,
                             fill_rand_fcmplx, matrix_print_fcmplx,
-                            transpose_fcmplx_thrcol_blocked, is_eq_fcmplx);
+                            transpose_fcmplx_thrcyc_inplace, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_AVX2_INTR)
+    TRANSP_LD(float complex, assert_malloc_al, free_al,
+              fill_rand_fcmplx, matrix_print_fcmplx,
+              transpose_fcmplx_avx2_intr_ld, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRROW_AVX2_INTR)
+    TRANSP_THREADED_LD(float complex, assert_malloc_al, free_al,
+                       fill_rand_fcmplx, matrix_print_fcmplx,
+                       transpose_fcmplx_thrrow_avx2_intr_ld, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRCOL_AVX2_INTR)
+    TRANSP_THREADED_LD(float complex, assert_malloc_al, free_al,
+                       fill_rand_fcmplx, matrix_print_fcmplx,
+                       transpose_fcmplx_thrcol_avx2_intr_ld, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_DISPATCH)
+    TRANSP(float complex, assert_malloc_al, free_al,
+           fill_rand_fcmplx, matrix_print_fcmplx, transpose_fcmplx_dispatch,
+           is_eq_fcmplx);
+#elif defined(USE_FCMPLX_BATCH)
+    TRANSP_BATCH(float complex, assert_malloc_al, free_al,
+                 fill_rand_fcmplx, matrix_print_fcmplx,
+                 transpose_fcmplx_batch, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRBATCH)
+    TRANSP_BATCH_THREADED(float complex, assert_malloc_al, free_al,
+                          fill_rand_fcmplx, matrix_print_fcmplx,
+                          transpose_fcmplx_thrbatch, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_NAIVE_EPI)
+    TRANSP_EPI(float complex, assert_malloc_al, free_al,
+               fill_rand_fcmplx, matrix_print_fcmplx,
+               transpose_fcmplx_naive_epi, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_BLOCKED_EPI)
+    TRANSP_BLOCKED_EPI(float complex, assert_malloc_al, free_al,
+                       fill_rand_fcmplx, matrix_print_fcmplx,
+                       transpose_fcmplx_blocked_epi, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRROW_EPI)
+    TRANSP_THREADED_EPI(float complex, assert_malloc_al, free_al,
+                        fill_rand_fcmplx, matrix_print_fcmplx,
+                        transpose_fcmplx_thrrow_epi, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_AVX512_INTR_EPI)
+    TRANSP_EPI(float complex, assert_malloc_al, free_al,
+               fill_rand_fcmplx, matrix_print_fcmplx,
+               transpose_fcmplx_avx512_intr_epi, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRROW_AVX512_INTR_EPI)
+    TRANSP_THREADED_EPI(float complex, assert_malloc_al, free_al,
+                        fill_rand_fcmplx, matrix_print_fcmplx,
+                        transpose_fcmplx_thrrow_avx512_intr_epi, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_RECURSIVE)
+    TRANSP(float complex, assert_malloc_al, free_al,
+           fill_rand_fcmplx, matrix_print_fcmplx,
+           transpose_fcmplx_recursive, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_MORTON)
+    TRANSP(float complex, assert_malloc_al, free_al,
+           fill_rand_fcmplx, matrix_print_fcmplx,
+           transpose_fcmplx_morton, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_HILBERT)
+    TRANSP(float complex, assert_malloc_al, free_al,
+           fill_rand_fcmplx, matrix_print_fcmplx,
+           transpose_fcmplx_hilbert, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_TLB)
+    TRANSP_TLB(float complex, assert_malloc_al, free_al,
+               fill_rand_fcmplx, matrix_print_fcmplx,
+               transpose_fcmplx_tlb, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRREC)
+    TRANSP_THREADED(float complex, assert_malloc_al, free_al,
+                    fill_rand_fcmplx, matrix_print_fcmplx,
+                    transpose_fcmplx_thrrec, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRMORTON)
+    TRANSP_THREADED(float complex, assert_malloc_al, free_al,
+                    fill_rand_fcmplx, matrix_print_fcmplx,
+                    transpose_fcmplx_thrmorton, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRHILBERT)
+    TRANSP_THREADED(float complex, assert_malloc_al, free_al,
+                    fill_rand_fcmplx, matrix_print_fcmplx,
+                    transpose_fcmplx_thrhilbert, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRTILE)
+    TRANSP_THREADED(float complex, assert_malloc_al, free_al,
+                    fill_rand_fcmplx, matrix_print_fcmplx,
+                    transpose_fcmplx_thrtile, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRNUMA)
+    TRANSP_THREADED_NUMA(float complex, assert_malloc_al, free_al,
+                         fill_rand_fcmplx, matrix_print_fcmplx,
+                         transpose_fcmplx_thrnuma, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_THRTLB)
+    TRANSP_THREADED_TLB(float complex, assert_malloc_al, free_al,
+                        fill_rand_fcmplx, matrix_print_fcmplx,
+                        transpose_fcmplx_thrtlb, is_eq_fcmplx);
+#elif defined(USE_FCMPLX_PLAN)
+    TRANSP_PLANNED(float complex, assert_malloc_al, free_al,
+                   fill_rand_fcmplx, matrix_print_fcmplx, transpose_plan_fcmplx,
+                   transpose_execute_fcmplx, is_eq_fcmplx);
 #elif defined(USE_DCMPLX_NAIVE)
-    TRANSP(double complex, assert_malloc_al, free,
-           fill_rand_dcmplx, matrix_print_dcmplx, transpose_dcmplx_naive,
-           is_eq_dcmplx);
+    TRANSP_LD(double complex, assert_malloc_al, free_al,
+              fill_rand_dcmplx, matrix_print_dcmplx, transpose_dcmplx_naive_ld,
+              is_eq_dcmplx);
 #elif defined(USE_DCMPLX_BLOCKED)
-    TRANSP_BLOCKED(double complex, assert_malloc_al, free,
-                   fill_rand_dcmplx, matrix_print_dcmplx,
-                   transpose_dcmplx_blocked, is_eq_dcmplx);
+    TRANSP_BLOCKED_LD(double complex, assert_malloc_al, free_al,
+                      fill_rand_dcmplx, matrix_print_dcmplx,
+                      transpose_dcmplx_blocked_ld, is_eq_dcmplx);
 #elif defined(USE_DCMPLX_THRROW)
-    TRANSP_THREADED(double complex, assert_malloc_al, free,
-                    fill_rand_dcmplx, matrix_print_dcmplx,
-                    transpose_dcmplx_thrrow, is_eq_dcmplx);
+    TRANSP_THREADED_LD(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_thrrow_ld, is_eq_dcmplx);
 #elif defined(USE_DCMPLX_THRCOL)
-    TRANSP_THREADED(double complex, assert_malloc_al, free,
-                    fill_rand_dcmplx, matrix_print_dcmplx,
-                    transpose_dcmplx_thrcol, is_eq_dcmplx);
+    TRANSP_THREADED_LD(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_thrcol_ld, is_eq_dcmplx);
 #elif defined(USE_DCMPLX_THRROW_BLOCKED)
-    TRANSP_THREADED_BLOCKED(double complex, assert_malloc_al, free,
-                            fill_rand_dcmplx, matrix_print_dcmplx,
-                            transpose_dcmplx_thrrow_blocked, is_eq_dcmplx);
+    TRANSP_THREADED_BLOCKED_LD(double complex, assert_malloc_al, free_al,
+                               fill_rand_dcmplx, matrix_print_dcmplx,
+                               transpose_dcmplx_thrrow_blocked_ld,
+                               is_eq_dcmplx);
 #elif defined(USE_DCMPLX_THRCOL_BLOCKED)
-    TRANSP_THREADED_BLOCKED(double complex, assert_malloc_al, free,
+    TRANSP_THREADED_BLOCKED_LD(double complex, assert_malloc_al, free_al,
+                               fill_rand_dcmplx, matrix_print_dcmplx,
+                               transpose_dcmplx_thrcol_blocked_ld,
+                               is_eq_dcmplx);
+#elif defined(USE_DCMPLX_SQUARE_NAIVE)
+    TRANSP_SQUARE(double complex, assert_malloc_al, free_al,
+                  fill_rand_dcmplx, matrix_print_dcmplx,
+                  transpose_dcmplx_square_naive, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_SQUARE_BLOCKED)
+    TRANSP_SQUARE_BLOCKED(double complex, assert_malloc_al, free_al,
+                          fill_rand_dcmplx, matrix_print_dcmplx,
+                          transpose_dcmplx_square_blocked, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_SQUARE)
+    TRANSP_SQUARE_THREADED(double complex, assert_malloc_al, free_al,
+                           fill_rand_dcmplx, matrix_print_dcmplx,
+                           transpose_dcmplx_thrrow_square, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_THREADED_BLOCKED(double complex, assert_malloc_al, free_al,
+                                   fill_rand_dcmplx, matrix_print_dcmplx,
+                                   transpose_dcmplx_thrrow_square_blocked,
+                                   is_eq_dcmplx);
+#elif defined(USE_DCMPLX_INPLACE)
+    TRANSP_INPLACE(double complex, assert_malloc_al, free_al,
+                   fill_rand_dcmplx, matrix_print_dcmplx,
+                   transpose_dcmplx_inplace, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRCYC_INPLACE)
+    TRANSP_INPLACE_THREADED(double complex, assert_malloc_al, free_al,
                             fill_rand_dcmplx, matrix_print_dcmplx,
-                            transpose_dcmplx_thrcol_blocked, is_eq_dcmplx);
+                            transpose_dcmplx_thrcyc_inplace, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_AVX512_INTR)
+    TRANSP_LD(double complex, assert_malloc_al, free_al,
+              fill_rand_dcmplx, matrix_print_dcmplx,
+              transpose_dcmplx_avx512_intr_ld, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_AVX512_INTR)
+    TRANSP_THREADED_LD(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_thrrow_avx512_intr_ld, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRCOL_AVX512_INTR)
+    TRANSP_THREADED_LD(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_thrcol_avx512_intr_ld, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE(double complex, assert_malloc_al, free_al,
+                  fill_rand_dcmplx, matrix_print_dcmplx,
+                  transpose_dcmplx_square_avx512_intr, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE_THREADED(double complex, assert_malloc_al, free_al,
+                           fill_rand_dcmplx, matrix_print_dcmplx,
+                           transpose_dcmplx_thrrow_square_avx512_intr,
+                           is_eq_dcmplx);
+#elif defined(USE_DCMPLX_AVX2_INTR)
+    TRANSP_LD(double complex, assert_malloc_al, free_al,
+              fill_rand_dcmplx, matrix_print_dcmplx,
+              transpose_dcmplx_avx2_intr_ld, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_AVX2_INTR)
+    TRANSP_THREADED_LD(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_thrrow_avx2_intr_ld, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRCOL_AVX2_INTR)
+    TRANSP_THREADED_LD(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_thrcol_avx2_intr_ld, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_DISPATCH)
+    TRANSP(double complex, assert_malloc_al, free_al,
+           fill_rand_dcmplx, matrix_print_dcmplx, transpose_dcmplx_dispatch,
+           is_eq_dcmplx);
+#elif defined(USE_DCMPLX_BATCH)
+    TRANSP_BATCH(double complex, assert_malloc_al, free_al,
+                 fill_rand_dcmplx, matrix_print_dcmplx,
+                 transpose_dcmplx_batch, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRBATCH)
+    TRANSP_BATCH_THREADED(double complex, assert_malloc_al, free_al,
+                          fill_rand_dcmplx, matrix_print_dcmplx,
+                          transpose_dcmplx_thrbatch, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_BATCH_AVX512_INTR)
+    TRANSP_BATCH(double complex, assert_malloc_al, free_al,
+                 fill_rand_dcmplx, matrix_print_dcmplx,
+                 transpose_dcmplx_batch_avx512_intr, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRBATCH_AVX512_INTR)
+    TRANSP_BATCH_THREADED(double complex, assert_malloc_al, free_al,
+                          fill_rand_dcmplx, matrix_print_dcmplx,
+                          transpose_dcmplx_thrbatch_avx512_intr, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_NAIVE_EPI)
+    TRANSP_EPI(double complex, assert_malloc_al, free_al,
+               fill_rand_dcmplx, matrix_print_dcmplx,
+               transpose_dcmplx_naive_epi, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_BLOCKED_EPI)
+    TRANSP_BLOCKED_EPI(double complex, assert_malloc_al, free_al,
+                       fill_rand_dcmplx, matrix_print_dcmplx,
+                       transpose_dcmplx_blocked_epi, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_EPI)
+    TRANSP_THREADED_EPI(double complex, assert_malloc_al, free_al,
+                        fill_rand_dcmplx, matrix_print_dcmplx,
+                        transpose_dcmplx_thrrow_epi, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_AVX512_INTR_EPI)
+    TRANSP_EPI(double complex, assert_malloc_al, free_al,
+               fill_rand_dcmplx, matrix_print_dcmplx,
+               transpose_dcmplx_avx512_intr_epi, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRROW_AVX512_INTR_EPI)
+    TRANSP_THREADED_EPI(double complex, assert_malloc_al, free_al,
+                        fill_rand_dcmplx, matrix_print_dcmplx,
+                        transpose_dcmplx_thrrow_avx512_intr_epi, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_RECURSIVE)
+    TRANSP(double complex, assert_malloc_al, free_al,
+           fill_rand_dcmplx, matrix_print_dcmplx,
+           transpose_dcmplx_recursive, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_MORTON)
+    TRANSP(double complex, assert_malloc_al, free_al,
+           fill_rand_dcmplx, matrix_print_dcmplx,
+           transpose_dcmplx_morton, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_HILBERT)
+    TRANSP(double complex, assert_malloc_al, free_al,
+           fill_rand_dcmplx, matrix_print_dcmplx,
+           transpose_dcmplx_hilbert, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_TLB)
+    TRANSP_TLB(double complex, assert_malloc_al, free_al,
+               fill_rand_dcmplx, matrix_print_dcmplx,
+               transpose_dcmplx_tlb, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRREC)
+    TRANSP_THREADED(double complex, assert_malloc_al, free_al,
+                    fill_rand_dcmplx, matrix_print_dcmplx,
+                    transpose_dcmplx_thrrec, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRMORTON)
+    TRANSP_THREADED(double complex, assert_malloc_al, free_al,
+                    fill_rand_dcmplx, matrix_print_dcmplx,
+                    transpose_dcmplx_thrmorton, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRHILBERT)
+    TRANSP_THREADED(double complex, assert_malloc_al, free_al,
+                    fill_rand_dcmplx, matrix_print_dcmplx,
+                    transpose_dcmplx_thrhilbert, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRTILE)
+    TRANSP_THREADED(double complex, assert_malloc_al, free_al,
+                    fill_rand_dcmplx, matrix_print_dcmplx,
+                    transpose_dcmplx_thrtile, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRNUMA)
+    TRANSP_THREADED_NUMA(double complex, assert_malloc_al, free_al,
+                         fill_rand_dcmplx, matrix_print_dcmplx,
+                         transpose_dcmplx_thrnuma, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_THRTLB)
+    TRANSP_THREADED_TLB(double complex, assert_malloc_al, free_al,
+                        fill_rand_dcmplx, matrix_print_dcmplx,
+                        transpose_dcmplx_thrtlb, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_RECURSIVE_AVX512_INTR)
+    TRANSP(double complex, assert_malloc_al, free_al,
+           fill_rand_dcmplx, matrix_print_dcmplx,
+           transpose_dcmplx_recursive_avx512_intr, is_eq_dcmplx);
+#elif defined(USE_DCMPLX_PLAN)
+    TRANSP_PLANNED(double complex, assert_malloc_al, free_al,
+                   fill_rand_dcmplx, matrix_print_dcmplx, transpose_plan_dcmplx,
+                   transpose_execute_dcmplx, is_eq_dcmplx);
 #elif defined(USE_FFTWF_NAIVE)
-    TRANSP(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-           fill_rand_fftwf, matrix_print_fftwf, transpose_fftwf_naive,
-           is_eq_fftwf);
+    TRANSP_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+              fill_rand_fftwf, matrix_print_fftwf, transpose_fftwf_naive_ld,
+              is_eq_fftwf);
 #elif defined(USE_FFTWF_BLOCKED)
-    TRANSP_BLOCKED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                   fill_rand_fftwf, matrix_print_fftwf,
-                   transpose_fftwf_blocked, is_eq_fftwf);
+    TRANSP_BLOCKED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                      fill_rand_fftwf, matrix_print_fftwf,
+                      transpose_fftwf_blocked_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_THRROW)
-    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                    fill_rand_fftwf, matrix_print_fftwf,
-                    transpose_fftwf_thrrow, is_eq_fftwf);
+    TRANSP_THREADED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_thrrow_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_THRCOL)
-    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                    fill_rand_fftwf, matrix_print_fftwf,
-                    transpose_fftwf_thrcol, is_eq_fftwf);
+    TRANSP_THREADED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_thrcol_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_THRROW_BLOCKED)
-    TRANSP_THREADED_BLOCKED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                            fill_rand_fftwf, matrix_print_fftwf,
-                            transpose_fftwf_thrrow_blocked, is_eq_fftwf);
+    TRANSP_THREADED_BLOCKED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                               fill_rand_fftwf, matrix_print_fftwf,
+                               transpose_fftwf_thrrow_blocked_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_THRCOL_BLOCKED)
-    TRANSP_THREADED_BLOCKED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                            fill_rand_fftwf, matrix_print_fftwf,
-                            transpose_fftwf_thrcol_blocked, is_eq_fftwf);
+    TRANSP_THREADED_BLOCKED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                               fill_rand_fftwf, matrix_print_fftwf,
+                               transpose_fftwf_thrcol_blocked_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_AVX512_INTR)
-    TRANSP(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-           fill_rand_fftwf, matrix_print_fftwf,
-           transpose_fftwf_avx512_intr, is_eq_fftwf);
+    TRANSP_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+              fill_rand_fftwf, matrix_print_fftwf,
+              transpose_fftwf_avx512_intr_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_THRROW_AVX512_INTR)
-    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                    fill_rand_fftwf, matrix_print_fftwf,
-                    transpose_fftwf_thrrow_avx512_intr, is_eq_fftwf);
+    TRANSP_THREADED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_thrrow_avx512_intr_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_THRCOL_AVX512_INTR)
-    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, fftwf_free,
-                    fill_rand_fftwf, matrix_print_fftwf,
-                    transpose_fftwf_thrcol_avx512_intr, is_eq_fftwf);
+    TRANSP_THREADED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_thrcol_avx512_intr_ld, is_eq_fftwf);
 #elif defined(USE_FFTWF_MKL)
-    TRANSP(fftwf_complex, assert_fftwf_malloc, fftwf_free,
+    TRANSP(fftwf_complex, assert_fftwf_malloc, free_fftwf,
            fill_rand_fftwf, matrix_print_fftwf,
            transpose_fftwf_mkl, is_eq_fftwf);
+#elif defined(USE_FFTWF_GURU)
+    TRANSP_GURU(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                fill_rand_fftwf, matrix_print_fftwf, transpose_fftwf_guru_plan,
+                fftwf_execute, fftwf_destroy_plan, is_eq_fftwf);
+#elif defined(USE_FFTWF_GURU_INPLACE)
+    TRANSP_GURU_INPLACE(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                        fill_rand_fftwf, matrix_print_fftwf,
+                        transpose_fftwf_guru_plan, fftwf_execute,
+                        fftwf_destroy_plan, is_eq_fftwf);
+#elif defined(USE_FFTWF_SQUARE_NAIVE)
+    TRANSP_SQUARE(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                  fill_rand_fftwf, matrix_print_fftwf,
+                  transpose_fftwf_square_naive, is_eq_fftwf);
+#elif defined(USE_FFTWF_SQUARE_BLOCKED)
+    TRANSP_SQUARE_BLOCKED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                          fill_rand_fftwf, matrix_print_fftwf,
+                          transpose_fftwf_square_blocked, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRROW_SQUARE)
+    TRANSP_SQUARE_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                           fill_rand_fftwf, matrix_print_fftwf,
+                           transpose_fftwf_thrrow_square, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRROW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_THREADED_BLOCKED(fftwf_complex, assert_fftwf_malloc,
+                                   free_fftwf,
+                                   fill_rand_fftwf, matrix_print_fftwf,
+                                   transpose_fftwf_thrrow_square_blocked,
+                                   is_eq_fftwf);
+#elif defined(USE_FFTWF_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                  fill_rand_fftwf, matrix_print_fftwf,
+                  transpose_fftwf_square_avx512_intr, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRROW_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                           fill_rand_fftwf, matrix_print_fftwf,
+                           transpose_fftwf_thrrow_square_avx512_intr,
+                           is_eq_fftwf);
+#elif defined(USE_FFTWF_INPLACE)
+    TRANSP_INPLACE(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                   fill_rand_fftwf, matrix_print_fftwf,
+                   transpose_fftwf_inplace, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRCYC_INPLACE)
+    TRANSP_INPLACE_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                            fill_rand_fftwf, matrix_print_fftwf,
+                            transpose_fftwf_thrcyc_inplace, is_eq_fftwf);
+#elif defined(USE_FFTWF_AVX2_INTR)
+    TRANSP_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+              fill_rand_fftwf, matrix_print_fftwf, transpose_fftwf_avx2_intr_ld,
+              is_eq_fftwf);
+#elif defined(USE_FFTWF_THRROW_AVX2_INTR)
+    TRANSP_THREADED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_thrrow_avx2_intr_ld, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRCOL_AVX2_INTR)
+    TRANSP_THREADED_LD(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_thrcol_avx2_intr_ld, is_eq_fftwf);
+#elif defined(USE_FFTWF_DISPATCH)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+           fill_rand_fftwf, matrix_print_fftwf, transpose_fftwf_dispatch,
+           is_eq_fftwf);
+#elif defined(USE_FFTWF_BATCH)
+    TRANSP_BATCH(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                 fill_rand_fftwf, matrix_print_fftwf,
+                 transpose_fftwf_batch, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRBATCH)
+    TRANSP_BATCH_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                          fill_rand_fftwf, matrix_print_fftwf,
+                          transpose_fftwf_thrbatch, is_eq_fftwf);
+#elif defined(USE_FFTWF_BATCH_AVX512_INTR)
+    TRANSP_BATCH(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                 fill_rand_fftwf, matrix_print_fftwf,
+                 transpose_fftwf_batch_avx512_intr, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRBATCH_AVX512_INTR)
+    TRANSP_BATCH_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                          fill_rand_fftwf, matrix_print_fftwf,
+                          transpose_fftwf_thrbatch_avx512_intr, is_eq_fftwf);
+#elif defined(USE_FFTWF_NAIVE_EPI)
+    TRANSP_EPI(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+               fill_rand_fftwf, matrix_print_fftwf,
+               transpose_fftwf_naive_epi, is_eq_fftwf);
+#elif defined(USE_FFTWF_BLOCKED_EPI)
+    TRANSP_BLOCKED_EPI(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                       fill_rand_fftwf, matrix_print_fftwf,
+                       transpose_fftwf_blocked_epi, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRROW_EPI)
+    TRANSP_THREADED_EPI(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                        fill_rand_fftwf, matrix_print_fftwf,
+                        transpose_fftwf_thrrow_epi, is_eq_fftwf);
+#elif defined(USE_FFTWF_AVX512_INTR_EPI)
+    TRANSP_EPI(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+               fill_rand_fftwf, matrix_print_fftwf,
+               transpose_fftwf_avx512_intr_epi, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRROW_AVX512_INTR_EPI)
+    TRANSP_THREADED_EPI(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                        fill_rand_fftwf, matrix_print_fftwf,
+                        transpose_fftwf_thrrow_avx512_intr_epi, is_eq_fftwf);
+#elif defined(USE_FFTWF_RECURSIVE)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+           fill_rand_fftwf, matrix_print_fftwf,
+           transpose_fftwf_recursive, is_eq_fftwf);
+#elif defined(USE_FFTWF_MORTON)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+           fill_rand_fftwf, matrix_print_fftwf,
+           transpose_fftwf_morton, is_eq_fftwf);
+#elif defined(USE_FFTWF_HILBERT)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+           fill_rand_fftwf, matrix_print_fftwf,
+           transpose_fftwf_hilbert, is_eq_fftwf);
+#elif defined(USE_FFTWF_TLB)
+    TRANSP_TLB(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+               fill_rand_fftwf, matrix_print_fftwf,
+               transpose_fftwf_tlb, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRREC)
+    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                    fill_rand_fftwf, matrix_print_fftwf,
+                    transpose_fftwf_thrrec, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRMORTON)
+    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                    fill_rand_fftwf, matrix_print_fftwf,
+                    transpose_fftwf_thrmorton, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRHILBERT)
+    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                    fill_rand_fftwf, matrix_print_fftwf,
+                    transpose_fftwf_thrhilbert, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRTILE)
+    TRANSP_THREADED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                    fill_rand_fftwf, matrix_print_fftwf,
+                    transpose_fftwf_thrtile, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRNUMA)
+    TRANSP_THREADED_NUMA(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                         fill_rand_fftwf, matrix_print_fftwf,
+                         transpose_fftwf_thrnuma, is_eq_fftwf);
+#elif defined(USE_FFTWF_THRTLB)
+    TRANSP_THREADED_TLB(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                        fill_rand_fftwf, matrix_print_fftwf,
+                        transpose_fftwf_thrtlb, is_eq_fftwf);
+#elif defined(USE_FFTWF_RECURSIVE_AVX512_INTR)
+    TRANSP(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+           fill_rand_fftwf, matrix_print_fftwf,
+           transpose_fftwf_recursive_avx512_intr, is_eq_fftwf);
+#elif defined(USE_FFTWF_PLAN)
+    TRANSP_PLANNED(fftwf_complex, assert_fftwf_malloc, free_fftwf,
+                   fill_rand_fftwf, matrix_print_fftwf, transpose_plan_fftwf,
+                   transpose_execute_fftwf, is_eq_fftwf);
 #elif defined(USE_FFTW_NAIVE)
-    TRANSP(fftw_complex, assert_fftw_malloc, fftw_free,
-           fill_rand_fftw, matrix_print_fftw, transpose_fftw_naive, is_eq_fftw);
+    TRANSP_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+              fill_rand_fftw, matrix_print_fftw, transpose_fftw_naive_ld,
+              is_eq_fftw);
 #elif defined(USE_FFTW_BLOCKED)
-    TRANSP_BLOCKED(fftw_complex, assert_fftw_malloc, fftw_free,
-                   fill_rand_fftw, matrix_print_fftw,
-                   transpose_fftw_blocked, is_eq_fftw);
+    TRANSP_BLOCKED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                      fill_rand_fftw, matrix_print_fftw,
+                      transpose_fftw_blocked_ld, is_eq_fftw);
 #elif defined(USE_FFTW_THRROW)
-    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, fftw_free,
-                    fill_rand_fftw, matrix_print_fftw,
-                    transpose_fftw_thrrow, is_eq_fftw);
+    TRANSP_THREADED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_thrrow_ld, is_eq_fftw);
 #elif defined(USE_FFTW_THRCOL)
-    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, fftw_free,
-                    fill_rand_fftw, matrix_print_fftw,
-                    transpose_fftw_thrcol, is_eq_fftw);
+    TRANSP_THREADED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_thrcol_ld, is_eq_fftw);
 #elif defined(USE_FFTW_THRROW_BLOCKED)
-    TRANSP_THREADED_BLOCKED(fftw_complex, assert_fftw_malloc, fftw_free,
-                            fill_rand_fftw, matrix_print_fftw,
-                            transpose_fftw_thrrow_blocked, is_eq_fftw);
+    TRANSP_THREADED_BLOCKED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                               fill_rand_fftw, matrix_print_fftw,
+                               transpose_fftw_thrrow_blocked_ld, is_eq_fftw);
 #elif defined(USE_FFTW_THRCOL_BLOCKED)
-    TRANSP_THREADED_BLOCKED(fftw_complex, assert_fftw_malloc, fftw_free,
-                            fill_rand_fftw, matrix_print_fftw,
-                            transpose_fftw_thrcol_blocked, is_eq_fftw);
+    TRANSP_THREADED_BLOCKED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                               fill_rand_fftw, matrix_print_fftw,
+                               transpose_fftw_thrcol_blocked_ld, is_eq_fftw);
 #elif defined(USE_FFTW_MKL)
-    TRANSP(fftw_complex, assert_fftw_malloc, fftw_free,
+    TRANSP(fftw_complex, assert_fftw_malloc, free_fftw,
            fill_rand_fftw, matrix_print_fftw, transpose_fftw_mkl, is_eq_fftw);
+#elif defined(USE_FFTW_GURU)
+    TRANSP_GURU(fftw_complex, assert_fftw_malloc, free_fftw,
+                fill_rand_fftw, matrix_print_fftw, transpose_fftw_guru_plan,
+                fftw_execute, fftw_destroy_plan, is_eq_fftw);
+#elif defined(USE_FFTW_GURU_INPLACE)
+    TRANSP_GURU_INPLACE(fftw_complex, assert_fftw_malloc, free_fftw,
+                        fill_rand_fftw, matrix_print_fftw,
+                        transpose_fftw_guru_plan, fftw_execute,
+                        fftw_destroy_plan, is_eq_fftw);
+#elif defined(USE_FFTW_SQUARE_NAIVE)
+    TRANSP_SQUARE(fftw_complex, assert_fftw_malloc, free_fftw,
+                  fill_rand_fftw, matrix_print_fftw,
+                  transpose_fftw_square_naive, is_eq_fftw);
+#elif defined(USE_FFTW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_BLOCKED(fftw_complex, assert_fftw_malloc, free_fftw,
+                          fill_rand_fftw, matrix_print_fftw,
+                          transpose_fftw_square_blocked, is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_SQUARE)
+    TRANSP_SQUARE_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                           fill_rand_fftw, matrix_print_fftw,
+                           transpose_fftw_thrrow_square, is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_SQUARE_BLOCKED)
+    TRANSP_SQUARE_THREADED_BLOCKED(fftw_complex, assert_fftw_malloc, free_fftw,
+                                   fill_rand_fftw, matrix_print_fftw,
+                                   transpose_fftw_thrrow_square_blocked,
+                                   is_eq_fftw);
+#elif defined(USE_FFTW_INPLACE)
+    TRANSP_INPLACE(fftw_complex, assert_fftw_malloc, free_fftw,
+                   fill_rand_fftw, matrix_print_fftw,
+                   transpose_fftw_inplace, is_eq_fftw);
+#elif defined(USE_FFTW_THRCYC_INPLACE)
+    TRANSP_INPLACE_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                            fill_rand_fftw, matrix_print_fftw,
+                            transpose_fftw_thrcyc_inplace, is_eq_fftw);
+#elif defined(USE_FFTW_AVX512_INTR)
+    TRANSP_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+              fill_rand_fftw, matrix_print_fftw, transpose_fftw_avx512_intr_ld,
+              is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_AVX512_INTR)
+    TRANSP_THREADED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_thrrow_avx512_intr_ld, is_eq_fftw);
+#elif defined(USE_FFTW_THRCOL_AVX512_INTR)
+    TRANSP_THREADED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_thrcol_avx512_intr_ld, is_eq_fftw);
+#elif defined(USE_FFTW_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE(fftw_complex, assert_fftw_malloc, free_fftw,
+                  fill_rand_fftw, matrix_print_fftw,
+                  transpose_fftw_square_avx512_intr, is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_SQUARE_AVX512_INTR)
+    TRANSP_SQUARE_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                           fill_rand_fftw, matrix_print_fftw,
+                           transpose_fftw_thrrow_square_avx512_intr,
+                           is_eq_fftw);
+#elif defined(USE_FFTW_AVX2_INTR)
+    TRANSP_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+              fill_rand_fftw, matrix_print_fftw, transpose_fftw_avx2_intr_ld,
+              is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_AVX2_INTR)
+    TRANSP_THREADED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_thrrow_avx2_intr_ld, is_eq_fftw);
+#elif defined(USE_FFTW_THRCOL_AVX2_INTR)
+    TRANSP_THREADED_LD(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_thrcol_avx2_intr_ld, is_eq_fftw);
+#elif defined(USE_FFTW_DISPATCH)
+    TRANSP(fftw_complex, assert_fftw_malloc, free_fftw,
+           fill_rand_fftw, matrix_print_fftw, transpose_fftw_dispatch,
+           is_eq_fftw);
+#elif defined(USE_FFTW_BATCH)
+    TRANSP_BATCH(fftw_complex, assert_fftw_malloc, free_fftw,
+                 fill_rand_fftw, matrix_print_fftw,
+                 transpose_fftw_batch, is_eq_fftw);
+#elif defined(USE_FFTW_THRBATCH)
+    TRANSP_BATCH_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                          fill_rand_fftw, matrix_print_fftw,
+                          transpose_fftw_thrbatch, is_eq_fftw);
+#elif defined(USE_FFTW_BATCH_AVX512_INTR)
+    TRANSP_BATCH(fftw_complex, assert_fftw_malloc, free_fftw,
+                 fill_rand_fftw, matrix_print_fftw,
+                 transpose_fftw_batch_avx512_intr, is_eq_fftw);
+#elif defined(USE_FFTW_THRBATCH_AVX512_INTR)
+    TRANSP_BATCH_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                          fill_rand_fftw, matrix_print_fftw,
+                          transpose_fftw_thrbatch_avx512_intr, is_eq_fftw);
+#elif defined(USE_FFTW_NAIVE_EPI)
+    TRANSP_EPI(fftw_complex, assert_fftw_malloc, free_fftw,
+               fill_rand_fftw, matrix_print_fftw,
+               transpose_fftw_naive_epi, is_eq_fftw);
+#elif defined(USE_FFTW_BLOCKED_EPI)
+    TRANSP_BLOCKED_EPI(fftw_complex, assert_fftw_malloc, free_fftw,
+                       fill_rand_fftw, matrix_print_fftw,
+                       transpose_fftw_blocked_epi, is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_EPI)
+    TRANSP_THREADED_EPI(fftw_complex, assert_fftw_malloc, free_fftw,
+                        fill_rand_fftw, matrix_print_fftw,
+                        transpose_fftw_thrrow_epi, is_eq_fftw);
+#elif defined(USE_FFTW_AVX512_INTR_EPI)
+    TRANSP_EPI(fftw_complex, assert_fftw_malloc, free_fftw,
+               fill_rand_fftw, matrix_print_fftw,
+               transpose_fftw_avx512_intr_epi, is_eq_fftw);
+#elif defined(USE_FFTW_THRROW_AVX512_INTR_EPI)
+    TRANSP_THREADED_EPI(fftw_complex, assert_fftw_malloc, free_fftw,
+                        fill_rand_fftw, matrix_print_fftw,
+                        transpose_fftw_thrrow_avx512_intr_epi, is_eq_fftw);
+#elif defined(USE_FFTW_RECURSIVE)
+    TRANSP(fftw_complex, assert_fftw_malloc, free_fftw,
+           fill_rand_fftw, matrix_print_fftw,
+           transpose_fftw_recursive, is_eq_fftw);
+#elif defined(USE_FFTW_MORTON)
+    TRANSP(fftw_complex, assert_fftw_malloc, free_fftw,
+           fill_rand_fftw, matrix_print_fftw,
+           transpose_fftw_morton, is_eq_fftw);
+#elif defined(USE_FFTW_HILBERT)
+    TRANSP(fftw_complex, assert_fftw_malloc, free_fftw,
+           fill_rand_fftw, matrix_print_fftw,
+           transpose_fftw_hilbert, is_eq_fftw);
+#elif defined(USE_FFTW_TLB)
+    TRANSP_TLB(fftw_complex, assert_fftw_malloc, free_fftw,
+               fill_rand_fftw, matrix_print_fftw,
+               transpose_fftw_tlb, is_eq_fftw);
+#elif defined(USE_FFTW_THRREC)
+    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                    fill_rand_fftw, matrix_print_fftw,
+                    transpose_fftw_thrrec, is_eq_fftw);
+#elif defined(USE_FFTW_THRMORTON)
+    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                    fill_rand_fftw, matrix_print_fftw,
+                    transpose_fftw_thrmorton, is_eq_fftw);
+#elif defined(USE_FFTW_THRHILBERT)
+    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                    fill_rand_fftw, matrix_print_fftw,
+                    transpose_fftw_thrhilbert, is_eq_fftw);
+#elif defined(USE_FFTW_THRTILE)
+    TRANSP_THREADED(fftw_complex, assert_fftw_malloc, free_fftw,
+                    fill_rand_fftw, matrix_print_fftw,
+                    transpose_fftw_thrtile, is_eq_fftw);
+#elif defined(USE_FFTW_THRNUMA)
+    TRANSP_THREADED_NUMA(fftw_complex, assert_fftw_malloc, free_fftw,
+                         fill_rand_fftw, matrix_print_fftw,
+                         transpose_fftw_thrnuma, is_eq_fftw);
+#elif defined(USE_FFTW_THRTLB)
+    TRANSP_THREADED_TLB(fftw_complex, assert_fftw_malloc, free_fftw,
+                        fill_rand_fftw, matrix_print_fftw,
+                        transpose_fftw_thrtlb, is_eq_fftw);
+#elif defined(USE_FFTW_RECURSIVE_AVX512_INTR)
+    TRANSP(fftw_complex, assert_fftw_malloc, free_fftw,
+           fill_rand_fftw, matrix_print_fftw,
+           transpose_fftw_recursive_avx512_intr, is_eq_fftw);
+#elif defined(USE_FFTW_PLAN)
+    TRANSP_PLANNED(fftw_complex, assert_fftw_malloc, free_fftw,
+                   fill_rand_fftw, matrix_print_fftw, transpose_plan_fftw,
+                   transpose_execute_fftw, is_eq_fftw);
 #elif defined(USE_FLT_MKL)
-    TRANSP(float, assert_malloc_al, free,
+    TRANSP(float, assert_malloc_al, free_al,
            fill_rand_flt, matrix_print_flt, transpose_flt_mkl, is_eq_flt);
 #elif defined(USE_DBL_MKL)
-    TRANSP(double, assert_malloc_al, free,
+    TRANSP(double, assert_malloc_al, free_al,
            fill_rand_dbl, matrix_print_dbl, transpose_dbl_mkl, is_eq_dbl);
 #elif defined(USE_CMPLX8_MKL)
-    TRANSP(MKL_Complex8, assert_malloc_al, free,
+    TRANSP(MKL_Complex8, assert_malloc_al, free_al,
            fill_rand_cmplx8, matrix_print_cmplx8, transpose_cmplx8_mkl,
            is_eq_cmplx8);
 #elif defined(USE_CMPLX16_MKL)
-    TRANSP(MKL_Complex16, assert_malloc_al, free,
+    TRANSP(MKL_Complex16, assert_malloc_al, free_al,
            fill_rand_cmplx16, matrix_print_cmplx16, transpose_cmplx16_mkl,
            is_eq_cmplx16);
 #else
@@ -5,118 +5,294 @@
  * @author Connor Imes <cimes@isi.edu>
  * @date 2019-08-07
  */
-#undef NDEBUG
-#include <assert.h>
+#include <complex.h>
 #include <stdlib.h>
 
 // intrinsics
 #include <immintrin.h>
 
 #include "transpose-avx.h"
+#include "tile-order.h"
+#include "transpose-avx512-kernels.h"
+
+// recursive transposes stop at regions of at most this many tiles on a side
+#define TRANSPOSE_REC_TILES 4
+
+/* transpose each region visited by a tile traversal */
+struct tr_region_arg {
+    const void* restrict A;
+    void* restrict B;
+    size_t A_rows, A_cols;
+};
+
+static void transpose_region_flt(void *ctx, size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    const float* restrict A = (const float* restrict)arg->A;
+    float* restrict B = (float* restrict)arg->B;
+    TRANSPOSE_AVX512_TILES(__m512, 16, load_16x16_ps, load_16x16_ps_mask,
+                           transpose_16x16_ps, store_16x16_ps,
+                           store_16x16_ps_mask, A, B, arg->A_rows, arg->A_cols,
+                           arg->A_cols, arg->A_rows,
+                           r_min, r_max, c_min, c_max);
+}
+
+static void transpose_region_dbl(void *ctx, size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    const double* restrict A = (const double* restrict)arg->A;
+    double* restrict B = (double* restrict)arg->B;
+    TRANSPOSE_AVX512_TILES(__m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                           transpose_8x8_pd, store_8x8_pd, store_8x8_pd_mask,
+                           A, B, arg->A_rows, arg->A_cols,
+                           arg->A_cols, arg->A_rows,
+                           r_min, r_max, c_min, c_max);
+}
+
+static void transpose_region_dcmplx(void *ctx, size_t r_min, size_t r_max,
+                                    size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    const double complex* restrict A = (const double complex* restrict)arg->A;
+    double complex* restrict B = (double complex* restrict)arg->B;
+    TRANSPOSE_AVX512_TILES(__m512d, 4, load_4x4_cpd, load_4x4_cpd_mask,
+                           transpose_4x4_cpd, store_4x4_cpd,
+                           store_4x4_cpd_mask, A, B, arg->A_rows, arg->A_cols,
+                           arg->A_cols, arg->A_rows,
+                           r_min, r_max, c_min, c_max);
+}
+
+/*
+ * This function uses intrinsics to transpose 16x16 blocks of floats.
+ * Matrices whose sizes are not multiples of 16 are transposed with masked
+ * loads and stores, which are slower and do not use streaming stores.
+ */
+void transpose_flt_avx512_intr(const float* restrict A, float* restrict B,
+                               size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX512_TILES(__m512, 16, load_16x16_ps, load_16x16_ps_mask,
+                           transpose_16x16_ps, store_16x16_ps,
+                           store_16x16_ps_mask, A, B, A_rows, A_cols,
+                           A_cols, A_rows, 0, A_rows, 0, A_cols);
+}
 
 /*
  * This function uses intrinsics to transpose an 8x8 block of doubles
- * using a recursive transpose algorithm.  It will not work correctly
- * unless both A_rows and A_cols are multiples of 8.
+ * using a recursive transpose algorithm.  Matrices whose sizes are not
+ * multiples of 8 are transposed with masked loads and stores, which are slower
+ * and do not use streaming stores.
  */
 void transpose_dbl_avx512_intr(const double* restrict A, double* restrict B,
                                size_t A_rows, size_t A_cols)
 {
-    // used for swapping 2x2 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_2x2_0 = {
-        0x0000, 0x0001, 0x0008, 0x0009, 0x0004, 0x0005, 0x000c, 0x000d
-    };
-    static const __m512i idx_2x2_1 = {
-        0x000a, 0x000b, 0x0002, 0x0003, 0x000e, 0x000f, 0x0006, 0x0007
-    };
-    // used for swapping 4x4 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_4x4_0 = {
-        0x0000, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x000a, 0x000b
-    };
-    static const __m512i idx_4x4_1 = {
-        0x000c, 0x000d, 0x000e, 0x000f, 0x0004, 0x0005, 0x0006, 0x0007
-    };
-    const size_t num_row_blocks = A_rows / 8;
-    const size_t num_col_blocks = A_cols / 8;
-    const double *A_block;
-    double *B_block;
-    size_t rblk_num, cblk_num, r_min, c_min;
-    // alternate the reads and writes between the r and s vector registers, all
-    // of which hold matrix rows
-    __m512d r[8], s[8];
-
-    assert(A_rows % 8 == 0);
-    assert(A_cols % 8 == 0);
-
-    // perform transpose over all blocks
-    for (rblk_num = 0; rblk_num < num_row_blocks; rblk_num++) {
-        r_min = rblk_num * 8;
-        for (cblk_num = 0; cblk_num < num_col_blocks; cblk_num++) {
-            c_min = cblk_num * 8;
-
-            A_block = &A[r_min * A_cols + c_min];
-            B_block = &B[c_min * A_rows + r_min];
-
-            // read 8x8 block of read array
-            r[0] = _mm512_load_pd(&A_block[0]);
-            r[1] = _mm512_load_pd(&A_block[A_cols]);
-            r[2] = _mm512_load_pd(&A_block[2*A_cols]);
-            r[3] = _mm512_load_pd(&A_block[3*A_cols]);
-            r[4] = _mm512_load_pd(&A_block[4*A_cols]);
-            r[5] = _mm512_load_pd(&A_block[5*A_cols]);
-            r[6] = _mm512_load_pd(&A_block[6*A_cols]);
-            r[7] = _mm512_load_pd(&A_block[7*A_cols]);
-
-            // shuffle doubles within 128-bit lanes
-            s[0] = _mm512_unpacklo_pd(r[0], r[1]);
-            s[1] = _mm512_unpackhi_pd(r[0], r[1]);
-            s[2] = _mm512_unpacklo_pd(r[2], r[3]);
-            s[3] = _mm512_unpackhi_pd(r[2], r[3]);
-            s[4] = _mm512_unpacklo_pd(r[4], r[5]);
-            s[5] = _mm512_unpackhi_pd(r[4], r[5]);
-            s[6] = _mm512_unpacklo_pd(r[6], r[7]);
-            s[7] = _mm512_unpackhi_pd(r[6], r[7]);
-
-            // shuffle 2x2 blocks of doubles
-            r[0] = _mm512_permutex2var_pd(s[0], idx_2x2_0, s[2]);
-            r[1] = _mm512_permutex2var_pd(s[1], idx_2x2_0, s[3]);
-            r[2] = _mm512_permutex2var_pd(s[2], idx_2x2_1, s[0]);
-            r[3] = _mm512_permutex2var_pd(s[3], idx_2x2_1, s[1]);
-            r[4] = _mm512_permutex2var_pd(s[4], idx_2x2_0, s[6]);
-            r[5] = _mm512_permutex2var_pd(s[5], idx_2x2_0, s[7]);
-            r[6] = _mm512_permutex2var_pd(s[6], idx_2x2_1, s[4]);
-            r[7] = _mm512_permutex2var_pd(s[7], idx_2x2_1, s[5]);
-
-            // shuffle 4x4 blocks of doubles
-            s[0] = _mm512_permutex2var_pd(r[0], idx_4x4_0, r[4]);
-            s[1] = _mm512_permutex2var_pd(r[1], idx_4x4_0, r[5]);
-            s[2] = _mm512_permutex2var_pd(r[2], idx_4x4_0, r[6]);
-            s[3] = _mm512_permutex2var_pd(r[3], idx_4x4_0, r[7]);
-            s[4] = _mm512_permutex2var_pd(r[4], idx_4x4_1, r[0]);
-            s[5] = _mm512_permutex2var_pd(r[5], idx_4x4_1, r[1]);
-            s[6] = _mm512_permutex2var_pd(r[6], idx_4x4_1, r[2]);
-            s[7] = _mm512_permutex2var_pd(r[7], idx_4x4_1, r[3]);
-
-            // write back 8x8 block of write array
-#if defined(USE_AVX_STREAMING_STORES)
-            _mm512_stream_pd(&B_block[0], s[0]);
-            _mm512_stream_pd(&B_block[A_rows], s[1]);
-            _mm512_stream_pd(&B_block[2*A_rows], s[2]);
-            _mm512_stream_pd(&B_block[3*A_rows], s[3]);
-            _mm512_stream_pd(&B_block[4*A_rows], s[4]);
-            _mm512_stream_pd(&B_block[5*A_rows], s[5]);
-            _mm512_stream_pd(&B_block[6*A_rows], s[6]);
-            _mm512_stream_pd(&B_block[7*A_rows], s[7]);
-#else
-            _mm512_store_pd(&B_block[0], s[0]);
-            _mm512_store_pd(&B_block[A_rows], s[1]);
-            _mm512_store_pd(&B_block[2*A_rows], s[2]);
-            _mm512_store_pd(&B_block[3*A_rows], s[3]);
-            _mm512_store_pd(&B_block[4*A_rows], s[4]);
-            _mm512_store_pd(&B_block[5*A_rows], s[5]);
-            _mm512_store_pd(&B_block[6*A_rows], s[6]);
-            _mm512_store_pd(&B_block[7*A_rows], s[7]);
-#endif
-        }
+    TRANSPOSE_AVX512_TILES(__m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                           transpose_8x8_pd, store_8x8_pd, store_8x8_pd_mask,
+                           A, B, A_rows, A_cols, A_cols, A_rows,
+                           0, A_rows, 0, A_cols);
+}
+
+/*
+ * In-place transpose of a square matrix: transpose each 8x8 block on the
+ * diagonal, and transpose and swap each block above the diagonal with its
+ * mirror block below the diagonal.  Edge blocks are masked unless n is a
+ * multiple of 8.
+ */
+void transpose_dbl_square_avx512_intr(double* A, size_t n)
+{
+    TRANSPOSE_AVX512_SQUARE_TILES(__m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                                  transpose_8x8_pd, store_8x8_pd,
+                                  store_8x8_pd_mask, A, n, 0, n);
+}
+
+/*
+ * This function uses intrinsics to transpose 4x4 blocks of double complex
+ * values.  Matrices whose sizes are not multiples of 4 are transposed with
+ * masked loads and stores, which are slower and do not use streaming stores.
+ */
+void transpose_dcmplx_avx512_intr(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX512_TILES(__m512d, 4, load_4x4_cpd, load_4x4_cpd_mask,
+                           transpose_4x4_cpd, store_4x4_cpd,
+                           store_4x4_cpd_mask, A, B, A_rows, A_cols,
+                           A_cols, A_rows, 0, A_rows, 0, A_cols);
+}
+
+/*
+ * In-place transpose of a square matrix of double complex values, by 4x4
+ * blocks as in transpose_dbl_square_avx512_intr().
+ */
+void transpose_dcmplx_square_avx512_intr(double complex* A, size_t n)
+{
+    TRANSPOSE_AVX512_SQUARE_TILES(__m512d, 4, load_4x4_cpd, load_4x4_cpd_mask,
+                                  transpose_4x4_cpd, store_4x4_cpd,
+                                  store_4x4_cpd_mask, A, n, 0, n);
+}
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.  Full tiles use aligned loads and stores only if the
+ * strides are also multiples of the tile size and A and B are 64-byte aligned,
+ * so A and B may be windows at any offset of larger matrices.
+ */
+void transpose_flt_avx512_intr_ld(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb)
+{
+    TRANSPOSE_AVX512_TILES(__m512, 16, load_16x16_ps, load_16x16_ps_mask,
+                           transpose_16x16_ps, store_16x16_ps,
+                           store_16x16_ps_mask, A, B, A_rows, A_cols,
+                           lda, ldb, 0, A_rows, 0, A_cols);
+}
+
+void transpose_dbl_avx512_intr_ld(const double* restrict A,
+                                  double* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb)
+{
+    TRANSPOSE_AVX512_TILES(__m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                           transpose_8x8_pd, store_8x8_pd, store_8x8_pd_mask,
+                           A, B, A_rows, A_cols, lda, ldb,
+                           0, A_rows, 0, A_cols);
+}
+
+void transpose_dcmplx_avx512_intr_ld(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb)
+{
+    TRANSPOSE_AVX512_TILES(__m512d, 4, load_4x4_cpd, load_4x4_cpd_mask,
+                           transpose_4x4_cpd, store_4x4_cpd,
+                           store_4x4_cpd_mask, A, B, A_rows, A_cols,
+                           lda, ldb, 0, A_rows, 0, A_cols);
+}
+
+/*
+ * Cache-oblivious transposes: recursively halve the longer dimension, at tile
+ * boundaries, until a region is small enough to transpose with the tile
+ * kernels above.
+ */
+void transpose_flt_recursive_avx512_intr(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, 16 * TRANSPOSE_REC_TILES, 16,
+                         &transpose_region_flt, &arg);
+}
+
+void transpose_dbl_recursive_avx512_intr(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, 8 * TRANSPOSE_REC_TILES, 8,
+                         &transpose_region_dbl, &arg);
+}
+
+void transpose_dcmplx_recursive_avx512_intr(const double complex* restrict A,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, 4 * TRANSPOSE_REC_TILES, 4,
+                         &transpose_region_dcmplx, &arg);
+}
+
+/*
+ * Batched transposes, as in transpose.h.  Matrices no larger than a vector
+ * that are stored back to back are transposed several at a time by permuting
+ * whole vectors; otherwise each matrix is transposed by tiles as above.
+ */
+void transpose_flt_batch_avx512_intr(const float* restrict A,
+                                     float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t count, size_t stride)
+{
+    size_t i;
+    if (TRANSPOSE_BATCH_PACKED(16, A_rows, A_cols, stride)) {
+        transpose_batch_packed_ps(A, B, A_rows, A_cols, count);
+        return;
     }
+    for (i = 0; i < count; i++) {
+        TRANSPOSE_AVX512_TILES(__m512, 16, load_16x16_ps, load_16x16_ps_mask,
+                               transpose_16x16_ps, store_16x16_ps,
+                               store_16x16_ps_mask,
+                               &A[i * stride], &B[i * stride], A_rows, A_cols,
+                               A_cols, A_rows, 0, A_rows, 0, A_cols);
+    }
+}
+
+void transpose_dbl_batch_avx512_intr(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t count, size_t stride)
+{
+    size_t i;
+    if (TRANSPOSE_BATCH_PACKED(8, A_rows, A_cols, stride)) {
+        transpose_batch_packed_pd(A, B, A_rows, A_cols, count);
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        TRANSPOSE_AVX512_TILES(__m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                               transpose_8x8_pd, store_8x8_pd,
+                               store_8x8_pd_mask,
+                               &A[i * stride], &B[i * stride], A_rows, A_cols,
+                               A_cols, A_rows, 0, A_rows, 0, A_cols);
+    }
+}
+
+void transpose_dcmplx_batch_avx512_intr(const double complex* restrict A,
+                                        double complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t count, size_t stride)
+{
+    size_t i;
+    if (TRANSPOSE_BATCH_PACKED(4, A_rows, A_cols, stride)) {
+        transpose_batch_packed_cpd(A, B, A_rows, A_cols, count);
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        TRANSPOSE_AVX512_TILES(__m512d, 4, load_4x4_cpd, load_4x4_cpd_mask,
+                               transpose_4x4_cpd, store_4x4_cpd,
+                               store_4x4_cpd_mask,
+                               &A[i * stride], &B[i * stride], A_rows, A_cols,
+                               A_cols, A_rows, 0, A_rows, 0, A_cols);
+    }
+}
+
+/*
+ * Transposes with a fused epilogue, for matrices with padded rows.
+ * float complex values are moved by the 8x8 double tile kernels, then scaled,
+ * conjugated, and multiplied by twiddle factors as pairs of floats.
+ */
+void transpose_fcmplx_avx512_intr_epi(const float complex* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb,
+                                      const transpose_epilogue *epi)
+{
+    const double* restrict a = (const double* restrict)A;
+    double* restrict b = (double* restrict)B;
+    TRANSPOSE_AVX512_TILES_EPI(__m512d, 8, 1, load_8x8_pd, load_8x8_pd_mask,
+                               transpose_8x8_pd, epilogue_init_cps,
+                               epilogue_cps, twiddle_cps, a, b,
+                               A_rows, A_cols, lda, ldb,
+                               0, A_rows, 0, A_cols, epi);
+}
+
+void transpose_dcmplx_avx512_intr_epi(const double complex* restrict A,
+                                      double complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb,
+                                      const transpose_epilogue *epi)
+{
+    TRANSPOSE_AVX512_TILES_EPI(__m512d, 4, 2, load_4x4_cpd, load_4x4_cpd_mask,
+                               transpose_4x4_cpd, epilogue_init_cpd,
+                               epilogue_cpd, twiddle_cpd, A, B,
+                               A_rows, A_cols, lda, ldb,
+                               0, A_rows, 0, A_cols, epi);
 }
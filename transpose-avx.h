@@ -8,9 +8,84 @@
 #ifndef TRANSPOSE_AVX_H
 #define TRANSPOSE_AVX_H
 
+#include <complex.h>
 #include <stdlib.h>
 
+#include "transpose-epilogue.h"
+
+void transpose_flt_avx512_intr(const float* restrict A, float* restrict B,
+                               size_t A_rows, size_t A_cols);
+
 void transpose_dbl_avx512_intr(const double* restrict A, double* restrict B,
                                size_t A_rows, size_t A_cols);
 
+void transpose_dbl_square_avx512_intr(double* A, size_t n);
+
+void transpose_dcmplx_avx512_intr(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols);
+
+void transpose_dcmplx_square_avx512_intr(double complex* A, size_t n);
+
+void transpose_flt_avx512_intr_ld(const float* restrict A, float* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb);
+
+void transpose_dbl_avx512_intr_ld(const double* restrict A,
+                                  double* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb);
+
+void transpose_dcmplx_avx512_intr_ld(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb);
+
+void transpose_flt_recursive_avx512_intr(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+void transpose_dbl_recursive_avx512_intr(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols);
+
+void transpose_dcmplx_recursive_avx512_intr(const double complex* restrict A,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols);
+
+/**
+ * Batched transposes, as in transpose.h.  Batches of matrices no larger than a
+ * vector that are stored back to back (stride = A_rows * A_cols) are
+ * vectorized across matrices.
+ */
+void transpose_flt_batch_avx512_intr(const float* restrict A,
+                                     float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t count, size_t stride);
+
+void transpose_dbl_batch_avx512_intr(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t count, size_t stride);
+
+void transpose_dcmplx_batch_avx512_intr(const double complex* restrict A,
+                                        double complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t count, size_t stride);
+
+/**
+ * Transposes with a fused epilogue, as in transpose.h.
+ */
+void transpose_fcmplx_avx512_intr_epi(const float complex* restrict A,
+                                      float complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb,
+                                      const transpose_epilogue *epi);
+
+void transpose_dcmplx_avx512_intr_epi(const double complex* restrict A,
+                                      double complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb,
+                                      const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_AVX_H */
@@ -0,0 +1,295 @@
+/**
+ * AVX2 register tile transpose kernels.
+ *
+ * Each kernel loads a square tile of rows with stride ld into 256-bit vector
+ * registers, transposes it in registers, and stores it with stride ld.
+ * Full tiles must be 32-byte aligned.  The masked variants load and store
+ * partial (or unaligned) tiles of nr rows and nc columns, so matrices of any
+ * size can be transposed: rows that are not loaded are zeroed and columns
+ * that are not loaded are masked off.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_AVX2_KERNELS_H
+#define TRANSPOSE_AVX2_KERNELS_H
+
+#include <complex.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// intrinsics
+#include <immintrin.h>
+
+// masks of the low n 64-bit or 32-bit lanes, for masked loads and stores
+static inline __m256i tile_mask_epi64(size_t n)
+{
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long) n),
+                              _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+static inline __m256i tile_mask_epi32(size_t n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32((int) n),
+                              _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+/*
+ * 4x4 doubles (or 64-bit float complex values)
+ */
+
+static inline void load_4x4_pd(__m256d r[4], const double *blk, size_t ld)
+{
+    r[0] = _mm256_load_pd(&blk[0]);
+    r[1] = _mm256_load_pd(&blk[ld]);
+    r[2] = _mm256_load_pd(&blk[2*ld]);
+    r[3] = _mm256_load_pd(&blk[3*ld]);
+}
+
+static inline void load_4x4_pd_mask(__m256d r[4], const double *blk, size_t ld,
+                                    size_t nr, size_t nc)
+{
+    const __m256i m = tile_mask_epi64(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        r[i] = _mm256_maskload_pd(&blk[i*ld], m);
+    }
+    for (; i < 4; i++) {
+        r[i] = _mm256_setzero_pd();
+    }
+}
+
+static inline void transpose_4x4_pd(__m256d r[4])
+{
+    __m256d s[4];
+
+    // shuffle doubles within 128-bit lanes
+    s[0] = _mm256_unpacklo_pd(r[0], r[1]);
+    s[1] = _mm256_unpackhi_pd(r[0], r[1]);
+    s[2] = _mm256_unpacklo_pd(r[2], r[3]);
+    s[3] = _mm256_unpackhi_pd(r[2], r[3]);
+
+    // shuffle 128-bit lanes
+    r[0] = _mm256_permute2f128_pd(s[0], s[2], 0x20);
+    r[1] = _mm256_permute2f128_pd(s[1], s[3], 0x20);
+    r[2] = _mm256_permute2f128_pd(s[0], s[2], 0x31);
+    r[3] = _mm256_permute2f128_pd(s[1], s[3], 0x31);
+}
+
+static inline void store_4x4_pd(double *blk, size_t ld, const __m256d r[4])
+{
+#if defined(USE_AVX_STREAMING_STORES)
+    _mm256_stream_pd(&blk[0], r[0]);
+    _mm256_stream_pd(&blk[ld], r[1]);
+    _mm256_stream_pd(&blk[2*ld], r[2]);
+    _mm256_stream_pd(&blk[3*ld], r[3]);
+#else
+    _mm256_store_pd(&blk[0], r[0]);
+    _mm256_store_pd(&blk[ld], r[1]);
+    _mm256_store_pd(&blk[2*ld], r[2]);
+    _mm256_store_pd(&blk[3*ld], r[3]);
+#endif
+}
+
+static inline void store_4x4_pd_mask(double *blk, size_t ld,
+                                     size_t nr, size_t nc, const __m256d r[4])
+{
+    const __m256i m = tile_mask_epi64(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        _mm256_maskstore_pd(&blk[i*ld], m, r[i]);
+    }
+}
+
+/*
+ * 8x8 floats
+ */
+
+static inline void load_8x8_ps(__m256 r[8], const float *blk, size_t ld)
+{
+    r[0] = _mm256_load_ps(&blk[0]);
+    r[1] = _mm256_load_ps(&blk[ld]);
+    r[2] = _mm256_load_ps(&blk[2*ld]);
+    r[3] = _mm256_load_ps(&blk[3*ld]);
+    r[4] = _mm256_load_ps(&blk[4*ld]);
+    r[5] = _mm256_load_ps(&blk[5*ld]);
+    r[6] = _mm256_load_ps(&blk[6*ld]);
+    r[7] = _mm256_load_ps(&blk[7*ld]);
+}
+
+static inline void load_8x8_ps_mask(__m256 r[8], const float *blk, size_t ld,
+                                    size_t nr, size_t nc)
+{
+    const __m256i m = tile_mask_epi32(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        r[i] = _mm256_maskload_ps(&blk[i*ld], m);
+    }
+    for (; i < 8; i++) {
+        r[i] = _mm256_setzero_ps();
+    }
+}
+
+static inline void transpose_8x8_ps(__m256 r[8])
+{
+    __m256 s[8];
+
+    // interleave pairs of rows within 128-bit lanes
+    s[0] = _mm256_unpacklo_ps(r[0], r[1]);
+    s[1] = _mm256_unpackhi_ps(r[0], r[1]);
+    s[2] = _mm256_unpacklo_ps(r[2], r[3]);
+    s[3] = _mm256_unpackhi_ps(r[2], r[3]);
+    s[4] = _mm256_unpacklo_ps(r[4], r[5]);
+    s[5] = _mm256_unpackhi_ps(r[4], r[5]);
+    s[6] = _mm256_unpacklo_ps(r[6], r[7]);
+    s[7] = _mm256_unpackhi_ps(r[6], r[7]);
+
+    // shuffle 2x2 blocks of floats within 128-bit lanes
+    r[0] = _mm256_shuffle_ps(s[0], s[2], _MM_SHUFFLE(1, 0, 1, 0));
+    r[1] = _mm256_shuffle_ps(s[0], s[2], _MM_SHUFFLE(3, 2, 3, 2));
+    r[2] = _mm256_shuffle_ps(s[1], s[3], _MM_SHUFFLE(1, 0, 1, 0));
+    r[3] = _mm256_shuffle_ps(s[1], s[3], _MM_SHUFFLE(3, 2, 3, 2));
+    r[4] = _mm256_shuffle_ps(s[4], s[6], _MM_SHUFFLE(1, 0, 1, 0));
+    r[5] = _mm256_shuffle_ps(s[4], s[6], _MM_SHUFFLE(3, 2, 3, 2));
+    r[6] = _mm256_shuffle_ps(s[5], s[7], _MM_SHUFFLE(1, 0, 1, 0));
+    r[7] = _mm256_shuffle_ps(s[5], s[7], _MM_SHUFFLE(3, 2, 3, 2));
+
+    // shuffle 128-bit lanes
+    s[0] = _mm256_permute2f128_ps(r[0], r[4], 0x20);
+    s[1] = _mm256_permute2f128_ps(r[1], r[5], 0x20);
+    s[2] = _mm256_permute2f128_ps(r[2], r[6], 0x20);
+    s[3] = _mm256_permute2f128_ps(r[3], r[7], 0x20);
+    s[4] = _mm256_permute2f128_ps(r[0], r[4], 0x31);
+    s[5] = _mm256_permute2f128_ps(r[1], r[5], 0x31);
+    s[6] = _mm256_permute2f128_ps(r[2], r[6], 0x31);
+    s[7] = _mm256_permute2f128_ps(r[3], r[7], 0x31);
+
+    r[0] = s[0];
+    r[1] = s[1];
+    r[2] = s[2];
+    r[3] = s[3];
+    r[4] = s[4];
+    r[5] = s[5];
+    r[6] = s[6];
+    r[7] = s[7];
+}
+
+static inline void store_8x8_ps(float *blk, size_t ld, const __m256 r[8])
+{
+#if defined(USE_AVX_STREAMING_STORES)
+    _mm256_stream_ps(&blk[0], r[0]);
+    _mm256_stream_ps(&blk[ld], r[1]);
+    _mm256_stream_ps(&blk[2*ld], r[2]);
+    _mm256_stream_ps(&blk[3*ld], r[3]);
+    _mm256_stream_ps(&blk[4*ld], r[4]);
+    _mm256_stream_ps(&blk[5*ld], r[5]);
+    _mm256_stream_ps(&blk[6*ld], r[6]);
+    _mm256_stream_ps(&blk[7*ld], r[7]);
+#else
+    _mm256_store_ps(&blk[0], r[0]);
+    _mm256_store_ps(&blk[ld], r[1]);
+    _mm256_store_ps(&blk[2*ld], r[2]);
+    _mm256_store_ps(&blk[3*ld], r[3]);
+    _mm256_store_ps(&blk[4*ld], r[4]);
+    _mm256_store_ps(&blk[5*ld], r[5]);
+    _mm256_store_ps(&blk[6*ld], r[6]);
+    _mm256_store_ps(&blk[7*ld], r[7]);
+#endif
+}
+
+static inline void store_8x8_ps_mask(float *blk, size_t ld,
+                                     size_t nr, size_t nc, const __m256 r[8])
+{
+    const __m256i m = tile_mask_epi32(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        _mm256_maskstore_ps(&blk[i*ld], m, r[i]);
+    }
+}
+
+/*
+ * 2x2 double complex values (each 128-bit lane holds one value)
+ */
+
+static inline void load_2x2_cpd(__m256d r[2], const double complex *blk,
+                                size_t ld)
+{
+    r[0] = _mm256_load_pd((const double *)&blk[0]);
+    r[1] = _mm256_load_pd((const double *)&blk[ld]);
+}
+
+static inline void load_2x2_cpd_mask(__m256d r[2], const double complex *blk,
+                                     size_t ld, size_t nr, size_t nc)
+{
+    const __m256i m = tile_mask_epi64(2 * nc);
+    r[0] = _mm256_maskload_pd((const double *)&blk[0], m);
+    r[1] = nr > 1 ? _mm256_maskload_pd((const double *)&blk[ld], m)
+                  : _mm256_setzero_pd();
+}
+
+static inline void transpose_2x2_cpd(__m256d r[2])
+{
+    const __m256d s0 = _mm256_permute2f128_pd(r[0], r[1], 0x20);
+    const __m256d s1 = _mm256_permute2f128_pd(r[0], r[1], 0x31);
+    r[0] = s0;
+    r[1] = s1;
+}
+
+static inline void store_2x2_cpd(double complex *blk, size_t ld,
+                                 const __m256d r[2])
+{
+#if defined(USE_AVX_STREAMING_STORES)
+    _mm256_stream_pd((double *)&blk[0], r[0]);
+    _mm256_stream_pd((double *)&blk[ld], r[1]);
+#else
+    _mm256_store_pd((double *)&blk[0], r[0]);
+    _mm256_store_pd((double *)&blk[ld], r[1]);
+#endif
+}
+
+static inline void store_2x2_cpd_mask(double complex *blk, size_t ld,
+                                      size_t nr, size_t nc, const __m256d r[2])
+{
+    const __m256i m = tile_mask_epi64(2 * nc);
+    _mm256_maskstore_pd((double *)&blk[0], m, r[0]);
+    if (nr > 1) {
+        _mm256_maskstore_pd((double *)&blk[ld], m, r[1]);
+    }
+}
+
+/*
+ * Transpose the n x n tiles of A in rows [r_min, r_max) and columns
+ * [c_min, c_max) into B, using the tile kernels for vector type vtype.
+ * lda and ldb are the row strides of A and B, in elements.
+ * r_min and c_min must be multiples of n.
+ * When A_rows, A_cols, lda, and ldb are multiples of n, and A and B are 32-byte
+ * aligned, every tile is full and aligned.
+ * Otherwise, every tile uses unaligned masked loads and stores, clipped to
+ * r_max and c_max, so neither the sizes nor the tile alignment matter.
+ */
+#define TRANSPOSE_AVX2_TILES(vtype, n, fn_load, fn_load_mask, fn_transp, \
+                             fn_store, fn_store_mask, A, B, A_rows, A_cols, \
+                             lda, ldb, r_min, r_max, c_min, c_max) { \
+    const int aligned = (A_rows) % (n) == 0 && (A_cols) % (n) == 0 && \
+                        (lda) % (n) == 0 && (ldb) % (n) == 0 && \
+                        ((uintptr_t) (A) | (uintptr_t) (B)) % 32 == 0; \
+    size_t r, c, nr, nc; \
+    vtype v[n]; \
+    for (r = (r_min); r < (r_max); r += (n)) { \
+        nr = (r_max) - r < (n) ? (r_max) - r : (n); \
+        for (c = (c_min); c < (c_max); c += (n)) { \
+            nc = (c_max) - c < (n) ? (c_max) - c : (n); \
+            if (aligned) { \
+                fn_load(v, &(A)[r * (lda) + c], lda); \
+                fn_transp(v); \
+                fn_store(&(B)[c * (ldb) + r], ldb, v); \
+            } else { \
+                fn_load_mask(v, &(A)[r * (lda) + c], lda, nr, nc); \
+                fn_transp(v); \
+                fn_store_mask(&(B)[c * (ldb) + r], ldb, nc, nr, v); \
+            } \
+        } \
+    } \
+}
+
+#endif /* TRANSPOSE_AVX2_KERNELS_H */
@@ -0,0 +1,105 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include "transpose-avx2.h"
+#include "transpose-avx2-kernels.h"
+
+/*
+ * Transpose 8x8 blocks of floats.  Partial tiles at the edges of matrices whose
+ * sizes aren't multiples of 8 are masked.
+ */
+void transpose_flt_avx2_intr(const float* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX2_TILES(__m256, 8, load_8x8_ps, load_8x8_ps_mask,
+                         transpose_8x8_ps, store_8x8_ps, store_8x8_ps_mask,
+                         A, B, A_rows, A_cols, A_cols, A_rows,
+                         0, A_rows, 0, A_cols);
+}
+
+/*
+ * Transpose 4x4 blocks of doubles, masking partial tiles.
+ */
+void transpose_dbl_avx2_intr(const double* restrict A, double* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX2_TILES(__m256d, 4, load_4x4_pd, load_4x4_pd_mask,
+                         transpose_4x4_pd, store_4x4_pd, store_4x4_pd_mask,
+                         A, B, A_rows, A_cols, A_cols, A_rows,
+                         0, A_rows, 0, A_cols);
+}
+
+/*
+ * A float complex value is 64 bits, so it can be moved as a double.
+ */
+void transpose_fcmplx_avx2_intr(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_avx2_intr((const double* restrict)A, (double* restrict)B,
+                            A_rows, A_cols);
+}
+
+/*
+ * Transpose 2x2 blocks of double complex values, masking partial tiles.
+ */
+void transpose_dcmplx_avx2_intr(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_AVX2_TILES(__m256d, 2, load_2x2_cpd, load_2x2_cpd_mask,
+                         transpose_2x2_cpd, store_2x2_cpd, store_2x2_cpd_mask,
+                         A, B, A_rows, A_cols, A_cols, A_rows,
+                         0, A_rows, 0, A_cols);
+}
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.  Unless the strides are also multiples of the tile size,
+ * and A and B 32-byte aligned, all tiles are masked.
+ */
+void transpose_flt_avx2_intr_ld(const float* restrict A, float* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb)
+{
+    TRANSPOSE_AVX2_TILES(__m256, 8, load_8x8_ps, load_8x8_ps_mask,
+                         transpose_8x8_ps, store_8x8_ps, store_8x8_ps_mask,
+                         A, B, A_rows, A_cols, lda, ldb,
+                         0, A_rows, 0, A_cols);
+}
+
+void transpose_dbl_avx2_intr_ld(const double* restrict A, double* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb)
+{
+    TRANSPOSE_AVX2_TILES(__m256d, 4, load_4x4_pd, load_4x4_pd_mask,
+                         transpose_4x4_pd, store_4x4_pd, store_4x4_pd_mask,
+                         A, B, A_rows, A_cols, lda, ldb,
+                         0, A_rows, 0, A_cols);
+}
+
+void transpose_fcmplx_avx2_intr_ld(const float complex* restrict A,
+                                   float complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t lda, size_t ldb)
+{
+    transpose_dbl_avx2_intr_ld((const double* restrict)A, (double* restrict)B,
+                               A_rows, A_cols, lda, ldb);
+}
+
+void transpose_dcmplx_avx2_intr_ld(const double complex* restrict A,
+                                   double complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t lda, size_t ldb)
+{
+    TRANSPOSE_AVX2_TILES(__m256d, 2, load_2x2_cpd, load_2x2_cpd_mask,
+                         transpose_2x2_cpd, store_2x2_cpd, store_2x2_cpd_mask,
+                         A, B, A_rows, A_cols, lda, ldb,
+                         0, A_rows, 0, A_cols);
+}
@@ -0,0 +1,49 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_AVX2_H
+#define TRANSPOSE_AVX2_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+void transpose_flt_avx2_intr(const float* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols);
+
+void transpose_dbl_avx2_intr(const double* restrict A, double* restrict B,
+                             size_t A_rows, size_t A_cols);
+
+void transpose_fcmplx_avx2_intr(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+void transpose_dcmplx_avx2_intr(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.
+ */
+void transpose_flt_avx2_intr_ld(const float* restrict A, float* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb);
+
+void transpose_dbl_avx2_intr_ld(const double* restrict A, double* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb);
+
+void transpose_fcmplx_avx2_intr_ld(const float complex* restrict A,
+                                   float complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t lda, size_t ldb);
+
+void transpose_dcmplx_avx2_intr_ld(const double complex* restrict A,
+                                   double complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t lda, size_t ldb);
+
+#endif /* TRANSPOSE_AVX2_H */
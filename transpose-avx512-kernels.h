@@ -0,0 +1,686 @@
+/**
+ * AVX-512 register tile transpose kernels.
+ *
+ * Each kernel loads a square tile of rows with stride ld into 512-bit vector
+ * registers, transposes it in registers, and stores it with stride ld.
+ * Full tiles must be 64-byte aligned.  The masked variants load and store
+ * partial (or unaligned) tiles of nr rows and nc columns, so matrices of any
+ * size can be transposed: rows that are not loaded are zeroed and columns
+ * that are not loaded are masked off.
+ *
+ * @author Kaushik Datta <kdatta@isi.edu>
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_AVX512_KERNELS_H
+#define TRANSPOSE_AVX512_KERNELS_H
+
+#include <complex.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// intrinsics
+#include <immintrin.h>
+
+#include "transpose-epilogue.h"
+
+// mask of the low n (<= 16) bits, for masked loads and stores of n elements
+#define TILE_MASK(n) ((1u << (n)) - 1)
+
+// used for swapping 2x2 blocks using _mm512_permutex2var_pd()
+static const __m512i idx_2x2_0 = {
+    0x0000, 0x0001, 0x0008, 0x0009, 0x0004, 0x0005, 0x000c, 0x000d
+};
+static const __m512i idx_2x2_1 = {
+    0x000a, 0x000b, 0x0002, 0x0003, 0x000e, 0x000f, 0x0006, 0x0007
+};
+// used for swapping 4x4 blocks using _mm512_permutex2var_pd()
+static const __m512i idx_4x4_0 = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x000a, 0x000b
+};
+static const __m512i idx_4x4_1 = {
+    0x000c, 0x000d, 0x000e, 0x000f, 0x0004, 0x0005, 0x0006, 0x0007
+};
+
+/*
+ * 8x8 doubles (or 64-bit float complex values)
+ */
+
+// read 8x8 block of doubles with a row stride of ld
+static inline void load_8x8_pd(__m512d r[8], const double *blk, size_t ld)
+{
+    r[0] = _mm512_load_pd(&blk[0]);
+    r[1] = _mm512_load_pd(&blk[ld]);
+    r[2] = _mm512_load_pd(&blk[2*ld]);
+    r[3] = _mm512_load_pd(&blk[3*ld]);
+    r[4] = _mm512_load_pd(&blk[4*ld]);
+    r[5] = _mm512_load_pd(&blk[5*ld]);
+    r[6] = _mm512_load_pd(&blk[6*ld]);
+    r[7] = _mm512_load_pd(&blk[7*ld]);
+}
+
+// read nr x nc block of doubles with a row stride of ld, zeroing the rest
+static inline void load_8x8_pd_mask(__m512d r[8], const double *blk, size_t ld,
+                                    size_t nr, size_t nc)
+{
+    const __mmask8 m = TILE_MASK(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        r[i] = _mm512_maskz_loadu_pd(m, &blk[i*ld]);
+    }
+    for (; i < 8; i++) {
+        r[i] = _mm512_setzero_pd();
+    }
+}
+
+/*
+ * Transpose an 8x8 block of doubles held in vector registers using a recursive
+ * transpose algorithm, alternating between the r and s registers.
+ */
+static inline void transpose_8x8_pd(__m512d r[8])
+{
+    __m512d s[8];
+
+    // shuffle doubles within 128-bit lanes
+    s[0] = _mm512_unpacklo_pd(r[0], r[1]);
+    s[1] = _mm512_unpackhi_pd(r[0], r[1]);
+    s[2] = _mm512_unpacklo_pd(r[2], r[3]);
+    s[3] = _mm512_unpackhi_pd(r[2], r[3]);
+    s[4] = _mm512_unpacklo_pd(r[4], r[5]);
+    s[5] = _mm512_unpackhi_pd(r[4], r[5]);
+    s[6] = _mm512_unpacklo_pd(r[6], r[7]);
+    s[7] = _mm512_unpackhi_pd(r[6], r[7]);
+
+    // shuffle 2x2 blocks of doubles
+    r[0] = _mm512_permutex2var_pd(s[0], idx_2x2_0, s[2]);
+    r[1] = _mm512_permutex2var_pd(s[1], idx_2x2_0, s[3]);
+    r[2] = _mm512_permutex2var_pd(s[2], idx_2x2_1, s[0]);
+    r[3] = _mm512_permutex2var_pd(s[3], idx_2x2_1, s[1]);
+    r[4] = _mm512_permutex2var_pd(s[4], idx_2x2_0, s[6]);
+    r[5] = _mm512_permutex2var_pd(s[5], idx_2x2_0, s[7]);
+    r[6] = _mm512_permutex2var_pd(s[6], idx_2x2_1, s[4]);
+    r[7] = _mm512_permutex2var_pd(s[7], idx_2x2_1, s[5]);
+
+    // shuffle 4x4 blocks of doubles
+    s[0] = _mm512_permutex2var_pd(r[0], idx_4x4_0, r[4]);
+    s[1] = _mm512_permutex2var_pd(r[1], idx_4x4_0, r[5]);
+    s[2] = _mm512_permutex2var_pd(r[2], idx_4x4_0, r[6]);
+    s[3] = _mm512_permutex2var_pd(r[3], idx_4x4_0, r[7]);
+    s[4] = _mm512_permutex2var_pd(r[4], idx_4x4_1, r[0]);
+    s[5] = _mm512_permutex2var_pd(r[5], idx_4x4_1, r[1]);
+    s[6] = _mm512_permutex2var_pd(r[6], idx_4x4_1, r[2]);
+    s[7] = _mm512_permutex2var_pd(r[7], idx_4x4_1, r[3]);
+
+    r[0] = s[0];
+    r[1] = s[1];
+    r[2] = s[2];
+    r[3] = s[3];
+    r[4] = s[4];
+    r[5] = s[5];
+    r[6] = s[6];
+    r[7] = s[7];
+}
+
+// write back 8x8 block of doubles with a row stride of ld
+static inline void store_8x8_pd(double *blk, size_t ld, const __m512d r[8])
+{
+#if defined(USE_AVX_STREAMING_STORES)
+    _mm512_stream_pd(&blk[0], r[0]);
+    _mm512_stream_pd(&blk[ld], r[1]);
+    _mm512_stream_pd(&blk[2*ld], r[2]);
+    _mm512_stream_pd(&blk[3*ld], r[3]);
+    _mm512_stream_pd(&blk[4*ld], r[4]);
+    _mm512_stream_pd(&blk[5*ld], r[5]);
+    _mm512_stream_pd(&blk[6*ld], r[6]);
+    _mm512_stream_pd(&blk[7*ld], r[7]);
+#else
+    _mm512_store_pd(&blk[0], r[0]);
+    _mm512_store_pd(&blk[ld], r[1]);
+    _mm512_store_pd(&blk[2*ld], r[2]);
+    _mm512_store_pd(&blk[3*ld], r[3]);
+    _mm512_store_pd(&blk[4*ld], r[4]);
+    _mm512_store_pd(&blk[5*ld], r[5]);
+    _mm512_store_pd(&blk[6*ld], r[6]);
+    _mm512_store_pd(&blk[7*ld], r[7]);
+#endif
+}
+
+// write back nr x nc block of doubles with a row stride of ld
+static inline void store_8x8_pd_mask(double *blk, size_t ld,
+                                     size_t nr, size_t nc, const __m512d r[8])
+{
+    const __mmask8 m = TILE_MASK(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        _mm512_mask_storeu_pd(&blk[i*ld], m, r[i]);
+    }
+}
+
+/*
+ * 16x16 floats
+ */
+
+// read 16x16 block of floats with a row stride of ld
+static inline void load_16x16_ps(__m512 r[16], const float *blk, size_t ld)
+{
+    size_t i;
+    for (i = 0; i < 16; i++) {
+        r[i] = _mm512_load_ps(&blk[i*ld]);
+    }
+}
+
+// read nr x nc block of floats with a row stride of ld, zeroing the rest
+static inline void load_16x16_ps_mask(__m512 r[16], const float *blk,
+                                      size_t ld, size_t nr, size_t nc)
+{
+    const __mmask16 m = TILE_MASK(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        r[i] = _mm512_maskz_loadu_ps(m, &blk[i*ld]);
+    }
+    for (; i < 16; i++) {
+        r[i] = _mm512_setzero_ps();
+    }
+}
+
+/*
+ * Transpose a 16x16 block of floats held in vector registers: interleave
+ * floats, then pairs of floats, within 128-bit lanes, then shuffle 128-bit
+ * lanes twice, alternating between the r and s registers.
+ */
+static inline void transpose_16x16_ps(__m512 r[16])
+{
+    __m512 s[16];
+    size_t i;
+
+    // shuffle floats within 128-bit lanes
+    for (i = 0; i < 16; i += 2) {
+        s[i] = _mm512_unpacklo_ps(r[i], r[i+1]);
+        s[i+1] = _mm512_unpackhi_ps(r[i], r[i+1]);
+    }
+
+    // shuffle pairs of floats within 128-bit lanes, leaving 4x4 blocks
+    for (i = 0; i < 16; i += 4) {
+        const __m512d a = _mm512_castps_pd(s[i]);
+        const __m512d b = _mm512_castps_pd(s[i+1]);
+        const __m512d c = _mm512_castps_pd(s[i+2]);
+        const __m512d d = _mm512_castps_pd(s[i+3]);
+        r[i] = _mm512_castpd_ps(_mm512_unpacklo_pd(a, c));
+        r[i+1] = _mm512_castpd_ps(_mm512_unpackhi_pd(a, c));
+        r[i+2] = _mm512_castpd_ps(_mm512_unpacklo_pd(b, d));
+        r[i+3] = _mm512_castpd_ps(_mm512_unpackhi_pd(b, d));
+    }
+
+    // shuffle even and odd 128-bit lanes of rows 4 apart
+    for (i = 0; i < 4; i++) {
+        s[i] = _mm512_shuffle_f32x4(r[i], r[i+4], 0x88);
+        s[i+4] = _mm512_shuffle_f32x4(r[i], r[i+4], 0xdd);
+        s[i+8] = _mm512_shuffle_f32x4(r[i+8], r[i+12], 0x88);
+        s[i+12] = _mm512_shuffle_f32x4(r[i+8], r[i+12], 0xdd);
+    }
+
+    // shuffle even and odd 128-bit lanes of rows 8 apart
+    for (i = 0; i < 4; i++) {
+        r[i] = _mm512_shuffle_f32x4(s[i], s[i+8], 0x88);
+        r[i+8] = _mm512_shuffle_f32x4(s[i], s[i+8], 0xdd);
+        r[i+4] = _mm512_shuffle_f32x4(s[i+4], s[i+12], 0x88);
+        r[i+12] = _mm512_shuffle_f32x4(s[i+4], s[i+12], 0xdd);
+    }
+}
+
+// write back 16x16 block of floats with a row stride of ld
+static inline void store_16x16_ps(float *blk, size_t ld, const __m512 r[16])
+{
+    size_t i;
+    for (i = 0; i < 16; i++) {
+#if defined(USE_AVX_STREAMING_STORES)
+        _mm512_stream_ps(&blk[i*ld], r[i]);
+#else
+        _mm512_store_ps(&blk[i*ld], r[i]);
+#endif
+    }
+}
+
+// write back nr x nc block of floats with a row stride of ld
+static inline void store_16x16_ps_mask(float *blk, size_t ld,
+                                       size_t nr, size_t nc,
+                                       const __m512 r[16])
+{
+    const __mmask16 m = TILE_MASK(nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        _mm512_mask_storeu_ps(&blk[i*ld], m, r[i]);
+    }
+}
+
+/*
+ * 4x4 double complex values (each 128-bit lane holds one value)
+ */
+
+// read 4x4 block of double complex values with a row stride of ld
+static inline void load_4x4_cpd(__m512d r[4], const double complex *blk,
+                                size_t ld)
+{
+    r[0] = _mm512_load_pd((const double *)&blk[0]);
+    r[1] = _mm512_load_pd((const double *)&blk[ld]);
+    r[2] = _mm512_load_pd((const double *)&blk[2*ld]);
+    r[3] = _mm512_load_pd((const double *)&blk[3*ld]);
+}
+
+// read nr x nc block of double complex values with a row stride of ld,
+// zeroing the rest (each value is a pair of doubles)
+static inline void load_4x4_cpd_mask(__m512d r[4], const double complex *blk,
+                                     size_t ld, size_t nr, size_t nc)
+{
+    const __mmask8 m = TILE_MASK(2 * nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        r[i] = _mm512_maskz_loadu_pd(m, (const double *)&blk[i*ld]);
+    }
+    for (; i < 4; i++) {
+        r[i] = _mm512_setzero_pd();
+    }
+}
+
+/*
+ * Transpose a 4x4 block of double complex values held in vector registers.
+ * Each value fills a 128-bit lane, so only whole lanes are shuffled: first
+ * 2x2 blocks of lanes between pairs of rows, then single lanes.
+ */
+static inline void transpose_4x4_cpd(__m512d r[4])
+{
+    __m512d s[4];
+
+    // shuffle low and high pairs of lanes
+    s[0] = _mm512_shuffle_f64x2(r[0], r[1], 0x44);
+    s[1] = _mm512_shuffle_f64x2(r[0], r[1], 0xee);
+    s[2] = _mm512_shuffle_f64x2(r[2], r[3], 0x44);
+    s[3] = _mm512_shuffle_f64x2(r[2], r[3], 0xee);
+
+    // shuffle even and odd lanes
+    r[0] = _mm512_shuffle_f64x2(s[0], s[2], 0x88);
+    r[1] = _mm512_shuffle_f64x2(s[0], s[2], 0xdd);
+    r[2] = _mm512_shuffle_f64x2(s[1], s[3], 0x88);
+    r[3] = _mm512_shuffle_f64x2(s[1], s[3], 0xdd);
+}
+
+// write back 4x4 block of double complex values with a row stride of ld
+static inline void store_4x4_cpd(double complex *blk, size_t ld,
+                                 const __m512d r[4])
+{
+#if defined(USE_AVX_STREAMING_STORES)
+    _mm512_stream_pd((double *)&blk[0], r[0]);
+    _mm512_stream_pd((double *)&blk[ld], r[1]);
+    _mm512_stream_pd((double *)&blk[2*ld], r[2]);
+    _mm512_stream_pd((double *)&blk[3*ld], r[3]);
+#else
+    _mm512_store_pd((double *)&blk[0], r[0]);
+    _mm512_store_pd((double *)&blk[ld], r[1]);
+    _mm512_store_pd((double *)&blk[2*ld], r[2]);
+    _mm512_store_pd((double *)&blk[3*ld], r[3]);
+#endif
+}
+
+// write back nr x nc block of double complex values with a row stride of ld
+static inline void store_4x4_cpd_mask(double complex *blk, size_t ld,
+                                      size_t nr, size_t nc,
+                                      const __m512d r[4])
+{
+    const __mmask8 m = TILE_MASK(2 * nc);
+    size_t i;
+    for (i = 0; i < nr; i++) {
+        _mm512_mask_storeu_pd((double *)&blk[i*ld], m, r[i]);
+    }
+}
+
+/*
+ * Transpose the n x n tiles of A in rows [r_min, r_max) and columns
+ * [c_min, c_max) into B, using the tile kernels for vector type vtype.
+ * lda and ldb are the row strides of A and B, in elements.
+ * r_min and c_min must be multiples of n.
+ * When A_rows, A_cols, lda, and ldb are multiples of n, and A and B are 64-byte
+ * aligned, every tile is full and aligned.
+ * Otherwise, every tile uses unaligned masked loads and stores, clipped to
+ * r_max and c_max, so neither the sizes nor the tile alignment matter.
+ */
+#define TRANSPOSE_AVX512_TILES(vtype, n, fn_load, fn_load_mask, fn_transp, \
+                               fn_store, fn_store_mask, A, B, A_rows, A_cols, \
+                               lda, ldb, r_min, r_max, c_min, c_max) { \
+    const int aligned = (A_rows) % (n) == 0 && (A_cols) % (n) == 0 && \
+                        (lda) % (n) == 0 && (ldb) % (n) == 0 && \
+                        ((uintptr_t) (A) | (uintptr_t) (B)) % 64 == 0; \
+    size_t r, c, nr, nc; \
+    vtype v[n]; \
+    for (r = (r_min); r < (r_max); r += (n)) { \
+        nr = (r_max) - r < (n) ? (r_max) - r : (n); \
+        for (c = (c_min); c < (c_max); c += (n)) { \
+            nc = (c_max) - c < (n) ? (c_max) - c : (n); \
+            if (aligned) { \
+                fn_load(v, &(A)[r * (lda) + c], lda); \
+                fn_transp(v); \
+                fn_store(&(B)[c * (ldb) + r], ldb, v); \
+            } else { \
+                fn_load_mask(v, &(A)[r * (lda) + c], lda, nr, nc); \
+                fn_transp(v); \
+                fn_store_mask(&(B)[c * (ldb) + r], ldb, nc, nr, v); \
+            } \
+        } \
+    } \
+}
+
+/*
+ * In-place transpose of the n x n tiles of the N x N matrix A in block rows
+ * [r_min, r_max) of the upper triangle (including the diagonal): transpose each
+ * diagonal tile, and transpose and swap each tile above the diagonal with its
+ * mirror tile below the diagonal.  r_min must be a multiple of n.
+ * Like TRANSPOSE_AVX512_TILES, tiles are masked unless N is a multiple of n.
+ */
+#define TRANSPOSE_AVX512_SQUARE_TILES(vtype, n, fn_load, fn_load_mask, \
+                                      fn_transp, fn_store, fn_store_mask, \
+                                      A, N, r_min, r_max) { \
+    const int aligned = (N) % (n) == 0; \
+    size_t r, c, nr, nc; \
+    vtype v[n], w[n]; \
+    for (r = (r_min); r < (r_max); r += (n)) { \
+        nr = (N) - r < (n) ? (N) - r : (n); \
+        /* diagonal tile */ \
+        if (aligned) { \
+            fn_load(v, &(A)[r * (N) + r], N); \
+            fn_transp(v); \
+            fn_store(&(A)[r * (N) + r], N, v); \
+        } else { \
+            fn_load_mask(v, &(A)[r * (N) + r], N, nr, nr); \
+            fn_transp(v); \
+            fn_store_mask(&(A)[r * (N) + r], N, nr, nr, v); \
+        } \
+        /* pairs of mirrored tiles */ \
+        for (c = r + (n); c < (N); c += (n)) { \
+            nc = (N) - c < (n) ? (N) - c : (n); \
+            if (aligned) { \
+                fn_load(v, &(A)[r * (N) + c], N); \
+                fn_load(w, &(A)[c * (N) + r], N); \
+                fn_transp(v); \
+                fn_transp(w); \
+                fn_store(&(A)[c * (N) + r], N, v); \
+                fn_store(&(A)[r * (N) + c], N, w); \
+            } else { \
+                fn_load_mask(v, &(A)[r * (N) + c], N, nr, nc); \
+                fn_load_mask(w, &(A)[c * (N) + r], N, nc, nr); \
+                fn_transp(v); \
+                fn_transp(w); \
+                fn_store_mask(&(A)[c * (N) + r], N, nc, nr, v); \
+                fn_store_mask(&(A)[r * (N) + c], N, nr, nc, w); \
+            } \
+        } \
+    } \
+}
+
+/*
+ * Fused epilogues (see transpose-epilogue.h) for complex values.  The scale
+ * factor is broadcast once into s: its real part in s[0], imaginary in s[1].
+ * Values are double complex pairs of doubles ("cpd"), or float complex pairs
+ * of floats that the 8x8 double kernels move as single doubles ("cps").
+ */
+static inline void epilogue_init_cpd(__m512d s[2],
+                                     const transpose_epilogue *epi)
+{
+    s[0] = _mm512_set1_pd(creal(epi->scale));
+    s[1] = _mm512_set1_pd(cimag(epi->scale));
+}
+
+static inline void epilogue_init_cps(__m512d s[2],
+                                     const transpose_epilogue *epi)
+{
+    s[0] = _mm512_castps_pd(_mm512_set1_ps((float) creal(epi->scale)));
+    s[1] = _mm512_castps_pd(_mm512_set1_ps((float) cimag(epi->scale)));
+}
+
+// (re, im) * (sr, si) = (re * sr - im * si, im * sr + re * si)
+static inline __m512d epilogue_cpd(__m512d v, const __m512d s[2], int conj)
+{
+    if (conj) {
+        v = _mm512_mask_sub_pd(v, 0xaa, _mm512_setzero_pd(), v);
+    }
+    return _mm512_fmaddsub_pd(v, s[0],
+                              _mm512_mul_pd(_mm512_permute_pd(v, 0x55), s[1]));
+}
+
+static inline __m512d epilogue_cps(__m512d v, const __m512d s[2], int conj)
+{
+    __m512 w = _mm512_castpd_ps(v);
+    if (conj) {
+        w = _mm512_mask_sub_ps(w, 0xaaaa, _mm512_setzero_ps(), w);
+    }
+    w = _mm512_fmaddsub_ps(w, _mm512_castpd_ps(s[0]),
+                           _mm512_mul_ps(_mm512_permute_ps(w, 0xb1),
+                                         _mm512_castpd_ps(s[1])));
+    return _mm512_castps_pd(w);
+}
+
+// complex products of vectors of interleaved values, as above
+static inline __m512d cmul_cpd(__m512d a, __m512d b)
+{
+    return _mm512_fmaddsub_pd(a, _mm512_movedup_pd(b),
+                              _mm512_mul_pd(_mm512_permute_pd(a, 0x55),
+                                            _mm512_permute_pd(b, 0xff)));
+}
+
+static inline __m512d cmul_cps(__m512d a, __m512d b)
+{
+    const __m512 x = _mm512_castpd_ps(a);
+    const __m512 y = _mm512_castpd_ps(b);
+    return _mm512_castps_pd(
+        _mm512_fmaddsub_ps(x, _mm512_moveldup_ps(y),
+                           _mm512_mul_ps(_mm512_permute_ps(x, 0xb1),
+                                         _mm512_movehdup_ps(y))));
+}
+
+/*
+ * Twiddle factors (see transpose-twiddle.h) for nr consecutive rows of A,
+ * starting at row r, in column c, i.e., for a transposed row of a tile.
+ * Values are w doubles wide, so vector lane l holds half (w = 2) or all (w = 1)
+ * of the factor for row r + l / w.  On the fly, the lanes' exponents
+ * k = (r + l / w) * c are computed exactly with 32x32-bit multiplies, and the
+ * table values are gathered.
+ */
+static inline __m512d twiddle_pd(const transpose_twiddle *tw, size_t A_rows,
+                                 size_t r, size_t c, size_t nr, size_t w,
+                                 __m512d (*fn_cmul)(__m512d, __m512d))
+{
+    const __mmask8 m = TILE_MASK(nr * w);
+    const __m512i lane = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i part = w == 2 ? _mm512_and_epi64(lane, _mm512_set1_epi64(1))
+                                : _mm512_setzero_si512();
+    const __m512i rows = w == 2 ? _mm512_srli_epi64(lane, 1) : lane;
+    const __m512i mask = _mm512_set1_epi64(((size_t) 1 << tw->lo_bits) - 1);
+    __m512i k, lo, hi;
+    if (tw->full) {
+        return _mm512_maskz_loadu_pd(m,
+            &((const double *)tw->full)[(c * A_rows + r) * w]);
+    }
+    k = _mm512_mul_epu32(_mm512_add_epi64(_mm512_set1_epi64(r), rows),
+                         _mm512_set1_epi64(c));
+    lo = _mm512_and_epi64(k, mask);
+    hi = _mm512_srli_epi64(k, tw->lo_bits);
+    if (w == 2) {
+        lo = _mm512_add_epi64(_mm512_slli_epi64(lo, 1), part);
+        hi = _mm512_add_epi64(_mm512_slli_epi64(hi, 1), part);
+    }
+    return fn_cmul(
+        _mm512_mask_i64gather_pd(_mm512_setzero_pd(), m, lo, tw->lo, 8),
+        _mm512_mask_i64gather_pd(_mm512_setzero_pd(), m, hi, tw->hi, 8));
+}
+
+static inline __m512d twiddle_cpd(__m512d v, const transpose_twiddle *tw,
+                                  size_t A_rows, size_t r, size_t c, size_t nr)
+{
+    return cmul_cpd(v, twiddle_pd(tw, A_rows, r, c, nr, 2, cmul_cpd));
+}
+
+static inline __m512d twiddle_cps(__m512d v, const transpose_twiddle *tw,
+                                  size_t A_rows, size_t r, size_t c, size_t nr)
+{
+    return cmul_cps(v, twiddle_pd(tw, A_rows, r, c, nr, 1, cmul_cps));
+}
+
+/*
+ * Store the first cnt values of v, each w doubles wide, at column col of a row
+ * of cols values, wrapping around to the start of the row.
+ */
+static inline void store_row_wrap_pd(double *row, size_t cols, size_t col,
+                                     size_t cnt, size_t w, __m512d v)
+{
+    const size_t k = cols - col < cnt ? cols - col : cnt;
+    _mm512_mask_storeu_pd(&row[col * w], TILE_MASK(k * w), v);
+    if (k < cnt) {
+        v = _mm512_maskz_compress_pd((__mmask8) ~TILE_MASK(k * w), v);
+        _mm512_mask_storeu_pd(row, TILE_MASK((cnt - k) * w), v);
+    }
+}
+
+/*
+ * As TRANSPOSE_AVX512_TILES, applying an epilogue to each transposed row of a
+ * tile before storing it to its (shifted) row of B.  Shifted rows may wrap
+ * around or start anywhere, so stores are always unaligned and masked.
+ * Values are w doubles wide and B is addressed as rows of doubles.
+ */
+#define TRANSPOSE_AVX512_TILES_EPI(vtype, n, w, fn_load, fn_load_mask, \
+                                   fn_transp, fn_epi_init, fn_epi, fn_tw, \
+                                   A, B, A_rows, A_cols, lda, ldb, \
+                                   r_min, r_max, c_min, c_max, epi) { \
+    const int aligned = (A_rows) % (n) == 0 && (A_cols) % (n) == 0 && \
+                        (lda) % (n) == 0 && (uintptr_t) (A) % 64 == 0; \
+    const size_t rs = (epi)->row_shift % (A_cols); \
+    const size_t cs = (epi)->col_shift % (A_rows); \
+    size_t r, c, nr, nc, j, br, bc; \
+    vtype v[n]; \
+    vtype s[2]; \
+    vtype x; \
+    fn_epi_init(s, epi); \
+    for (r = (r_min); r < (r_max); r += (n)) { \
+        nr = (r_max) - r < (n) ? (r_max) - r : (n); \
+        bc = (r + cs) % (A_rows); \
+        for (c = (c_min); c < (c_max); c += (n)) { \
+            nc = (c_max) - c < (n) ? (c_max) - c : (n); \
+            if (aligned) { \
+                fn_load(v, &(A)[r * (lda) + c], lda); \
+            } else { \
+                fn_load_mask(v, &(A)[r * (lda) + c], lda, nr, nc); \
+            } \
+            fn_transp(v); \
+            br = (c + rs) % (A_cols); \
+            for (j = 0; j < nc; j++) { \
+                x = fn_epi(v[j], s, (epi)->conj); \
+                if ((epi)->tw) { \
+                    x = fn_tw(x, (epi)->tw, A_rows, r, c + j, nr); \
+                } \
+                store_row_wrap_pd((double *)&(B)[br * (ldb)], A_rows, bc, \
+                                  nr, w, x); \
+                if (++br == (A_cols)) { \
+                    br = 0; \
+                } \
+            } \
+        } \
+    } \
+}
+
+/*
+ * Batches of matrices no larger than a vector: when the matrices are stored
+ * back to back and each has a number of elements that divides the n elements
+ * of a vector, every vector holds whole matrices, so one permutation of the
+ * vector transposes them all.  Element j of the output takes the element of
+ * its matrix at row p % A_rows and column p / A_rows, where p is j's position
+ * within its matrix.
+ */
+#define TRANSPOSE_BATCH_PACKED(n, A_rows, A_cols, stride) \
+    ((stride) && (stride) == (A_rows) * (A_cols) && (n) % (stride) == 0)
+
+static inline size_t batch_packed_src(size_t j, size_t rows, size_t cols)
+{
+    const size_t p = j % (rows * cols);
+    return j - p + (p % rows) * cols + p / rows;
+}
+
+// transpose count rows x cols matrices of floats, stored back to back
+static inline void transpose_batch_packed_ps(const float *A, float *B,
+                                             size_t rows, size_t cols,
+                                             size_t count)
+{
+    const size_t len = rows * cols * count;
+    int32_t idx[16];
+    __m512i v_idx;
+    __m512 v;
+    __mmask16 m;
+    size_t i;
+    for (i = 0; i < 16; i++) {
+        idx[i] = (int32_t) batch_packed_src(i, rows, cols);
+    }
+    v_idx = _mm512_loadu_si512(idx);
+    for (i = 0; i + 16 <= len; i += 16) {
+        v = _mm512_loadu_ps(&A[i]);
+        _mm512_storeu_ps(&B[i], _mm512_permutexvar_ps(v_idx, v));
+    }
+    if (i < len) {
+        m = TILE_MASK(len - i);
+        v = _mm512_maskz_loadu_ps(m, &A[i]);
+        _mm512_mask_storeu_ps(&B[i], m, _mm512_permutexvar_ps(v_idx, v));
+    }
+}
+
+// transpose count rows x cols matrices of doubles, stored back to back
+static inline void transpose_batch_packed_pd(const double *A, double *B,
+                                             size_t rows, size_t cols,
+                                             size_t count)
+{
+    const size_t len = rows * cols * count;
+    int64_t idx[8];
+    __m512i v_idx;
+    __m512d v;
+    __mmask8 m;
+    size_t i;
+    for (i = 0; i < 8; i++) {
+        idx[i] = (int64_t) batch_packed_src(i, rows, cols);
+    }
+    v_idx = _mm512_loadu_si512(idx);
+    for (i = 0; i + 8 <= len; i += 8) {
+        v = _mm512_loadu_pd(&A[i]);
+        _mm512_storeu_pd(&B[i], _mm512_permutexvar_pd(v_idx, v));
+    }
+    if (i < len) {
+        m = TILE_MASK(len - i);
+        v = _mm512_maskz_loadu_pd(m, &A[i]);
+        _mm512_mask_storeu_pd(&B[i], m, _mm512_permutexvar_pd(v_idx, v));
+    }
+}
+
+// transpose count rows x cols matrices of double complex values, stored back
+// to back (each value is a pair of doubles, which move together)
+static inline void transpose_batch_packed_cpd(const double complex *A,
+                                              double complex *B,
+                                              size_t rows, size_t cols,
+                                              size_t count)
+{
+    const double *a = (const double *)A;
+    double *b = (double *)B;
+    const size_t len = 2 * rows * cols * count;
+    int64_t idx[8];
+    __m512i v_idx;
+    __m512d v;
+    __mmask8 m;
+    size_t i;
+    for (i = 0; i < 8; i++) {
+        idx[i] = (int64_t) (2 * batch_packed_src(i / 2, rows, cols) + i % 2);
+    }
+    v_idx = _mm512_loadu_si512(idx);
+    for (i = 0; i + 8 <= len; i += 8) {
+        v = _mm512_loadu_pd(&a[i]);
+        _mm512_storeu_pd(&b[i], _mm512_permutexvar_pd(v_idx, v));
+    }
+    if (i < len) {
+        m = TILE_MASK(len - i);
+        v = _mm512_maskz_loadu_pd(m, &a[i]);
+        _mm512_mask_storeu_pd(&b[i], m, _mm512_permutexvar_pd(v_idx, v));
+    }
+}
+
+#endif /* TRANSPOSE_AVX512_KERNELS_H */
@@ -0,0 +1,251 @@
+/**
+ * Transpose functions with runtime CPU feature dispatch.
+ *
+ * Kernels for each instruction set are compiled separately with their own
+ * target flags; this file must be compiled for the baseline target so that it
+ * runs everywhere.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "transpose.h"
+#include "transpose-avx.h"
+#include "transpose-avx2.h"
+#include "transpose-dispatch.h"
+#include "transpose-sse2.h"
+
+// block size for the scalar fallback
+#define TRANSPOSE_DISPATCH_BLK 32
+
+enum transpose_isa {
+    TRANSPOSE_ISA_SCALAR = 0,
+    TRANSPOSE_ISA_SSE2,
+    TRANSPOSE_ISA_AVX2,
+    TRANSPOSE_ISA_AVX512,
+};
+
+static const char *isa_names[] = {
+    "scalar", "sse2", "avx2", "avx512"
+};
+
+static enum transpose_isa isa_max = TRANSPOSE_ISA_SCALAR;
+
+#if defined(__x86_64__) || defined(__i386__)
+// XCR0 bits for OS-enabled SSE/AVX and AVX-512 register state
+#define XCR0_SSE_AVX 0x06
+#define XCR0_AVX512  0xe0
+
+static uint64_t xgetbv0(void)
+{
+    uint32_t eax, edx;
+    // "xgetbv" opcode, so we don't need compiler flags that enable XSAVE
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t) edx << 32) | eax;
+}
+
+/*
+ * The AVX2 and AVX-512 kernels are compiled for Haswell and Skylake-AVX512,
+ * respectively, so the compiler may use other instructions from those targets.
+ * Require the features those targets imply, not just AVX2 and AVX512F.
+ */
+static enum transpose_isa detect_isa(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    uint64_t xcr0;
+    int has_fma;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(edx & bit_SSE2)) {
+        return TRANSPOSE_ISA_SCALAR;
+    }
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) {
+        return TRANSPOSE_ISA_SSE2;
+    }
+    has_fma = (ecx & bit_FMA) != 0;
+    xcr0 = xgetbv0();
+    if ((xcr0 & XCR0_SSE_AVX) != XCR0_SSE_AVX ||
+        !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) ||
+        !(ebx & bit_AVX2) || !(ebx & bit_BMI) || !(ebx & bit_BMI2) ||
+        !has_fma) {
+        return TRANSPOSE_ISA_SSE2;
+    }
+    if ((xcr0 & XCR0_AVX512) != XCR0_AVX512 ||
+        !(ebx & bit_AVX512F) || !(ebx & bit_AVX512DQ) ||
+        !(ebx & bit_AVX512BW) || !(ebx & bit_AVX512VL)) {
+        return TRANSPOSE_ISA_AVX2;
+    }
+    return TRANSPOSE_ISA_AVX512;
+}
+#else
+static enum transpose_isa detect_isa(void)
+{
+    return TRANSPOSE_ISA_SCALAR;
+}
+#endif
+
+__attribute__((constructor))
+static void transpose_dispatch_init(void)
+{
+    const char *env = getenv("TRANSPOSE_ISA");
+    size_t i;
+    isa_max = detect_isa();
+    if (env) {
+        for (i = 0; i < sizeof(isa_names) / sizeof(isa_names[0]); i++) {
+            if (!strcmp(env, isa_names[i])) {
+                break;
+            }
+        }
+        if (i == sizeof(isa_names) / sizeof(isa_names[0])) {
+            fprintf(stderr, "TRANSPOSE_ISA: unknown value: %s\n", env);
+        } else if (i > isa_max) {
+            fprintf(stderr, "TRANSPOSE_ISA: %s not supported, using %s\n",
+                    env, isa_names[isa_max]);
+        } else {
+            isa_max = i;
+        }
+    }
+}
+
+const char *transpose_dispatch_isa(void)
+{
+    return isa_names[isa_max];
+}
+
+int transpose_dispatch_has_isa(const char *isa)
+{
+    size_t i;
+    for (i = 0; i <= isa_max; i++) {
+        if (!strcmp(isa, isa_names[i])) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Kernel tables, in order of preference.
+ * A kernel is usable if the CPU supports it, the matrix dimensions are
+ * multiples of its tile size, and both matrices are suitably aligned.
+ * The AVX-512 kernels mask their edge tiles, so they accept any dimensions.
+ * The scalar kernel at the end of each table is always usable.
+ */
+#define TRANSPOSE_KERNEL_T(datatype) struct { \
+    enum transpose_isa isa; \
+    size_t tile; \
+    size_t align; \
+    void (*fn)(const datatype* restrict, datatype* restrict, size_t, size_t); \
+}
+
+#define TRANSPOSE_DISPATCH(kernels, A, B, A_rows, A_cols) { \
+    size_t i; \
+    for (i = 0; ; i++) { \
+        if (kernels[i].isa <= isa_max && \
+            (A_rows) % kernels[i].tile == 0 && \
+            (A_cols) % kernels[i].tile == 0 && \
+            ((uintptr_t) (A) | (uintptr_t) (B)) % kernels[i].align == 0) { \
+            kernels[i].fn(A, B, A_rows, A_cols); \
+            break; \
+        } \
+    } \
+}
+
+static void transpose_flt_scalar(const float* restrict A, float* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    transpose_flt_blocked(A, B, A_rows, A_cols,
+                          TRANSPOSE_DISPATCH_BLK, TRANSPOSE_DISPATCH_BLK);
+}
+
+static void transpose_dbl_scalar(const double* restrict A, double* restrict B,
+                                 size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_blocked(A, B, A_rows, A_cols,
+                          TRANSPOSE_DISPATCH_BLK, TRANSPOSE_DISPATCH_BLK);
+}
+
+static void transpose_fcmplx_scalar(const float complex* restrict A,
+                                    float complex* restrict B,
+                                    size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_blocked(A, B, A_rows, A_cols,
+                             TRANSPOSE_DISPATCH_BLK, TRANSPOSE_DISPATCH_BLK);
+}
+
+static void transpose_dcmplx_scalar(const double complex* restrict A,
+                                    double complex* restrict B,
+                                    size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_blocked(A, B, A_rows, A_cols,
+                             TRANSPOSE_DISPATCH_BLK, TRANSPOSE_DISPATCH_BLK);
+}
+
+// a float complex value is 64 bits, so it can be moved as a double
+static void transpose_fcmplx_avx512_intr(const float complex* restrict A,
+                                         float complex* restrict B,
+                                         size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_avx512_intr((const double* restrict)A, (double* restrict)B,
+                              A_rows, A_cols);
+}
+
+static const TRANSPOSE_KERNEL_T(float) kernels_flt[] = {
+    { TRANSPOSE_ISA_AVX512, 1, 64, transpose_flt_avx512_intr },
+    { TRANSPOSE_ISA_AVX2,   8, 32, transpose_flt_avx2_intr },
+    { TRANSPOSE_ISA_SSE2,   4, 16, transpose_flt_sse2_intr },
+    { TRANSPOSE_ISA_SCALAR, 1,  1, transpose_flt_scalar },
+};
+
+static const TRANSPOSE_KERNEL_T(double) kernels_dbl[] = {
+    { TRANSPOSE_ISA_AVX512, 1, 64, transpose_dbl_avx512_intr },
+    { TRANSPOSE_ISA_AVX2,   4, 32, transpose_dbl_avx2_intr },
+    { TRANSPOSE_ISA_SSE2,   2, 16, transpose_dbl_sse2_intr },
+    { TRANSPOSE_ISA_SCALAR, 1,  1, transpose_dbl_scalar },
+};
+
+static const TRANSPOSE_KERNEL_T(float complex) kernels_fcmplx[] = {
+    { TRANSPOSE_ISA_AVX512, 1, 64, transpose_fcmplx_avx512_intr },
+    { TRANSPOSE_ISA_AVX2,   4, 32, transpose_fcmplx_avx2_intr },
+    { TRANSPOSE_ISA_SSE2,   2, 16, transpose_fcmplx_sse2_intr },
+    { TRANSPOSE_ISA_SCALAR, 1,  1, transpose_fcmplx_scalar },
+};
+
+static const TRANSPOSE_KERNEL_T(double complex) kernels_dcmplx[] = {
+    { TRANSPOSE_ISA_AVX512, 1, 64, transpose_dcmplx_avx512_intr },
+    { TRANSPOSE_ISA_AVX2,   2, 32, transpose_dcmplx_avx2_intr },
+    { TRANSPOSE_ISA_SSE2,   1, 16, transpose_dcmplx_sse2_intr },
+    { TRANSPOSE_ISA_SCALAR, 1,  1, transpose_dcmplx_scalar },
+};
+
+void transpose_flt_dispatch(const float* restrict A, float* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_DISPATCH(kernels_flt, A, B, A_rows, A_cols);
+}
+
+void transpose_dbl_dispatch(const double* restrict A, double* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_DISPATCH(kernels_dbl, A, B, A_rows, A_cols);
+}
+
+void transpose_fcmplx_dispatch(const float complex* restrict A,
+                               float complex* restrict B,
+                               size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_DISPATCH(kernels_fcmplx, A, B, A_rows, A_cols);
+}
+
+void transpose_dcmplx_dispatch(const double complex* restrict A,
+                               double complex* restrict B,
+                               size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_DISPATCH(kernels_dcmplx, A, B, A_rows, A_cols);
+}
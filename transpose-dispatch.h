@@ -0,0 +1,43 @@
+/**
+ * Transpose functions with runtime CPU feature dispatch.
+ *
+ * The best kernel supported by both the CPU (and OS) and the matrix shape and
+ * alignment is selected: AVX-512, AVX2, SSE2, or scalar.
+ * Set the TRANSPOSE_ISA environment variable to one of "avx512", "avx2",
+ * "sse2", or "scalar" to limit the selection.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_DISPATCH_H
+#define TRANSPOSE_DISPATCH_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+/**
+ * Get the name of the best instruction set available to the dispatcher.
+ */
+const char *transpose_dispatch_isa(void);
+
+/**
+ * Returns 1 if the named instruction set ("avx512", "avx2", "sse2", or
+ * "scalar") is available to the dispatcher, 0 otherwise.
+ */
+int transpose_dispatch_has_isa(const char *isa);
+
+void transpose_flt_dispatch(const float* restrict A, float* restrict B,
+                            size_t A_rows, size_t A_cols);
+
+void transpose_dbl_dispatch(const double* restrict A, double* restrict B,
+                            size_t A_rows, size_t A_cols);
+
+void transpose_fcmplx_dispatch(const float complex* restrict A,
+                               float complex* restrict B,
+                               size_t A_rows, size_t A_cols);
+
+void transpose_dcmplx_dispatch(const double complex* restrict A,
+                               double complex* restrict B,
+                               size_t A_rows, size_t A_cols);
+
+#endif /* TRANSPOSE_DISPATCH_H */
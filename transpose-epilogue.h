@@ -0,0 +1,64 @@
+/**
+ * Epilogues fused into transposes.
+ *
+ * Rather than making another pass over B after a transpose, e.g., to normalize
+ * an inverse FFT, conjugate, or center the zero frequency (fftshift), these
+ * transposes apply the epilogue to each element as they write it to B.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_EPILOGUE_H
+#define TRANSPOSE_EPILOGUE_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include "transpose-twiddle.h"
+
+/**
+ * The element of A at row r and column c is written to B as
+ * scale * conj(A[r][c]) (without conj() unless conj is set), at row
+ * (c + row_shift) % A_cols and column (r + col_shift) % A_rows of B.
+ * If tw is not NULL, it's also multiplied by the twiddle factor for row r and
+ * column c (see transpose-twiddle.h).
+ * The identity epilogue is { 1, 0, 0, 0, NULL }.
+ * For an fftshift of B, row_shift = A_cols / 2 and col_shift = A_rows / 2.
+ */
+typedef struct transpose_epilogue {
+    double complex scale;
+    int conj;
+    size_t row_shift;
+    size_t col_shift;
+    const transpose_twiddle *tw;
+} transpose_epilogue;
+
+/*
+ * Transpose rows [r_min, r_max) and columns [c_min, c_max) of A, applying the
+ * epilogue.  B's column advances with the row of A and B's row with the column
+ * of A, so the shifts only need a modulo at the start of each row of A.
+ */
+#define TRANSPOSE_BLK_EPI(datatype, fn_conj, A, B, A_rows, A_cols, lda, ldb, \
+                          r_min, c_min, r_max, c_max, epi) { \
+    const datatype s = (datatype) (epi)->scale; \
+    const size_t br_min = ((c_min) + (epi)->row_shift) % (A_cols); \
+    size_t r, c, br, bc; \
+    datatype x; \
+    for (r = (r_min); r < (r_max); r++) { \
+        bc = (r + (epi)->col_shift) % (A_rows); \
+        br = br_min; \
+        for (c = (c_min); c < (c_max); c++) { \
+            x = (A)[r * (lda) + c]; \
+            x = ((epi)->conj ? fn_conj(x) : x) * s; \
+            if ((epi)->tw) { \
+                x *= TRANSPOSE_TWIDDLE(datatype, (epi)->tw, A_rows, r, c); \
+            } \
+            (B)[br * (ldb) + bc] = x; \
+            if (++br == (A_cols)) { \
+                br = 0; \
+            } \
+        } \
+    } \
+}
+
+#endif /* TRANSPOSE_EPILOGUE_H */
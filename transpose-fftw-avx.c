@@ -0,0 +1,60 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-avx.h"
+#include "transpose-fftw-avx.h"
+
+void transpose_fftw_avx512_intr(const fftw_complex* restrict A,
+                                fftw_complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_avx512_intr((const double complex* restrict)A,
+                                 (double complex* restrict)B, A_rows, A_cols);
+}
+
+void transpose_fftw_square_avx512_intr(fftw_complex* A, size_t n)
+{
+    transpose_dcmplx_square_avx512_intr((double complex*)A, n);
+}
+
+void transpose_fftw_avx512_intr_ld(const fftw_complex* restrict A,
+                                   fftw_complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t lda, size_t ldb)
+{
+    transpose_dcmplx_avx512_intr_ld((const double complex* restrict)A,
+                                    (double complex* restrict)B,
+                                    A_rows, A_cols, lda, ldb);
+}
+
+void transpose_fftw_recursive_avx512_intr(const fftw_complex* restrict A,
+                                          fftw_complex* restrict B,
+                                          size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_recursive_avx512_intr(A, B, A_rows, A_cols);
+}
+
+void transpose_fftw_batch_avx512_intr(const fftw_complex* restrict A,
+                                      fftw_complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t count, size_t stride)
+{
+    transpose_dcmplx_batch_avx512_intr(A, B, A_rows, A_cols, count, stride);
+}
+
+void transpose_fftw_avx512_intr_epi(const fftw_complex* restrict A,
+                                    fftw_complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t lda, size_t ldb,
+                                    const transpose_epilogue *epi)
+{
+    transpose_dcmplx_avx512_intr_epi(A, B, A_rows, A_cols, lda, ldb, epi);
+}
@@ -0,0 +1,43 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_AVX_H
+#define TRANSPOSE_FFTW_AVX_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-epilogue.h"
+
+void transpose_fftw_avx512_intr(const fftw_complex* restrict A,
+                                fftw_complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+void transpose_fftw_square_avx512_intr(fftw_complex* A, size_t n);
+
+void transpose_fftw_avx512_intr_ld(const fftw_complex* restrict A,
+                                   fftw_complex* restrict B,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t lda, size_t ldb);
+
+void transpose_fftw_recursive_avx512_intr(const fftw_complex* restrict A,
+                                          fftw_complex* restrict B,
+                                          size_t A_rows, size_t A_cols);
+
+void transpose_fftw_batch_avx512_intr(const fftw_complex* restrict A,
+                                      fftw_complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t count, size_t stride);
+
+void transpose_fftw_avx512_intr_epi(const fftw_complex* restrict A,
+                                    fftw_complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t lda, size_t ldb,
+                                    const transpose_epilogue *epi);
+
+#endif /* TRANSPOSE_FFTW_AVX_H */
@@ -0,0 +1,31 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-avx2.h"
+#include "transpose-fftw-avx2.h"
+
+void transpose_fftw_avx2_intr(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_avx2_intr((const double complex* restrict)A,
+                               (double complex* restrict)B, A_rows, A_cols);
+}
+
+void transpose_fftw_avx2_intr_ld(const fftw_complex* restrict A,
+                                 fftw_complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb)
+{
+    transpose_dcmplx_avx2_intr_ld((const double complex* restrict)A,
+                                  (double complex* restrict)B,
+                                  A_rows, A_cols, lda, ldb);
+}
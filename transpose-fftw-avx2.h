@@ -0,0 +1,24 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_AVX2_H
+#define TRANSPOSE_FFTW_AVX2_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftw_avx2_intr(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols);
+
+void transpose_fftw_avx2_intr_ld(const fftw_complex* restrict A,
+                                 fftw_complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb);
+
+#endif /* TRANSPOSE_FFTW_AVX2_H */
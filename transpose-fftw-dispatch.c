@@ -0,0 +1,21 @@
+/**
+ * Transpose functions with runtime CPU feature dispatch.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-dispatch.h"
+#include "transpose-fftw-dispatch.h"
+
+void transpose_fftw_dispatch(const fftw_complex* restrict A,
+                             fftw_complex* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_dispatch((const double complex* restrict)A,
+                              (double complex* restrict)B, A_rows, A_cols);
+}
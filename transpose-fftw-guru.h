@@ -0,0 +1,28 @@
+/**
+ * Transpose functions, using FFTW's own transposes: rank-0 guru plans, which
+ * have no transform dimensions, only the two loops of a matrix transpose.
+ *
+ * Plan a transpose once, like any FFT, then time only fftw_execute().
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_GURU_H
+#define TRANSPOSE_FFTW_GURU_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+/**
+ * Returns a plan that transposes the A_rows x A_cols matrix A into B, or NULL
+ * if FFTW can't plan it.  If B is A, the plan transposes in place.
+ * flags are FFTW planner flags; planning with more rigor than FFTW_ESTIMATE
+ * may overwrite A and B.  Destroy the plan with fftw_destroy_plan().
+ */
+fftw_plan transpose_fftw_guru_plan(fftw_complex *A, fftw_complex *B,
+                                   size_t A_rows, size_t A_cols,
+                                   unsigned flags);
+
+#endif /* TRANSPOSE_FFTW_GURU_H */
@@ -0,0 +1,27 @@
+/**
+ * Transpose planner.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-plan.h"
+#include "transpose-fftw-plan.h"
+
+transpose_plan *transpose_plan_fftw(size_t A_rows, size_t A_cols,
+                                   size_t num_thr, transpose_plan_mode mode)
+{
+    return transpose_plan_dcmplx(A_rows, A_cols, num_thr, mode);
+}
+
+void transpose_execute_fftw(const transpose_plan *p,
+                            const fftw_complex* restrict A,
+                            fftw_complex* restrict B)
+{
+    transpose_execute_dcmplx(p, (const double complex* restrict)A,
+                             (double complex* restrict)B);
+}
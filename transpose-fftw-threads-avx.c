@@ -0,0 +1,82 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-fftw-threads-avx.h"
+#include "transpose-threads-avx.h"
+
+void transpose_fftw_thrrow_avx512_intr(const fftw_complex* restrict A,
+                                       fftw_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr)
+{
+    transpose_dcmplx_thrrow_avx512_intr((const double complex* restrict)A,
+                                        (double complex* restrict)B,
+                                        A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrcol_avx512_intr(const fftw_complex* restrict A,
+                                       fftw_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr)
+{
+    transpose_dcmplx_thrcol_avx512_intr((const double complex* restrict)A,
+                                        (double complex* restrict)B,
+                                        A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrrow_square_avx512_intr(fftw_complex* A, size_t n,
+                                              size_t num_thr)
+{
+    transpose_dcmplx_thrrow_square_avx512_intr((double complex*)A, n, num_thr);
+}
+
+void transpose_fftw_thrrow_avx512_intr_ld(const fftw_complex* restrict A,
+                                          fftw_complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr)
+{
+    transpose_dcmplx_thrrow_avx512_intr_ld((const double complex* restrict)A,
+                                           (double complex* restrict)B,
+                                           A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftw_thrcol_avx512_intr_ld(const fftw_complex* restrict A,
+                                          fftw_complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr)
+{
+    transpose_dcmplx_thrcol_avx512_intr_ld((const double complex* restrict)A,
+                                           (double complex* restrict)B,
+                                           A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftw_thrbatch_avx512_intr(const fftw_complex* restrict A,
+                                         fftw_complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t count, size_t stride,
+                                         size_t num_thr)
+{
+    transpose_dcmplx_thrbatch_avx512_intr(A, B, A_rows, A_cols, count, stride,
+                                          num_thr);
+}
+
+void transpose_fftw_thrrow_avx512_intr_epi(const fftw_complex* restrict A,
+                                           fftw_complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t lda, size_t ldb,
+                                           size_t num_thr,
+                                           const transpose_epilogue *epi)
+{
+    transpose_dcmplx_thrrow_avx512_intr_epi(A, B, A_rows, A_cols, lda, ldb,
+                                            num_thr, epi);
+}
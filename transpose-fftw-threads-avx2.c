@@ -0,0 +1,53 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-fftw-threads-avx2.h"
+#include "transpose-threads-avx2.h"
+
+void transpose_fftw_thrrow_avx2_intr(const fftw_complex* restrict A,
+                                     fftw_complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_dcmplx_thrrow_avx2_intr((const double complex* restrict)A,
+                                      (double complex* restrict)B,
+                                      A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrcol_avx2_intr(const fftw_complex* restrict A,
+                                     fftw_complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_dcmplx_thrcol_avx2_intr((const double complex* restrict)A,
+                                      (double complex* restrict)B,
+                                      A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrrow_avx2_intr_ld(const fftw_complex* restrict A,
+                                        fftw_complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_dcmplx_thrrow_avx2_intr_ld((const double complex* restrict)A,
+                                         (double complex* restrict)B,
+                                         A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftw_thrcol_avx2_intr_ld(const fftw_complex* restrict A,
+                                        fftw_complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_dcmplx_thrcol_avx2_intr_ld((const double complex* restrict)A,
+                                         (double complex* restrict)B,
+                                         A_rows, A_cols, lda, ldb, num_thr);
+}
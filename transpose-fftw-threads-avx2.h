@@ -0,0 +1,35 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTW_THREADS_AVX2_H
+#define TRANSPOSE_FFTW_THREADS_AVX2_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftw_thrrow_avx2_intr(const fftw_complex* restrict A,
+                                     fftw_complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_fftw_thrcol_avx2_intr(const fftw_complex* restrict A,
+                                     fftw_complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_fftw_thrrow_avx2_intr_ld(const fftw_complex* restrict A,
+                                        fftw_complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fftw_thrcol_avx2_intr_ld(const fftw_complex* restrict A,
+                                        fftw_complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr);
+
+#endif /* TRANSPOSE_FFTW_THREADS_AVX2_H */
@@ -48,3 +48,147 @@ void transpose_fftw_thrcol_blocked(const fftw_complex* restrict A,
     transpose_dcmplx_thrcol_blocked(A, B, A_rows, A_cols, num_thr,
                                     blk_rows, blk_cols);
 }
+
+void transpose_fftw_thrrow_ld(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_dcmplx_thrrow_ld(A, B, A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftw_thrcol_ld(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_dcmplx_thrcol_ld(A, B, A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftw_thrrow_blocked_ld(const fftw_complex* restrict A,
+                                      fftw_complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb, size_t num_thr,
+                                      size_t blk_rows, size_t blk_cols)
+{
+    transpose_dcmplx_thrrow_blocked_ld(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                                       blk_rows, blk_cols);
+}
+
+void transpose_fftw_thrcol_blocked_ld(const fftw_complex* restrict A,
+                                      fftw_complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb, size_t num_thr,
+                                      size_t blk_rows, size_t blk_cols)
+{
+    transpose_dcmplx_thrcol_blocked_ld(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                                       blk_rows, blk_cols);
+}
+
+void transpose_fftw_thrrow_square(fftw_complex* A, size_t n,
+                                  size_t num_thr)
+{
+    transpose_dcmplx_thrrow_square(A, n, num_thr);
+}
+
+void transpose_fftw_thrrow_square_blocked(fftw_complex* A, size_t n,
+                                          size_t num_thr, size_t blk)
+{
+    transpose_dcmplx_thrrow_square_blocked(A, n, num_thr, blk);
+}
+
+void transpose_fftw_thrcyc_inplace(fftw_complex* A,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t num_thr)
+{
+    transpose_dcmplx_thrcyc_inplace(A, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrrec(const fftw_complex* restrict A,
+                           fftw_complex* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr)
+{
+    transpose_dcmplx_thrrec(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrmorton(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_dcmplx_thrmorton(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrhilbert(const fftw_complex* restrict A,
+                               fftw_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t num_thr)
+{
+    transpose_dcmplx_thrhilbert(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrtile(const fftw_complex* restrict A,
+                            fftw_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr)
+{
+    transpose_dcmplx_thrtile(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrnuma(const fftw_complex* restrict A,
+                            fftw_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr)
+{
+    transpose_dcmplx_thrnuma(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrnuma_reserve(size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_thrnuma_reserve(A_rows, A_cols, sizeof(fftw_complex), num_thr);
+}
+
+void transpose_fftw_thrnuma_release(void)
+{
+    transpose_thrnuma_release();
+}
+
+void transpose_fftw_thrtlb(const fftw_complex* restrict A,
+                           fftw_complex* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr)
+{
+    transpose_dcmplx_thrtlb(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftw_thrtlb_reserve(size_t A_rows, size_t A_cols,
+                                   size_t num_thr)
+{
+    transpose_thrtlb_reserve(A_rows, A_cols, sizeof(fftw_complex), num_thr);
+}
+
+void transpose_fftw_thrtlb_release(void)
+{
+    transpose_thrtlb_release();
+}
+
+void transpose_fftw_thrbatch(const fftw_complex* restrict A,
+                             fftw_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t count, size_t stride,
+                             size_t num_thr)
+{
+    transpose_dcmplx_thrbatch(A, B, A_rows, A_cols, count, stride,
+                              num_thr);
+}
+
+void transpose_fftw_thrrow_epi(const fftw_complex* restrict A,
+                               fftw_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb, size_t num_thr,
+                               const transpose_epilogue *epi)
+{
+    transpose_dcmplx_thrrow_epi(A, B, A_rows, A_cols, lda, ldb, num_thr, epi);
+}
@@ -12,6 +12,8 @@
 
 #include <fftw3.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_fftw_thrrow(const fftw_complex* restrict A,
                            fftw_complex* restrict B,
                            size_t A_rows, size_t A_cols,
@@ -34,4 +36,88 @@ void transpose_fftw_thrcol_blocked(const fftw_complex* restrict A,
                                    size_t num_thr,
                                    size_t blk_rows, size_t blk_cols);
 
+void transpose_fftw_thrrow_ld(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fftw_thrcol_ld(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fftw_thrrow_blocked_ld(const fftw_complex* restrict A,
+                                      fftw_complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb, size_t num_thr,
+                                      size_t blk_rows, size_t blk_cols);
+
+void transpose_fftw_thrcol_blocked_ld(const fftw_complex* restrict A,
+                                      fftw_complex* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t lda, size_t ldb, size_t num_thr,
+                                      size_t blk_rows, size_t blk_cols);
+
+void transpose_fftw_thrrow_square(fftw_complex* A, size_t n,
+                                  size_t num_thr);
+
+void transpose_fftw_thrrow_square_blocked(fftw_complex* A, size_t n,
+                                          size_t num_thr, size_t blk);
+
+void transpose_fftw_thrcyc_inplace(fftw_complex* A,
+                                   size_t A_rows, size_t A_cols,
+                                   size_t num_thr);
+
+void transpose_fftw_thrrec(const fftw_complex* restrict A,
+                           fftw_complex* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr);
+
+void transpose_fftw_thrmorton(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+
+void transpose_fftw_thrhilbert(const fftw_complex* restrict A,
+                               fftw_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t num_thr);
+
+void transpose_fftw_thrtile(const fftw_complex* restrict A,
+                            fftw_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr);
+
+void transpose_fftw_thrnuma(const fftw_complex* restrict A,
+                            fftw_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr);
+
+// see transpose_thrnuma_reserve() in transpose-threads.h
+void transpose_fftw_thrnuma_reserve(size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+void transpose_fftw_thrnuma_release(void);
+
+void transpose_fftw_thrtlb(const fftw_complex* restrict A,
+                           fftw_complex* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr);
+
+// see transpose_thrtlb_reserve() in transpose-threads.h
+void transpose_fftw_thrtlb_reserve(size_t A_rows, size_t A_cols,
+                                   size_t num_thr);
+void transpose_fftw_thrtlb_release(void);
+
+void transpose_fftw_thrbatch(const fftw_complex* restrict A,
+                             fftw_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t count, size_t stride,
+                             size_t num_thr);
+
+void transpose_fftw_thrrow_epi(const fftw_complex* restrict A,
+                               fftw_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb, size_t num_thr,
+                               const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_FFTW_THREADS_H */
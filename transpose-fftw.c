@@ -26,3 +26,102 @@ void transpose_fftw_blocked(const fftw_complex* restrict A,
 {
     transpose_dcmplx_blocked(A, B, A_rows, A_cols, blk_rows, blk_cols);
 }
+
+void transpose_fftw_naive_ld(const fftw_complex* restrict A,
+                             fftw_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb)
+{
+    transpose_dcmplx_naive_ld(A, B, A_rows, A_cols, lda, ldb);
+}
+
+void transpose_fftw_blocked_ld(const fftw_complex* restrict A,
+                               fftw_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb,
+                               size_t blk_rows, size_t blk_cols)
+{
+    transpose_dcmplx_blocked_ld(A, B, A_rows, A_cols, lda, ldb, blk_rows,
+                                blk_cols);
+}
+
+void transpose_fftw_square_naive(fftw_complex* A, size_t n)
+{
+    transpose_dcmplx_square_naive(A, n);
+}
+
+void transpose_fftw_square_blocked(fftw_complex* A, size_t n, size_t blk)
+{
+    transpose_dcmplx_square_blocked(A, n, blk);
+}
+
+void transpose_fftw_inplace(fftw_complex* A, size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_inplace(A, A_rows, A_cols);
+}
+
+void transpose_fftw_recursive(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_recursive(A, B, A_rows, A_cols);
+}
+
+void transpose_fftw_morton(const fftw_complex* restrict A,
+                           fftw_complex* restrict B,
+                           size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_morton(A, B, A_rows, A_cols);
+}
+
+void transpose_fftw_hilbert(const fftw_complex* restrict A,
+                            fftw_complex* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_hilbert(A, B, A_rows, A_cols);
+}
+
+void transpose_fftw_tlb(const fftw_complex* restrict A,
+                        fftw_complex* restrict B,
+                        size_t A_rows, size_t A_cols)
+{
+    transpose_dcmplx_tlb(A, B, A_rows, A_cols);
+}
+
+void transpose_fftw_tlb_reserve(size_t A_rows, size_t A_cols)
+{
+    transpose_tlb_reserve(A_rows, A_cols, sizeof(fftw_complex));
+}
+
+void transpose_fftw_tlb_release(void)
+{
+    transpose_tlb_release();
+}
+
+void transpose_fftw_batch(const fftw_complex* restrict A,
+                          fftw_complex* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t count, size_t stride)
+{
+    transpose_dcmplx_batch(A, B, A_rows, A_cols, count, stride);
+}
+
+void transpose_fftw_naive_epi(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb,
+                              const transpose_epilogue *epi)
+{
+    transpose_dcmplx_naive_epi(A, B, A_rows, A_cols, lda, ldb, epi);
+}
+
+void transpose_fftw_blocked_epi(const fftw_complex* restrict A,
+                                fftw_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                size_t blk_rows, size_t blk_cols,
+                                const transpose_epilogue *epi)
+{
+    transpose_dcmplx_blocked_epi(A, B, A_rows, A_cols, lda, ldb,
+                                 blk_rows, blk_cols, epi);
+}
@@ -12,6 +12,8 @@
 
 #include <fftw3.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_fftw_naive(const fftw_complex* restrict A,
                           fftw_complex* restrict B,
                           size_t A_rows, size_t A_cols);
@@ -21,4 +23,59 @@ void transpose_fftw_blocked(const fftw_complex* restrict A,
                             size_t A_rows, size_t A_cols,
                             size_t blk_rows, size_t blk_cols);
 
+void transpose_fftw_naive_ld(const fftw_complex* restrict A,
+                             fftw_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb);
+
+void transpose_fftw_blocked_ld(const fftw_complex* restrict A,
+                               fftw_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb,
+                               size_t blk_rows, size_t blk_cols);
+
+void transpose_fftw_square_naive(fftw_complex* A, size_t n);
+
+void transpose_fftw_square_blocked(fftw_complex* A, size_t n, size_t blk);
+
+void transpose_fftw_inplace(fftw_complex* A, size_t A_rows, size_t A_cols);
+
+void transpose_fftw_recursive(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols);
+
+void transpose_fftw_morton(const fftw_complex* restrict A,
+                           fftw_complex* restrict B,
+                           size_t A_rows, size_t A_cols);
+
+void transpose_fftw_hilbert(const fftw_complex* restrict A,
+                            fftw_complex* restrict B,
+                            size_t A_rows, size_t A_cols);
+
+void transpose_fftw_tlb(const fftw_complex* restrict A,
+                        fftw_complex* restrict B,
+                        size_t A_rows, size_t A_cols);
+
+// see transpose_tlb_reserve() in transpose.h
+void transpose_fftw_tlb_reserve(size_t A_rows, size_t A_cols);
+void transpose_fftw_tlb_release(void);
+
+void transpose_fftw_batch(const fftw_complex* restrict A,
+                          fftw_complex* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t count, size_t stride);
+
+void transpose_fftw_naive_epi(const fftw_complex* restrict A,
+                              fftw_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb,
+                              const transpose_epilogue *epi);
+
+void transpose_fftw_blocked_epi(const fftw_complex* restrict A,
+                                fftw_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                size_t blk_rows, size_t blk_cols,
+                                const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_FFTW_H */
@@ -19,3 +19,45 @@ void transpose_fftwf_avx512_intr(const fftwf_complex* restrict A,
     transpose_dbl_avx512_intr((const double* restrict)A, (double* restrict)B,
                               A_rows, A_cols);
 }
+
+void transpose_fftwf_square_avx512_intr(fftwf_complex* A, size_t n)
+{
+    transpose_dbl_square_avx512_intr((double*)A, n);
+}
+
+void transpose_fftwf_avx512_intr_ld(const fftwf_complex* restrict A,
+                                    fftwf_complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t lda, size_t ldb)
+{
+    transpose_dbl_avx512_intr_ld((const double* restrict)A,
+                                 (double* restrict)B, A_rows, A_cols, lda, ldb);
+}
+
+void transpose_fftwf_recursive_avx512_intr(const fftwf_complex* restrict A,
+                                           fftwf_complex* restrict B,
+                                           size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_recursive_avx512_intr((const double* restrict)A,
+                                        (double* restrict)B,
+                                        A_rows, A_cols);
+}
+
+void transpose_fftwf_batch_avx512_intr(const fftwf_complex* restrict A,
+                                       fftwf_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t count, size_t stride)
+{
+    transpose_dbl_batch_avx512_intr((const double* restrict)A,
+                                    (double* restrict)B,
+                                    A_rows, A_cols, count, stride);
+}
+
+void transpose_fftwf_avx512_intr_epi(const fftwf_complex* restrict A,
+                                     fftwf_complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb,
+                                     const transpose_epilogue *epi)
+{
+    transpose_fcmplx_avx512_intr_epi(A, B, A_rows, A_cols, lda, ldb, epi);
+}
@@ -12,8 +12,32 @@
 
 #include <fftw3.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_fftwf_avx512_intr(const fftwf_complex* restrict A,
                                  fftwf_complex* restrict B,
                                  size_t A_rows, size_t A_cols);
 
+void transpose_fftwf_square_avx512_intr(fftwf_complex* A, size_t n);
+
+void transpose_fftwf_avx512_intr_ld(const fftwf_complex* restrict A,
+                                    fftwf_complex* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t lda, size_t ldb);
+
+void transpose_fftwf_recursive_avx512_intr(const fftwf_complex* restrict A,
+                                           fftwf_complex* restrict B,
+                                           size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_batch_avx512_intr(const fftwf_complex* restrict A,
+                                       fftwf_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t count, size_t stride);
+
+void transpose_fftwf_avx512_intr_epi(const fftwf_complex* restrict A,
+                                     fftwf_complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb,
+                                     const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_FFTWF_AVX_H */
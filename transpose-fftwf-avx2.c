@@ -0,0 +1,31 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-avx2.h"
+#include "transpose-fftwf-avx2.h"
+
+void transpose_fftwf_avx2_intr(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_avx2_intr((const float complex* restrict)A,
+                               (float complex* restrict)B, A_rows, A_cols);
+}
+
+void transpose_fftwf_avx2_intr_ld(const fftwf_complex* restrict A,
+                                  fftwf_complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb)
+{
+    transpose_fcmplx_avx2_intr_ld((const float complex* restrict)A,
+                                  (float complex* restrict)B,
+                                  A_rows, A_cols, lda, ldb);
+}
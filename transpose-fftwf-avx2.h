@@ -0,0 +1,24 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTWF_AVX2_H
+#define TRANSPOSE_FFTWF_AVX2_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+void transpose_fftwf_avx2_intr(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_avx2_intr_ld(const fftwf_complex* restrict A,
+                                  fftwf_complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb);
+
+#endif /* TRANSPOSE_FFTWF_AVX2_H */
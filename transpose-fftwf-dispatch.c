@@ -0,0 +1,21 @@
+/**
+ * Transpose functions with runtime CPU feature dispatch.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-dispatch.h"
+#include "transpose-fftwf-dispatch.h"
+
+void transpose_fftwf_dispatch(const fftwf_complex* restrict A,
+                              fftwf_complex* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_dispatch((const float complex* restrict)A,
+                              (float complex* restrict)B, A_rows, A_cols);
+}
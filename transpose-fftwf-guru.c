@@ -0,0 +1,26 @@
+/**
+ * Transpose functions, using FFTW's own transposes.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-fftwf-guru.h"
+
+fftwf_plan transpose_fftwf_guru_plan(fftwf_complex *A, fftwf_complex *B,
+                                     size_t A_rows, size_t A_cols,
+                                     unsigned flags)
+{
+    // no transform dimensions, just the rows and columns of A, with the output
+    // strides swapped; FFTW handles A == B with its in-place transposes
+    const fftwf_iodim64 dims[2] = {
+        { .n = (ptrdiff_t) A_rows, .is = (ptrdiff_t) A_cols, .os = 1 },
+        { .n = (ptrdiff_t) A_cols, .is = 1, .os = (ptrdiff_t) A_rows },
+    };
+    return fftwf_plan_guru64_dft(0, NULL, 2, dims, A, B, FFTW_FORWARD, flags);
+}
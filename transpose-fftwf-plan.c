@@ -0,0 +1,27 @@
+/**
+ * Transpose planner.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-plan.h"
+#include "transpose-fftwf-plan.h"
+
+transpose_plan *transpose_plan_fftwf(size_t A_rows, size_t A_cols,
+                                    size_t num_thr, transpose_plan_mode mode)
+{
+    return transpose_plan_fcmplx(A_rows, A_cols, num_thr, mode);
+}
+
+void transpose_execute_fftwf(const transpose_plan *p,
+                             const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B)
+{
+    transpose_execute_fcmplx(p, (const float complex* restrict)A,
+                             (float complex* restrict)B);
+}
@@ -0,0 +1,24 @@
+/**
+ * Transpose planner.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_FFTWF_PLAN_H
+#define TRANSPOSE_FFTWF_PLAN_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+#include <fftw3.h>
+
+#include "transpose-plan.h"
+
+transpose_plan *transpose_plan_fftwf(size_t A_rows, size_t A_cols,
+                                    size_t num_thr, transpose_plan_mode mode);
+
+void transpose_execute_fftwf(const transpose_plan *p,
+                             const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B);
+
+#endif /* TRANSPOSE_FFTWF_PLAN_H */
@@ -31,3 +31,53 @@ void transpose_fftwf_thrcol_avx512_intr(const fftwf_complex* restrict A,
                                      (double* restrict)B,
                                      A_rows, A_cols, num_thr);
 }
+
+void transpose_fftwf_thrrow_square_avx512_intr(fftwf_complex* A, size_t n,
+                                               size_t num_thr)
+{
+    transpose_dbl_thrrow_square_avx512_intr((double*)A, n, num_thr);
+}
+
+void transpose_fftwf_thrrow_avx512_intr_ld(const fftwf_complex* restrict A,
+                                           fftwf_complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t lda, size_t ldb,
+                                           size_t num_thr)
+{
+    transpose_dbl_thrrow_avx512_intr_ld((const double* restrict)A,
+                                        (double* restrict)B,
+                                        A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftwf_thrcol_avx512_intr_ld(const fftwf_complex* restrict A,
+                                           fftwf_complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t lda, size_t ldb,
+                                           size_t num_thr)
+{
+    transpose_dbl_thrcol_avx512_intr_ld((const double* restrict)A,
+                                        (double* restrict)B,
+                                        A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftwf_thrbatch_avx512_intr(const fftwf_complex* restrict A,
+                                          fftwf_complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t count, size_t stride,
+                                          size_t num_thr)
+{
+    transpose_dbl_thrbatch_avx512_intr((const double* restrict)A,
+                                       (double* restrict)B,
+                                       A_rows, A_cols, count, stride, num_thr);
+}
+
+void transpose_fftwf_thrrow_avx512_intr_epi(const fftwf_complex* restrict A,
+                                            fftwf_complex* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t lda, size_t ldb,
+                                            size_t num_thr,
+                                            const transpose_epilogue *epi)
+{
+    transpose_fcmplx_thrrow_avx512_intr_epi(A, B, A_rows, A_cols, lda, ldb,
+                                            num_thr, epi);
+}
@@ -12,6 +12,8 @@
 
 #include <fftw3.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_fftwf_thrrow_avx512_intr(const fftwf_complex* restrict A,
                                         fftwf_complex* restrict B,
                                         size_t A_rows, size_t A_cols,
@@ -22,4 +24,32 @@ void transpose_fftwf_thrcol_avx512_intr(const fftwf_complex* restrict A,
                                         size_t A_rows, size_t A_cols,
                                         size_t num_thr);
 
+void transpose_fftwf_thrrow_square_avx512_intr(fftwf_complex* A, size_t n,
+                                               size_t num_thr);
+
+void transpose_fftwf_thrrow_avx512_intr_ld(const fftwf_complex* restrict A,
+                                           fftwf_complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t lda, size_t ldb,
+                                           size_t num_thr);
+
+void transpose_fftwf_thrcol_avx512_intr_ld(const fftwf_complex* restrict A,
+                                           fftwf_complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t lda, size_t ldb,
+                                           size_t num_thr);
+
+void transpose_fftwf_thrbatch_avx512_intr(const fftwf_complex* restrict A,
+                                          fftwf_complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t count, size_t stride,
+                                          size_t num_thr);
+
+void transpose_fftwf_thrrow_avx512_intr_epi(const fftwf_complex* restrict A,
+                                            fftwf_complex* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t lda, size_t ldb,
+                                            size_t num_thr,
+                                            const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_FFTWF_THREADS_AVX */
@@ -48,3 +48,147 @@ void transpose_fftwf_thrcol_blocked(const fftwf_complex* restrict A,
     transpose_fcmplx_thrcol_blocked(A, B, A_rows, A_cols, num_thr,
                                     blk_rows, blk_cols);
 }
+
+void transpose_fftwf_thrrow_ld(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_fcmplx_thrrow_ld(A, B, A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftwf_thrcol_ld(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_fcmplx_thrcol_ld(A, B, A_rows, A_cols, lda, ldb, num_thr);
+}
+
+void transpose_fftwf_thrrow_blocked_ld(const fftwf_complex* restrict A,
+                                       fftwf_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols)
+{
+    transpose_fcmplx_thrrow_blocked_ld(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                                       blk_rows, blk_cols);
+}
+
+void transpose_fftwf_thrcol_blocked_ld(const fftwf_complex* restrict A,
+                                       fftwf_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols)
+{
+    transpose_fcmplx_thrcol_blocked_ld(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                                       blk_rows, blk_cols);
+}
+
+void transpose_fftwf_thrrow_square(fftwf_complex* A, size_t n,
+                                   size_t num_thr)
+{
+    transpose_fcmplx_thrrow_square(A, n, num_thr);
+}
+
+void transpose_fftwf_thrrow_square_blocked(fftwf_complex* A, size_t n,
+                                           size_t num_thr, size_t blk)
+{
+    transpose_fcmplx_thrrow_square_blocked(A, n, num_thr, blk);
+}
+
+void transpose_fftwf_thrcyc_inplace(fftwf_complex* A,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_fcmplx_thrcyc_inplace(A, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrrec(const fftwf_complex* restrict A,
+                            fftwf_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr)
+{
+    transpose_fcmplx_thrrec(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrmorton(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t num_thr)
+{
+    transpose_fcmplx_thrmorton(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrhilbert(const fftwf_complex* restrict A,
+                                fftwf_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t num_thr)
+{
+    transpose_fcmplx_thrhilbert(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrtile(const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_fcmplx_thrtile(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrnuma(const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_fcmplx_thrnuma(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrnuma_reserve(size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_thrnuma_reserve(A_rows, A_cols, sizeof(fftwf_complex), num_thr);
+}
+
+void transpose_fftwf_thrnuma_release(void)
+{
+    transpose_thrnuma_release();
+}
+
+void transpose_fftwf_thrtlb(const fftwf_complex* restrict A,
+                            fftwf_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr)
+{
+    transpose_fcmplx_thrtlb(A, B, A_rows, A_cols, num_thr);
+}
+
+void transpose_fftwf_thrtlb_reserve(size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_thrtlb_reserve(A_rows, A_cols, sizeof(fftwf_complex), num_thr);
+}
+
+void transpose_fftwf_thrtlb_release(void)
+{
+    transpose_thrtlb_release();
+}
+
+void transpose_fftwf_thrbatch(const fftwf_complex* restrict A,
+                              fftwf_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t count, size_t stride,
+                              size_t num_thr)
+{
+    transpose_fcmplx_thrbatch(A, B, A_rows, A_cols, count, stride,
+                              num_thr);
+}
+
+void transpose_fftwf_thrrow_epi(const fftwf_complex* restrict A,
+                                fftwf_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr,
+                                const transpose_epilogue *epi)
+{
+    transpose_fcmplx_thrrow_epi(A, B, A_rows, A_cols, lda, ldb, num_thr, epi);
+}
@@ -12,6 +12,8 @@
 
 #include <fftw3.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_fftwf_thrrow(const fftwf_complex* restrict A,
                             fftwf_complex* restrict B,
                             size_t A_rows, size_t A_cols,
@@ -34,4 +36,88 @@ void transpose_fftwf_thrcol_blocked(const fftwf_complex* restrict A,
                                     size_t num_thr,
                                     size_t blk_rows, size_t blk_cols);
 
+void transpose_fftwf_thrrow_ld(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fftwf_thrcol_ld(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fftwf_thrrow_blocked_ld(const fftwf_complex* restrict A,
+                                       fftwf_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols);
+
+void transpose_fftwf_thrcol_blocked_ld(const fftwf_complex* restrict A,
+                                       fftwf_complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr,
+                                       size_t blk_rows, size_t blk_cols);
+
+void transpose_fftwf_thrrow_square(fftwf_complex* A, size_t n,
+                                   size_t num_thr);
+
+void transpose_fftwf_thrrow_square_blocked(fftwf_complex* A, size_t n,
+                                           size_t num_thr, size_t blk);
+
+void transpose_fftwf_thrcyc_inplace(fftwf_complex* A,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+
+void transpose_fftwf_thrrec(const fftwf_complex* restrict A,
+                            fftwf_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr);
+
+void transpose_fftwf_thrmorton(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t num_thr);
+
+void transpose_fftwf_thrhilbert(const fftwf_complex* restrict A,
+                                fftwf_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t num_thr);
+
+void transpose_fftwf_thrtile(const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+
+void transpose_fftwf_thrnuma(const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+
+// see transpose_thrnuma_reserve() in transpose-threads.h
+void transpose_fftwf_thrnuma_reserve(size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+void transpose_fftwf_thrnuma_release(void);
+
+void transpose_fftwf_thrtlb(const fftwf_complex* restrict A,
+                            fftwf_complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t num_thr);
+
+// see transpose_thrtlb_reserve() in transpose-threads.h
+void transpose_fftwf_thrtlb_reserve(size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+void transpose_fftwf_thrtlb_release(void);
+
+void transpose_fftwf_thrbatch(const fftwf_complex* restrict A,
+                              fftwf_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t count, size_t stride,
+                              size_t num_thr);
+
+void transpose_fftwf_thrrow_epi(const fftwf_complex* restrict A,
+                                fftwf_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr,
+                                const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_FFTWF_THREADS_H */
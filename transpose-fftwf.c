@@ -26,3 +26,102 @@ void transpose_fftwf_blocked(const fftwf_complex* restrict A,
 {
     transpose_fcmplx_blocked(A, B, A_rows, A_cols, blk_rows, blk_cols);
 }
+
+void transpose_fftwf_naive_ld(const fftwf_complex* restrict A,
+                              fftwf_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb)
+{
+    transpose_fcmplx_naive_ld(A, B, A_rows, A_cols, lda, ldb);
+}
+
+void transpose_fftwf_blocked_ld(const fftwf_complex* restrict A,
+                                fftwf_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                size_t blk_rows, size_t blk_cols)
+{
+    transpose_fcmplx_blocked_ld(A, B, A_rows, A_cols, lda, ldb, blk_rows,
+                                blk_cols);
+}
+
+void transpose_fftwf_square_naive(fftwf_complex* A, size_t n)
+{
+    transpose_fcmplx_square_naive(A, n);
+}
+
+void transpose_fftwf_square_blocked(fftwf_complex* A, size_t n, size_t blk)
+{
+    transpose_fcmplx_square_blocked(A, n, blk);
+}
+
+void transpose_fftwf_inplace(fftwf_complex* A, size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_inplace(A, A_rows, A_cols);
+}
+
+void transpose_fftwf_recursive(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_recursive(A, B, A_rows, A_cols);
+}
+
+void transpose_fftwf_morton(const fftwf_complex* restrict A,
+                            fftwf_complex* restrict B,
+                            size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_morton(A, B, A_rows, A_cols);
+}
+
+void transpose_fftwf_hilbert(const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_hilbert(A, B, A_rows, A_cols);
+}
+
+void transpose_fftwf_tlb(const fftwf_complex* restrict A,
+                         fftwf_complex* restrict B,
+                         size_t A_rows, size_t A_cols)
+{
+    transpose_fcmplx_tlb(A, B, A_rows, A_cols);
+}
+
+void transpose_fftwf_tlb_reserve(size_t A_rows, size_t A_cols)
+{
+    transpose_tlb_reserve(A_rows, A_cols, sizeof(fftwf_complex));
+}
+
+void transpose_fftwf_tlb_release(void)
+{
+    transpose_tlb_release();
+}
+
+void transpose_fftwf_batch(const fftwf_complex* restrict A,
+                           fftwf_complex* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t count, size_t stride)
+{
+    transpose_fcmplx_batch(A, B, A_rows, A_cols, count, stride);
+}
+
+void transpose_fftwf_naive_epi(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb,
+                               const transpose_epilogue *epi)
+{
+    transpose_fcmplx_naive_epi(A, B, A_rows, A_cols, lda, ldb, epi);
+}
+
+void transpose_fftwf_blocked_epi(const fftwf_complex* restrict A,
+                                 fftwf_complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb,
+                                 size_t blk_rows, size_t blk_cols,
+                                 const transpose_epilogue *epi)
+{
+    transpose_fcmplx_blocked_epi(A, B, A_rows, A_cols, lda, ldb,
+                                 blk_rows, blk_cols, epi);
+}
@@ -12,6 +12,8 @@
 
 #include <fftw3.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_fftwf_naive(const fftwf_complex* restrict A,
                            fftwf_complex* restrict B,
                            size_t A_rows, size_t A_cols);
@@ -21,4 +23,59 @@ void transpose_fftwf_blocked(const fftwf_complex* restrict A,
                              size_t A_rows, size_t A_cols,
                              size_t blk_rows, size_t blk_cols);
 
+void transpose_fftwf_naive_ld(const fftwf_complex* restrict A,
+                              fftwf_complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb);
+
+void transpose_fftwf_blocked_ld(const fftwf_complex* restrict A,
+                                fftwf_complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                size_t blk_rows, size_t blk_cols);
+
+void transpose_fftwf_square_naive(fftwf_complex* A, size_t n);
+
+void transpose_fftwf_square_blocked(fftwf_complex* A, size_t n, size_t blk);
+
+void transpose_fftwf_inplace(fftwf_complex* A, size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_recursive(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_morton(const fftwf_complex* restrict A,
+                            fftwf_complex* restrict B,
+                            size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_hilbert(const fftwf_complex* restrict A,
+                             fftwf_complex* restrict B,
+                             size_t A_rows, size_t A_cols);
+
+void transpose_fftwf_tlb(const fftwf_complex* restrict A,
+                         fftwf_complex* restrict B,
+                         size_t A_rows, size_t A_cols);
+
+// see transpose_tlb_reserve() in transpose.h
+void transpose_fftwf_tlb_reserve(size_t A_rows, size_t A_cols);
+void transpose_fftwf_tlb_release(void);
+
+void transpose_fftwf_batch(const fftwf_complex* restrict A,
+                           fftwf_complex* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t count, size_t stride);
+
+void transpose_fftwf_naive_epi(const fftwf_complex* restrict A,
+                               fftwf_complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb,
+                               const transpose_epilogue *epi);
+
+void transpose_fftwf_blocked_epi(const fftwf_complex* restrict A,
+                                 fftwf_complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb,
+                                 size_t blk_rows, size_t blk_cols,
+                                 const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_FFTWF_H */
@@ -0,0 +1,34 @@
+/**
+ * Index arithmetic for in-place cycle-following transposes.
+ *
+ * Transposing a rectangular matrix in place permutes its elements: the element
+ * that belongs at index p of the (A_cols x A_rows) transpose is found at index
+ * (p % A_rows) * A_cols + p / A_rows.  Following each cycle of the permutation
+ * moves every element once, with a single temporary.
+ * The first and last elements never move.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_INPLACE_H
+#define TRANSPOSE_INPLACE_H
+
+#include <limits.h>
+#include <stdatomic.h>
+
+#define INPLACE_SRC(p, A_rows, A_cols) \
+    (((p) % (A_rows)) * (A_cols) + (p) / (A_rows))
+
+// bitmaps of one bit per element, e.g., to mark elements already moved
+#define BITMAP_GET(bm, i) ((bm)[(i) / CHAR_BIT] & (1U << ((i) % CHAR_BIT)))
+#define BITMAP_SET(bm, i) ((bm)[(i) / CHAR_BIT] |= (1U << ((i) % CHAR_BIT)))
+
+// the same, for bitmaps of atomic_uchar shared between threads
+#define BITMAP_GET_ATOMIC(bm, i) \
+    (atomic_load_explicit(&(bm)[(i) / CHAR_BIT], memory_order_relaxed) & \
+     (1U << ((i) % CHAR_BIT)))
+#define BITMAP_SET_ATOMIC(bm, i) \
+    atomic_fetch_or_explicit(&(bm)[(i) / CHAR_BIT], 1U << ((i) % CHAR_BIT), \
+                             memory_order_relaxed)
+
+#endif /* TRANSPOSE_INPLACE_H */
@@ -0,0 +1,735 @@
+/**
+ * Transpose planner.
+ *
+ * SIMD kernels are compiled separately with their own target flags (see
+ * transpose-dispatch.c), and candidates are only considered if the dispatcher
+ * reports that the CPU supports their instruction set.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#include <complex.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ptime.h"
+#include "transpose.h"
+#include "transpose-avx.h"
+#include "transpose-avx2.h"
+#include "transpose-dispatch.h"
+#include "transpose-plan.h"
+#include "transpose-sse2.h"
+#include "transpose-threads.h"
+#include "transpose-threads-avx.h"
+#include "transpose-threads-avx2.h"
+#include "util.h"
+
+// cache sizes to assume when sysfs doesn't report them
+#define TP_DEFAULT_L1D (32 * 1024)
+#define TP_DEFAULT_L2 (1024 * 1024)
+
+// time each candidate for at least this long per trial, and take the best trial
+#define TP_MEASURE_MIN_NS 1000000
+#define TP_MEASURE_MAX_REPS 1000
+#define TP_MEASURE_TRIALS 3
+
+// maximum lengths of names, including the terminating null byte
+#define TP_TYPE_NAME_LEN 8
+#define TP_ALGO_NAME_LEN 32
+
+enum tp_type {
+    TP_FLT = 0,
+    TP_DBL,
+    TP_FCMPLX,
+    TP_DCMPLX,
+    TP_NUM_TYPES
+};
+
+static const char *type_names[TP_NUM_TYPES] = {
+    "flt", "dbl", "fcmplx", "dcmplx"
+};
+
+static const size_t type_sizes[TP_NUM_TYPES] = {
+    sizeof(float), sizeof(double), sizeof(float complex), sizeof(double complex)
+};
+
+// how a threaded algorithm divides the matrix between threads
+enum tp_part {
+    TP_SERIAL = 0,
+    TP_PART_ROWS,
+    TP_PART_COLS,
+    TP_PART_ANY,
+};
+
+typedef void (*tp_fn)(const void* restrict A, void* restrict B,
+                      size_t A_rows, size_t A_cols, size_t num_thr,
+                      size_t blk_rows, size_t blk_cols);
+
+struct tp_algo {
+    const char *name;
+    // required instruction set, or NULL
+    const char *isa;
+    // dimensions must be multiples of the register tile (0 for any size)
+    size_t tile[TP_NUM_TYPES];
+    size_t align;
+    enum tp_part part;
+    int blocked;
+    tp_fn fn[TP_NUM_TYPES];
+};
+
+struct transpose_plan {
+    enum tp_type type;
+    size_t A_rows, A_cols, num_thr;
+    const struct tp_algo *algo;
+    size_t blk_rows, blk_cols;
+};
+
+/*
+ * Wrap the different transpose function signatures in a common one.
+ */
+#define TP_WRAP(fn, datatype) \
+static void tp_##fn(const void* restrict A, void* restrict B, \
+                    size_t A_rows, size_t A_cols, size_t num_thr, \
+                    size_t blk_rows, size_t blk_cols) \
+{ \
+    (void) num_thr; \
+    (void) blk_rows; \
+    (void) blk_cols; \
+    fn((const datatype* restrict)A, (datatype* restrict)B, A_rows, A_cols); \
+}
+
+#define TP_WRAP_BLOCKED(fn, datatype) \
+static void tp_##fn(const void* restrict A, void* restrict B, \
+                    size_t A_rows, size_t A_cols, size_t num_thr, \
+                    size_t blk_rows, size_t blk_cols) \
+{ \
+    (void) num_thr; \
+    fn((const datatype* restrict)A, (datatype* restrict)B, A_rows, A_cols, \
+       blk_rows, blk_cols); \
+}
+
+#define TP_WRAP_THREADED(fn, datatype) \
+static void tp_##fn(const void* restrict A, void* restrict B, \
+                    size_t A_rows, size_t A_cols, size_t num_thr, \
+                    size_t blk_rows, size_t blk_cols) \
+{ \
+    (void) blk_rows; \
+    (void) blk_cols; \
+    fn((const datatype* restrict)A, (datatype* restrict)B, A_rows, A_cols, \
+       num_thr); \
+}
+
+#define TP_WRAP_THREADED_BLOCKED(fn, datatype) \
+static void tp_##fn(const void* restrict A, void* restrict B, \
+                    size_t A_rows, size_t A_cols, size_t num_thr, \
+                    size_t blk_rows, size_t blk_cols) \
+{ \
+    fn((const datatype* restrict)A, (datatype* restrict)B, A_rows, A_cols, \
+       num_thr, blk_rows, blk_cols); \
+}
+
+#define TP_WRAP_ALL(wrap, algo) \
+    wrap(transpose_flt_##algo, float) \
+    wrap(transpose_dbl_##algo, double) \
+    wrap(transpose_fcmplx_##algo, float complex) \
+    wrap(transpose_dcmplx_##algo, double complex)
+
+#define TP_WRAP_AVX512(wrap, algo) \
+    wrap(transpose_flt_##algo, float) \
+    wrap(transpose_dbl_##algo, double) \
+    wrap(transpose_dcmplx_##algo, double complex)
+
+TP_WRAP_ALL(TP_WRAP, naive)
+TP_WRAP_ALL(TP_WRAP_BLOCKED, blocked)
+TP_WRAP_ALL(TP_WRAP, recursive)
+TP_WRAP_ALL(TP_WRAP, morton)
+TP_WRAP_ALL(TP_WRAP, hilbert)
+TP_WRAP_ALL(TP_WRAP, tlb)
+TP_WRAP_ALL(TP_WRAP, sse2_intr)
+TP_WRAP_ALL(TP_WRAP, avx2_intr)
+TP_WRAP_AVX512(TP_WRAP, avx512_intr)
+TP_WRAP_AVX512(TP_WRAP, recursive_avx512_intr)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrrow)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrcol)
+TP_WRAP_ALL(TP_WRAP_THREADED_BLOCKED, thrrow_blocked)
+TP_WRAP_ALL(TP_WRAP_THREADED_BLOCKED, thrcol_blocked)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrrec)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrmorton)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrhilbert)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrtile)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrtlb)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrrow_avx2_intr)
+TP_WRAP_ALL(TP_WRAP_THREADED, thrcol_avx2_intr)
+TP_WRAP_AVX512(TP_WRAP_THREADED, thrrow_avx512_intr)
+TP_WRAP_AVX512(TP_WRAP_THREADED, thrcol_avx512_intr)
+TP_WRAP_ALL(TP_WRAP, dispatch)
+
+#define TP_FNS_ALL(algo) { \
+    tp_transpose_flt_##algo, tp_transpose_dbl_##algo, \
+    tp_transpose_fcmplx_##algo, tp_transpose_dcmplx_##algo \
+}
+
+// a float complex value is 64 bits, so the AVX-512 double kernels move them
+#define TP_FNS_AVX512(algo) { \
+    tp_transpose_flt_##algo, tp_transpose_dbl_##algo, \
+    tp_transpose_dbl_##algo, tp_transpose_dcmplx_##algo \
+}
+
+#define TP_TILES_SSE2 { 4, 2, 2, 1 }
+#define TP_TILES_AVX2 { 8, 4, 4, 2 }
+#define TP_TILES_ANY { 0, 0, 0, 0 }
+
+/* Candidate algorithms; the names are also used in wisdom files */
+static const struct tp_algo algos[] = {
+    { "naive", NULL, TP_TILES_ANY, 1, TP_SERIAL, 0, TP_FNS_ALL(naive) },
+    { "blocked", NULL, TP_TILES_ANY, 1, TP_SERIAL, 1, TP_FNS_ALL(blocked) },
+    { "recursive", NULL, TP_TILES_ANY, 1, TP_SERIAL, 0,
+      TP_FNS_ALL(recursive) },
+    { "morton", NULL, TP_TILES_ANY, 1, TP_SERIAL, 0, TP_FNS_ALL(morton) },
+    { "hilbert", NULL, TP_TILES_ANY, 1, TP_SERIAL, 0, TP_FNS_ALL(hilbert) },
+    { "tlb", NULL, TP_TILES_ANY, 1, TP_SERIAL, 0, TP_FNS_ALL(tlb) },
+    { "sse2-intr", "sse2", TP_TILES_SSE2, 16, TP_SERIAL, 0,
+      TP_FNS_ALL(sse2_intr) },
+    { "avx2-intr", "avx2", TP_TILES_AVX2, 32, TP_SERIAL, 0,
+      TP_FNS_ALL(avx2_intr) },
+    { "avx512-intr", "avx512", TP_TILES_ANY, 64, TP_SERIAL, 0,
+      TP_FNS_AVX512(avx512_intr) },
+    { "recursive-avx512-intr", "avx512", TP_TILES_ANY, 64, TP_SERIAL, 0,
+      TP_FNS_AVX512(recursive_avx512_intr) },
+    { "thrrow", NULL, TP_TILES_ANY, 1, TP_PART_ROWS, 0, TP_FNS_ALL(thrrow) },
+    { "thrcol", NULL, TP_TILES_ANY, 1, TP_PART_COLS, 0, TP_FNS_ALL(thrcol) },
+    { "thrrow-blocked", NULL, TP_TILES_ANY, 1, TP_PART_ROWS, 1,
+      TP_FNS_ALL(thrrow_blocked) },
+    { "thrcol-blocked", NULL, TP_TILES_ANY, 1, TP_PART_COLS, 1,
+      TP_FNS_ALL(thrcol_blocked) },
+    { "thrrec", NULL, TP_TILES_ANY, 1, TP_PART_ANY, 0, TP_FNS_ALL(thrrec) },
+    { "thrmorton", NULL, TP_TILES_ANY, 1, TP_PART_ANY, 0,
+      TP_FNS_ALL(thrmorton) },
+    { "thrhilbert", NULL, TP_TILES_ANY, 1, TP_PART_ANY, 0,
+      TP_FNS_ALL(thrhilbert) },
+    { "thrtile", NULL, TP_TILES_ANY, 1, TP_PART_ANY, 0, TP_FNS_ALL(thrtile) },
+    { "thrtlb", NULL, TP_TILES_ANY, 1, TP_PART_ANY, 0, TP_FNS_ALL(thrtlb) },
+    { "thrrow-avx2-intr", "avx2", TP_TILES_AVX2, 32, TP_PART_ROWS, 0,
+      TP_FNS_ALL(thrrow_avx2_intr) },
+    { "thrcol-avx2-intr", "avx2", TP_TILES_AVX2, 32, TP_PART_COLS, 0,
+      TP_FNS_ALL(thrcol_avx2_intr) },
+    { "thrrow-avx512-intr", "avx512", TP_TILES_ANY, 64, TP_PART_ANY, 0,
+      TP_FNS_AVX512(thrrow_avx512_intr) },
+    { "thrcol-avx512-intr", "avx512", TP_TILES_ANY, 64, TP_PART_ANY, 0,
+      TP_FNS_AVX512(thrcol_avx512_intr) },
+};
+
+#define TP_NUM_ALGOS (sizeof(algos) / sizeof(algos[0]))
+
+// used when a plan's kernel can't be used with the matrices' alignment
+static const tp_fn fallback[TP_NUM_TYPES] = TP_FNS_ALL(dispatch);
+
+/* block sizes to try for blocked algorithms */
+static const size_t blk_sizes[] = { 16, 32, 64, 128, 256 };
+
+#define TP_NUM_BLK_SIZES (sizeof(blk_sizes) / sizeof(blk_sizes[0]))
+
+struct tp_wisdom {
+    enum tp_type type;
+    size_t A_rows, A_cols, num_thr;
+    char algo[TP_ALGO_NAME_LEN];
+    size_t blk_rows, blk_cols;
+};
+
+static struct tp_wisdom *wisdom = NULL;
+static size_t wisdom_len = 0;
+static size_t wisdom_cap = 0;
+
+static const struct tp_algo *algo_find(const char *name)
+{
+    size_t i;
+    for (i = 0; i < TP_NUM_ALGOS; i++) {
+        if (!strcmp(algos[i].name, name)) {
+            return &algos[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Serial algorithms are candidates for any thread budget; threaded algorithms
+ * only when there's more than one thread.  Threads that divide the matrix by
+ * rows or columns need their partitions to be multiples of the tile or block.
+ */
+static int algo_usable(const struct tp_algo *a, enum tp_type type,
+                       size_t A_rows, size_t A_cols, size_t num_thr,
+                       size_t blk_rows, size_t blk_cols)
+{
+    const size_t unit_r = a->blocked ? blk_rows : a->tile[type];
+    const size_t unit_c = a->blocked ? blk_cols : a->tile[type];
+    if (!a->fn[type] || (a->isa && !transpose_dispatch_has_isa(a->isa))) {
+        return 0;
+    }
+    if (a->part == TP_SERIAL) {
+        return !unit_r || a->blocked ||
+               (A_rows % unit_r == 0 && A_cols % unit_c == 0);
+    }
+    if (num_thr < 2) {
+        return 0;
+    }
+    if (!unit_r || a->part == TP_PART_ANY) {
+        return 1;
+    }
+    if (A_rows % unit_r || A_cols % unit_c) {
+        return 0;
+    }
+    if (a->part == TP_PART_ROWS) {
+        return A_rows % num_thr == 0 && (A_rows / num_thr) % unit_r == 0;
+    }
+    return A_cols % num_thr == 0 && (A_cols / num_thr) % unit_c == 0;
+}
+
+static transpose_plan *plan_new(enum tp_type type, size_t A_rows,
+                                size_t A_cols, size_t num_thr,
+                                const struct tp_algo *algo,
+                                size_t blk_rows, size_t blk_cols)
+{
+    transpose_plan *p = assert_malloc(sizeof(transpose_plan));
+    p->type = type;
+    p->A_rows = A_rows;
+    p->A_cols = A_cols;
+    // serial algorithms don't use the thread budget
+    p->num_thr = algo->part == TP_SERIAL ? 1 : num_thr;
+    p->algo = algo;
+    p->blk_rows = blk_rows;
+    p->blk_cols = blk_cols;
+    return p;
+}
+
+static struct tp_wisdom *wisdom_find(enum tp_type type, size_t A_rows,
+                                     size_t A_cols, size_t num_thr)
+{
+    size_t i;
+    for (i = 0; i < wisdom_len; i++) {
+        if (wisdom[i].type == type && wisdom[i].A_rows == A_rows &&
+            wisdom[i].A_cols == A_cols && wisdom[i].num_thr == num_thr) {
+            return &wisdom[i];
+        }
+    }
+    return NULL;
+}
+
+static void wisdom_add(enum tp_type type, size_t A_rows, size_t A_cols,
+                       size_t num_thr, const char *algo,
+                       size_t blk_rows, size_t blk_cols)
+{
+    struct tp_wisdom *w = wisdom_find(type, A_rows, A_cols, num_thr);
+    if (!w) {
+        if (wisdom_len == wisdom_cap) {
+            wisdom_cap = wisdom_cap ? 2 * wisdom_cap : 16;
+            wisdom = realloc(wisdom, wisdom_cap * sizeof(*wisdom));
+            if (!wisdom) {
+                perror("realloc");
+                exit(ENOMEM);
+            }
+        }
+        w = &wisdom[wisdom_len++];
+    }
+    w->type = type;
+    w->A_rows = A_rows;
+    w->A_cols = A_cols;
+    w->num_thr = num_thr;
+    snprintf(w->algo, sizeof(w->algo), "%s", algo);
+    w->blk_rows = blk_rows;
+    w->blk_cols = blk_cols;
+}
+
+/* Plan from wisdom, if there is any and its algorithm works on this CPU */
+static transpose_plan *plan_wisdom(enum tp_type type, size_t A_rows,
+                                   size_t A_cols, size_t num_thr)
+{
+    const struct tp_wisdom *w = wisdom_find(type, A_rows, A_cols, num_thr);
+    const struct tp_algo *a;
+    if (!w || !(a = algo_find(w->algo)) ||
+        !algo_usable(a, type, A_rows, A_cols, num_thr,
+                     w->blk_rows, w->blk_cols)) {
+        return NULL;
+    }
+    return plan_new(type, A_rows, A_cols, num_thr, a,
+                    w->blk_rows, w->blk_cols);
+}
+
+/*
+ * Returns the size in bytes of a data or unified cache at the given level, as
+ * reported by sysfs for CPU 0, or 0 if unknown.
+ */
+static size_t cache_size(int level)
+{
+    char path[128];
+    char buf[32];
+    FILE *f;
+    size_t size;
+    int i, lvl;
+    char unit;
+    for (i = 0; ; i++) {
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/cpu/cpu0/cache/index%d/level", i);
+        if (!(f = fopen(path, "r"))) {
+            return 0;
+        }
+        if (fscanf(f, "%d", &lvl) != 1) {
+            lvl = 0;
+        }
+        fclose(f);
+        if (lvl != level) {
+            continue;
+        }
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/cpu/cpu0/cache/index%d/type", i);
+        if (!(f = fopen(path, "r"))) {
+            continue;
+        }
+        if (!fgets(buf, sizeof(buf), f)) {
+            buf[0] = '\0';
+        }
+        fclose(f);
+        if (strncmp(buf, "Data", 4) && strncmp(buf, "Unified", 7)) {
+            continue;
+        }
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/cpu/cpu0/cache/index%d/size", i);
+        if (!(f = fopen(path, "r"))) {
+            continue;
+        }
+        unit = '\0';
+        if (fscanf(f, "%zu%c", &size, &unit) < 1) {
+            size = 0;
+        }
+        fclose(f);
+        if (unit == 'K') {
+            size *= 1024;
+        } else if (unit == 'M') {
+            size *= 1024 * 1024;
+        }
+        return size;
+    }
+}
+
+/*
+ * Choose without measuring:
+ * - Matrices that fit in half of L1 don't benefit from blocking or threads.
+ * - Threads only pay off once the matrices don't fit in L2.
+ * - Prefer SIMD kernels, then cache-oblivious recursion, over fixed blocks.
+ * - Otherwise, use the largest blocks for which a block of both matrices fits
+ *   in half of L1.
+ */
+static transpose_plan *plan_estimate(enum tp_type type, size_t A_rows,
+                                     size_t A_cols, size_t num_thr)
+{
+    static const char *prefs_small[] = { "naive" };
+    static const char *prefs_thr[] = {
+        "thrrow-avx512-intr", "thrrow-avx2-intr", "thrrec"
+    };
+    static const char *prefs_large[] = {
+        "recursive-avx512-intr", "avx2-intr", "sse2-intr", "recursive"
+    };
+    static const char *prefs_medium[] = {
+        "avx512-intr", "avx2-intr", "sse2-intr", "blocked"
+    };
+    const size_t bytes = A_rows * A_cols * type_sizes[type];
+    size_t l1d = cache_size(1);
+    size_t l2 = cache_size(2);
+    const char **prefs;
+    size_t n_prefs, i, blk;
+    const struct tp_algo *a;
+    if (!l1d) {
+        l1d = TP_DEFAULT_L1D;
+    }
+    if (!l2) {
+        l2 = TP_DEFAULT_L2;
+    }
+    if (2 * bytes <= l1d / 2) {
+        prefs = prefs_small;
+        n_prefs = sizeof(prefs_small) / sizeof(prefs_small[0]);
+    } else if (num_thr > 1 && 2 * bytes > l2) {
+        prefs = prefs_thr;
+        n_prefs = sizeof(prefs_thr) / sizeof(prefs_thr[0]);
+    } else if (2 * bytes > l2) {
+        prefs = prefs_large;
+        n_prefs = sizeof(prefs_large) / sizeof(prefs_large[0]);
+    } else {
+        prefs = prefs_medium;
+        n_prefs = sizeof(prefs_medium) / sizeof(prefs_medium[0]);
+    }
+    for (blk = blk_sizes[TP_NUM_BLK_SIZES - 1];
+         blk > blk_sizes[0] && 2 * blk * blk * type_sizes[type] > l1d / 2;
+         blk /= 2);
+    for (i = 0; i < n_prefs; i++) {
+        a = algo_find(prefs[i]);
+        if (a && algo_usable(a, type, A_rows, A_cols, num_thr, blk, blk)) {
+            return plan_new(type, A_rows, A_cols, num_thr, a, blk, blk);
+        }
+    }
+    return plan_new(type, A_rows, A_cols, num_thr, algo_find("naive"), 0, 0);
+}
+
+/* Returns the best mean time in ns of a transpose, over a few trials */
+static double measure(tp_fn fn, const void* restrict A, void* restrict B,
+                      size_t A_rows, size_t A_cols, size_t num_thr,
+                      size_t blk_rows, size_t blk_cols)
+{
+    struct timespec ts1, ts2;
+    double best = 0, ns;
+    int64_t elapsed;
+    size_t trial, reps;
+    // warm up caches, TLBs, and page mappings
+    fn(A, B, A_rows, A_cols, num_thr, blk_rows, blk_cols);
+    for (trial = 0; trial < TP_MEASURE_TRIALS; trial++) {
+        reps = 0;
+        ptime_gettime_monotonic(&ts1);
+        do {
+            fn(A, B, A_rows, A_cols, num_thr, blk_rows, blk_cols);
+            reps++;
+            ptime_gettime_monotonic(&ts2);
+            elapsed = ptime_elapsed_ns(&ts1, &ts2);
+        } while (elapsed < TP_MEASURE_MIN_NS && reps < TP_MEASURE_MAX_REPS);
+        ns = (double) elapsed / reps;
+        if (!trial || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+// block sizes larger than a dimension are clipped to it, so only try one
+static size_t blk_size_count(size_t dim)
+{
+    size_t i;
+    for (i = 0; i < TP_NUM_BLK_SIZES && blk_sizes[i] < dim; i++);
+    return i < TP_NUM_BLK_SIZES ? i + 1 : i;
+}
+
+static size_t blk_size(size_t dim, size_t i)
+{
+    return blk_sizes[i] < dim ? blk_sizes[i] : dim;
+}
+
+/* Time every usable candidate on scratch matrices and keep the fastest */
+static transpose_plan *plan_measure(enum tp_type type, size_t A_rows,
+                                    size_t A_cols, size_t num_thr)
+{
+    // round up so the allocation is a multiple of the alignment
+    const size_t sz = (A_rows * A_cols * type_sizes[type] + 63) / 64 * 64;
+    void *A = assert_malloc_al(sz);
+    void *B = assert_malloc_al(sz);
+    const struct tp_algo *best = NULL;
+    size_t best_blk_rows = 0, best_blk_cols = 0;
+    double best_ns = 0, ns;
+    size_t i, br, bc, n_br, n_bc, blk_rows, blk_cols;
+    transpose_plan *p;
+
+    memset(A, 0, sz);
+    memset(B, 0, sz);
+    for (i = 0; i < TP_NUM_ALGOS; i++) {
+        n_br = algos[i].blocked ? blk_size_count(A_rows) : 1;
+        n_bc = algos[i].blocked ? blk_size_count(A_cols) : 1;
+        for (br = 0; br < n_br; br++) {
+            for (bc = 0; bc < n_bc; bc++) {
+                blk_rows = algos[i].blocked ? blk_size(A_rows, br) : 0;
+                blk_cols = algos[i].blocked ? blk_size(A_cols, bc) : 0;
+                if (!algo_usable(&algos[i], type, A_rows, A_cols, num_thr,
+                                 blk_rows, blk_cols)) {
+                    continue;
+                }
+                ns = measure(algos[i].fn[type], A, B, A_rows, A_cols, num_thr,
+                             blk_rows, blk_cols);
+                if (!best || ns < best_ns) {
+                    best = &algos[i];
+                    best_ns = ns;
+                    best_blk_rows = blk_rows;
+                    best_blk_cols = blk_cols;
+                }
+            }
+        }
+    }
+    free_al(B);
+    free_al(A);
+
+    p = plan_new(type, A_rows, A_cols, num_thr, best,
+                 best_blk_rows, best_blk_cols);
+    wisdom_add(type, A_rows, A_cols, num_thr, best->name,
+               best_blk_rows, best_blk_cols);
+    return p;
+}
+
+static transpose_plan *plan_create(enum tp_type type, size_t A_rows,
+                                   size_t A_cols, size_t num_thr,
+                                   transpose_plan_mode mode)
+{
+    transpose_plan *p;
+    if (!A_rows || !A_cols || !num_thr) {
+        errno = EINVAL;
+        return NULL;
+    }
+    if ((p = plan_wisdom(type, A_rows, A_cols, num_thr))) {
+        return p;
+    }
+    if (mode == TRANSPOSE_PLAN_MEASURE) {
+        return plan_measure(type, A_rows, A_cols, num_thr);
+    }
+    return plan_estimate(type, A_rows, A_cols, num_thr);
+}
+
+static void plan_execute(const transpose_plan *p, enum tp_type type,
+                         const void* restrict A, void* restrict B)
+{
+    if (p->type != type) {
+        fprintf(stderr, "transpose_execute: plan is for type %s, not %s\n",
+                type_names[p->type], type_names[type]);
+        exit(EINVAL);
+    }
+    if (((uintptr_t) A | (uintptr_t) B) % p->algo->align) {
+        fallback[type](A, B, p->A_rows, p->A_cols, 1, 0, 0);
+    } else {
+        p->algo->fn[type](A, B, p->A_rows, p->A_cols, p->num_thr,
+                          p->blk_rows, p->blk_cols);
+    }
+}
+
+transpose_plan *transpose_plan_flt(size_t A_rows, size_t A_cols,
+                                   size_t num_thr, transpose_plan_mode mode)
+{
+    return plan_create(TP_FLT, A_rows, A_cols, num_thr, mode);
+}
+
+transpose_plan *transpose_plan_dbl(size_t A_rows, size_t A_cols,
+                                   size_t num_thr, transpose_plan_mode mode)
+{
+    return plan_create(TP_DBL, A_rows, A_cols, num_thr, mode);
+}
+
+transpose_plan *transpose_plan_fcmplx(size_t A_rows, size_t A_cols,
+                                      size_t num_thr, transpose_plan_mode mode)
+{
+    return plan_create(TP_FCMPLX, A_rows, A_cols, num_thr, mode);
+}
+
+transpose_plan *transpose_plan_dcmplx(size_t A_rows, size_t A_cols,
+                                      size_t num_thr, transpose_plan_mode mode)
+{
+    return plan_create(TP_DCMPLX, A_rows, A_cols, num_thr, mode);
+}
+
+void transpose_execute_flt(const transpose_plan *p,
+                           const float* restrict A, float* restrict B)
+{
+    plan_execute(p, TP_FLT, A, B);
+}
+
+void transpose_execute_dbl(const transpose_plan *p,
+                           const double* restrict A, double* restrict B)
+{
+    plan_execute(p, TP_DBL, A, B);
+}
+
+void transpose_execute_fcmplx(const transpose_plan *p,
+                              const float complex* restrict A,
+                              float complex* restrict B)
+{
+    plan_execute(p, TP_FCMPLX, A, B);
+}
+
+void transpose_execute_dcmplx(const transpose_plan *p,
+                              const double complex* restrict A,
+                              double complex* restrict B)
+{
+    plan_execute(p, TP_DCMPLX, A, B);
+}
+
+void transpose_plan_destroy(transpose_plan *p)
+{
+    free(p);
+}
+
+void transpose_plan_describe(const transpose_plan *p, char *buf, size_t len)
+{
+    char blk[48] = "";
+    char thr[24] = "";
+    if (p->algo->blocked) {
+        snprintf(blk, sizeof(blk), " %zux%zu", p->blk_rows, p->blk_cols);
+    }
+    if (p->algo->part != TP_SERIAL) {
+        snprintf(thr, sizeof(thr), " x%zu", p->num_thr);
+    }
+    snprintf(buf, len, "%s%s%s", p->algo->name, blk, thr);
+}
+
+/*
+ * Wisdom files have one plan per line:
+ *   TYPE ROWS COLS THREADS ALGORITHM BLOCK_ROWS BLOCK_COLS
+ * Lines starting with '#' are comments.
+ */
+int transpose_wisdom_import(const char *path)
+{
+    char line[256];
+    char type[TP_TYPE_NAME_LEN];
+    char algo[TP_ALGO_NAME_LEN];
+    size_t A_rows, A_cols, num_thr, blk_rows, blk_cols, t;
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "%7s %zu %zu %zu %31s %zu %zu", type, &A_rows,
+                   &A_cols, &num_thr, algo, &blk_rows, &blk_cols) != 7) {
+            fclose(f);
+            errno = EINVAL;
+            return -1;
+        }
+        for (t = 0; t < TP_NUM_TYPES && strcmp(type, type_names[t]); t++);
+        if (t == TP_NUM_TYPES || !algo_find(algo)) {
+            fclose(f);
+            errno = EINVAL;
+            return -1;
+        }
+        wisdom_add((enum tp_type) t, A_rows, A_cols, num_thr, algo,
+                   blk_rows, blk_cols);
+    }
+    if (ferror(f)) {
+        fclose(f);
+        errno = EIO;
+        return -1;
+    }
+    return fclose(f);
+}
+
+int transpose_wisdom_export(const char *path)
+{
+    size_t i;
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        return -1;
+    }
+    fprintf(f, "# TYPE ROWS COLS THREADS ALGORITHM BLOCK_ROWS BLOCK_COLS\n");
+    for (i = 0; i < wisdom_len; i++) {
+        fprintf(f, "%s %zu %zu %zu %s %zu %zu\n", type_names[wisdom[i].type],
+                wisdom[i].A_rows, wisdom[i].A_cols, wisdom[i].num_thr,
+                wisdom[i].algo, wisdom[i].blk_rows, wisdom[i].blk_cols);
+    }
+    if (ferror(f)) {
+        fclose(f);
+        errno = EIO;
+        return -1;
+    }
+    return fclose(f);
+}
+
+void transpose_wisdom_forget(void)
+{
+    free(wisdom);
+    wisdom = NULL;
+    wisdom_len = 0;
+    wisdom_cap = 0;
+}
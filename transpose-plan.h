@@ -0,0 +1,88 @@
+/**
+ * Transpose planner.
+ *
+ * Like an FFTW plan, a transpose plan picks the fastest transpose algorithm
+ * (and block size, where applicable) for a data type, matrix shape, and thread
+ * budget, then is executed any number of times.
+ *
+ * In TRANSPOSE_PLAN_ESTIMATE mode, the planner chooses with a heuristic based
+ * on the cache sizes reported in sysfs, without running anything.
+ * In TRANSPOSE_PLAN_MEASURE mode, it times every candidate on scratch buffers
+ * (allocated for the purpose, the same size as the matrices) and keeps the
+ * fastest, then remembers the choice as "wisdom".
+ * Wisdom can be exported to and imported from a file, so later runs with the
+ * same type, shape, and thread budget get the measured plan without timing.
+ *
+ * Plans assume that matrices are 64-byte aligned, e.g., allocated with
+ * assert_malloc_al() or fftw(f)_malloc().  If a plan's kernel needs alignment
+ * that the matrices don't have, execution falls back to the dispatcher.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_PLAN_H
+#define TRANSPOSE_PLAN_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+typedef enum transpose_plan_mode {
+    TRANSPOSE_PLAN_ESTIMATE = 0,
+    TRANSPOSE_PLAN_MEASURE,
+} transpose_plan_mode;
+
+typedef struct transpose_plan transpose_plan;
+
+transpose_plan *transpose_plan_flt(size_t A_rows, size_t A_cols,
+                                   size_t num_thr, transpose_plan_mode mode);
+
+transpose_plan *transpose_plan_dbl(size_t A_rows, size_t A_cols,
+                                   size_t num_thr, transpose_plan_mode mode);
+
+transpose_plan *transpose_plan_fcmplx(size_t A_rows, size_t A_cols,
+                                      size_t num_thr, transpose_plan_mode mode);
+
+transpose_plan *transpose_plan_dcmplx(size_t A_rows, size_t A_cols,
+                                      size_t num_thr, transpose_plan_mode mode);
+
+/* A plan must be executed with the type it was created for */
+void transpose_execute_flt(const transpose_plan *p,
+                           const float* restrict A, float* restrict B);
+
+void transpose_execute_dbl(const transpose_plan *p,
+                           const double* restrict A, double* restrict B);
+
+void transpose_execute_fcmplx(const transpose_plan *p,
+                              const float complex* restrict A,
+                              float complex* restrict B);
+
+void transpose_execute_dcmplx(const transpose_plan *p,
+                              const double complex* restrict A,
+                              double complex* restrict B);
+
+void transpose_plan_destroy(transpose_plan *p);
+
+/**
+ * Write a description of the plan, e.g., "blocked 64x32" or "thrrec x4", to
+ * buf, truncated to len bytes (including the terminating null byte).
+ */
+void transpose_plan_describe(const transpose_plan *p, char *buf, size_t len);
+
+/**
+ * Merge the wisdom in a file into the wisdom in memory.
+ * Returns 0 on success, or -1 and sets errno on failure.
+ */
+int transpose_wisdom_import(const char *path);
+
+/**
+ * Write all wisdom in memory to a file.
+ * Returns 0 on success, or -1 and sets errno on failure.
+ */
+int transpose_wisdom_export(const char *path);
+
+/**
+ * Discard all wisdom in memory.
+ */
+void transpose_wisdom_forget(void);
+
+#endif /* TRANSPOSE_PLAN_H */
@@ -0,0 +1,28 @@
+/**
+ * Block kernel shared by the serial and threaded in-place square transposes.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_SQUARE_H
+#define TRANSPOSE_SQUARE_H
+
+#include <stdlib.h>
+
+/*
+ * In-place transpose of a square matrix with n columns: swap each element in
+ * the block above the diagonal with its mirror below the diagonal.
+ */
+#define TRANSPOSE_SQ_BLK(datatype, A, n, r_min, c_min, r_max, c_max) { \
+    size_t r, c; \
+    datatype tmp; \
+    for (r = (r_min); r < (r_max); r++) { \
+        for (c = ((c_min) > r ? (c_min) : r + 1); c < (c_max); c++) { \
+            tmp = (A)[(r) * (n) + (c)]; \
+            (A)[(r) * (n) + (c)] = (A)[(c) * (n) + (r)]; \
+            (A)[(c) * (n) + (r)] = tmp; \
+        } \
+    } \
+}
+
+#endif /* TRANSPOSE_SQUARE_H */
@@ -0,0 +1,141 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#undef NDEBUG
+#include <assert.h>
+#include <complex.h>
+#include <stdlib.h>
+
+// intrinsics
+#include <emmintrin.h>
+
+#include "transpose-sse2.h"
+
+/*
+ * Transpose the n x n tiles of A in rows [r_min, r_max) and columns
+ * [c_min, c_max) into B, using the tile kernels for vector type vtype.
+ */
+#define TRANSPOSE_SSE2_TILES(vtype, n, fn_load, fn_transp, fn_store, A, B, \
+                             A_rows, A_cols, r_min, r_max, c_min, c_max) { \
+    size_t r, c; \
+    vtype v[n]; \
+    for (r = (r_min); r < (r_max); r += (n)) { \
+        for (c = (c_min); c < (c_max); c += (n)) { \
+            fn_load(v, &(A)[r * (A_cols) + c], A_cols); \
+            fn_transp(v); \
+            fn_store(&(B)[c * (A_rows) + r], A_rows, v); \
+        } \
+    } \
+}
+
+static inline void load_4x4_ps(__m128 r[4], const float *blk, size_t ld)
+{
+    r[0] = _mm_load_ps(&blk[0]);
+    r[1] = _mm_load_ps(&blk[ld]);
+    r[2] = _mm_load_ps(&blk[2*ld]);
+    r[3] = _mm_load_ps(&blk[3*ld]);
+}
+
+static inline void transpose_4x4_ps(__m128 r[4])
+{
+    _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+}
+
+static inline void store_4x4_ps(float *blk, size_t ld, const __m128 r[4])
+{
+    _mm_store_ps(&blk[0], r[0]);
+    _mm_store_ps(&blk[ld], r[1]);
+    _mm_store_ps(&blk[2*ld], r[2]);
+    _mm_store_ps(&blk[3*ld], r[3]);
+}
+
+static inline void load_2x2_pd(__m128d r[2], const double *blk, size_t ld)
+{
+    r[0] = _mm_load_pd(&blk[0]);
+    r[1] = _mm_load_pd(&blk[ld]);
+}
+
+static inline void transpose_2x2_pd(__m128d r[2])
+{
+    const __m128d s0 = _mm_unpacklo_pd(r[0], r[1]);
+    const __m128d s1 = _mm_unpackhi_pd(r[0], r[1]);
+    r[0] = s0;
+    r[1] = s1;
+}
+
+static inline void store_2x2_pd(double *blk, size_t ld, const __m128d r[2])
+{
+    _mm_store_pd(&blk[0], r[0]);
+    _mm_store_pd(&blk[ld], r[1]);
+}
+
+// a double complex value fills a register, so there's nothing to shuffle
+static inline void load_1x1_cpd(__m128d r[1], const double complex *blk,
+                                size_t ld)
+{
+    (void) ld;
+    r[0] = _mm_load_pd((const double *)blk);
+}
+
+static inline void transpose_1x1_cpd(__m128d r[1])
+{
+    (void) r;
+}
+
+static inline void store_1x1_cpd(double complex *blk, size_t ld,
+                                 const __m128d r[1])
+{
+    (void) ld;
+    _mm_store_pd((double *)blk, r[0]);
+}
+
+/*
+ * Transpose 4x4 blocks of floats.  It will not work correctly unless both
+ * A_rows and A_cols are multiples of 4.
+ */
+void transpose_flt_sse2_intr(const float* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    assert(A_rows % 4 == 0);
+    assert(A_cols % 4 == 0);
+    TRANSPOSE_SSE2_TILES(__m128, 4, load_4x4_ps, transpose_4x4_ps,
+                         store_4x4_ps, A, B, A_rows, A_cols,
+                         0, A_rows, 0, A_cols);
+}
+
+/*
+ * Transpose 2x2 blocks of doubles.  It will not work correctly unless both
+ * A_rows and A_cols are multiples of 2.
+ */
+void transpose_dbl_sse2_intr(const double* restrict A, double* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    assert(A_rows % 2 == 0);
+    assert(A_cols % 2 == 0);
+    TRANSPOSE_SSE2_TILES(__m128d, 2, load_2x2_pd, transpose_2x2_pd,
+                         store_2x2_pd, A, B, A_rows, A_cols,
+                         0, A_rows, 0, A_cols);
+}
+
+/*
+ * A float complex value is 64 bits, so it can be moved as a double.
+ */
+void transpose_fcmplx_sse2_intr(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    transpose_dbl_sse2_intr((const double* restrict)A, (double* restrict)B,
+                            A_rows, A_cols);
+}
+
+void transpose_dcmplx_sse2_intr(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_SSE2_TILES(__m128d, 1, load_1x1_cpd, transpose_1x1_cpd,
+                         store_1x1_cpd, A, B, A_rows, A_cols,
+                         0, A_rows, 0, A_cols);
+}
@@ -0,0 +1,27 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_SSE2_H
+#define TRANSPOSE_SSE2_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+void transpose_flt_sse2_intr(const float* restrict A, float* restrict B,
+                             size_t A_rows, size_t A_cols);
+
+void transpose_dbl_sse2_intr(const double* restrict A, double* restrict B,
+                             size_t A_rows, size_t A_cols);
+
+void transpose_fcmplx_sse2_intr(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+void transpose_dcmplx_sse2_intr(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+#endif /* TRANSPOSE_SSE2_H */
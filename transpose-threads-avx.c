@@ -6,21 +6,27 @@
  */
 #undef NDEBUG
 #include <assert.h>
-#include <errno.h>
+#include <complex.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <pthread.h>
 
 // intrinsics
 #include <immintrin.h>
 
+#include "transpose-avx512-kernels.h"
 #include "transpose-threads-avx.h"
-#include "util.h"
+#include "thread-pool.h"
 
 struct tr_thread_arg {
     const void* restrict A;
     void* restrict B;
     size_t A_rows, A_cols, r_min, r_max, c_min, c_max, thr_num;
+    // leading dimensions (row strides) of A and B
+    size_t lda, ldb;
+    // elements from one matrix of a batch to the next
+    size_t stride;
+    const transpose_epilogue *epi;
 };
 
 static void tt_arg_init(struct tr_thread_arg *tt_arg,
@@ -38,156 +44,264 @@ static void tt_arg_init(struct tr_thread_arg *tt_arg,
     tt_arg->c_min = c_min;
     tt_arg->c_max = c_max;
     tt_arg->thr_num = thr_num;
+    tt_arg->lda = A_cols;
+    tt_arg->ldb = A_rows;
+    tt_arg->stride = A_rows * A_cols;
+    tt_arg->epi = NULL;
+}
+
+// transpose a thread's partition, which starts on a tile boundary (or is empty)
+#define TRANSP_THREAD_TILES(datatype, vtype, n, fn_load, fn_load_mask, \
+                            fn_transp, fn_store, fn_store_mask, arg) { \
+    assert((arg)->r_min % (n) == 0 || (arg)->r_min == (arg)->r_max); \
+    assert((arg)->c_min % (n) == 0 || (arg)->c_min == (arg)->c_max); \
+    TRANSPOSE_AVX512_TILES(vtype, n, fn_load, fn_load_mask, fn_transp, \
+                           fn_store, fn_store_mask, \
+                           (const datatype* restrict)(arg)->A, \
+                           (datatype* restrict)(arg)->B, \
+                           (arg)->A_rows, (arg)->A_cols, \
+                           (arg)->lda, (arg)->ldb, \
+                           (arg)->r_min, (arg)->r_max, \
+                           (arg)->c_min, (arg)->c_max); \
+}
+
+// in-place transpose of the square matrix in B, by block rows of the upper
+// triangle (including the diagonal)
+#define TRANSP_THREAD_SQUARE_TILES(datatype, vtype, n, fn_load, fn_load_mask, \
+                                   fn_transp, fn_store, fn_store_mask, arg) { \
+    datatype* restrict A = (arg)->B; \
+    assert((arg)->r_min % (n) == 0 || (arg)->r_min == (arg)->r_max); \
+    TRANSPOSE_AVX512_SQUARE_TILES(vtype, n, fn_load, fn_load_mask, fn_transp, \
+                                  fn_store, fn_store_mask, A, (arg)->A_cols, \
+                                  (arg)->r_min, (arg)->r_max); \
+}
+
+// transpose a thread's share [r_min, r_max) of a batch of matrices: whole
+// matrices if they're packed into vectors, otherwise tile rows of the stacked
+// matrices (a share may start or end part way through a matrix)
+#define TRANSP_THREAD_BATCH(datatype, vtype, n, fn_load, fn_load_mask, \
+                            fn_transp, fn_store, fn_store_mask, fn_packed, \
+                            arg) { \
+    const datatype* restrict A = (arg)->A; \
+    datatype* restrict B = (arg)->B; \
+    const size_t rows = (arg)->A_rows; \
+    const size_t cols = (arg)->A_cols; \
+    const size_t stride = (arg)->stride; \
+    const size_t tr = (rows + (n) - 1) / (n); \
+    size_t u, u_next, i, r_end; \
+    if (TRANSPOSE_BATCH_PACKED(n, rows, cols, stride)) { \
+        fn_packed(&A[(arg)->r_min * stride], &B[(arg)->r_min * stride], \
+                  rows, cols, (arg)->r_max - (arg)->r_min); \
+    } else { \
+        for (u = (arg)->r_min; u < (arg)->r_max; u = u_next) { \
+            i = u / tr; \
+            u_next = (i + 1) * tr < (arg)->r_max ? \
+                     (i + 1) * tr : (arg)->r_max; \
+            r_end = (u_next - i * tr) * (n) < rows ? \
+                    (u_next - i * tr) * (n) : rows; \
+            TRANSPOSE_AVX512_TILES(vtype, n, fn_load, fn_load_mask, \
+                                   fn_transp, fn_store, fn_store_mask, \
+                                   &A[i * stride], &B[i * stride], \
+                                   rows, cols, cols, rows, \
+                                   (u - i * tr) * (n), r_end, 0, cols); \
+        } \
+    } \
+}
+
+static void *transpose_thread_blocked_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_TILES(float, __m512, 16, load_16x16_ps, load_16x16_ps_mask,
+                        transpose_16x16_ps, store_16x16_ps,
+                        store_16x16_ps_mask, tt_arg);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_blocked_dbl(void *args)
 {
-    // used for swapping 2x2 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_2x2_0 = {
-        0x0000, 0x0001, 0x0008, 0x0009, 0x0004, 0x0005, 0x000c, 0x000d
-    };
-    static const __m512i idx_2x2_1 = {
-        0x000a, 0x000b, 0x0002, 0x0003, 0x000e, 0x000f, 0x0006, 0x0007
-    };
-    // used for swapping 4x4 blocks using _mm512_permutex2var_pd()
-    static const __m512i idx_4x4_0 = {
-        0x0000, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x000a, 0x000b
-    };
-    static const __m512i idx_4x4_1 = {
-        0x000c, 0x000d, 0x000e, 0x000f, 0x0004, 0x0005, 0x0006, 0x0007
-    };
     const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
-    const double* restrict A = tt_arg->A;
-    double* restrict B = tt_arg->B;
-    const size_t start_rblk_num = tt_arg->r_min / 8;
-    const size_t end_rblk_num = tt_arg->r_max / 8;
-    const size_t start_cblk_num = tt_arg->c_min / 8;
-    const size_t end_cblk_num = tt_arg->c_max / 8;
-    const double *A_block;
-    double *B_block;
-    size_t rblk_num, cblk_num, r_min, c_min;
-    // alternate the reads and writes between the r and s vector registers, all
-    // of which hold matrix rows
-    __m512d r[8], s[8];
-
-    assert(tt_arg->A_rows % 8 == 0);
-    assert(tt_arg->A_cols % 8 == 0);
-    assert(tt_arg->r_min % 8 == 0);
-    assert(tt_arg->r_max % 8 == 0);
-    assert(tt_arg->c_min % 8 == 0);
-    assert(tt_arg->c_max % 8 == 0);
-
-    for (rblk_num = start_rblk_num; rblk_num < end_rblk_num; rblk_num++) {
-        r_min = rblk_num * 8;
-        for (cblk_num = start_cblk_num; cblk_num < end_cblk_num; cblk_num++) {
-            c_min = cblk_num * 8;
-
-            A_block = &A[r_min * tt_arg->A_cols + c_min];
-            B_block = &B[c_min * tt_arg->A_rows + r_min];
-
-            // read 8x8 block of read array
-            r[0] = _mm512_load_pd(&A_block[0]);
-            r[1] = _mm512_load_pd(&A_block[tt_arg->A_cols]);
-            r[2] = _mm512_load_pd(&A_block[2*tt_arg->A_cols]);
-            r[3] = _mm512_load_pd(&A_block[3*tt_arg->A_cols]);
-            r[4] = _mm512_load_pd(&A_block[4*tt_arg->A_cols]);
-            r[5] = _mm512_load_pd(&A_block[5*tt_arg->A_cols]);
-            r[6] = _mm512_load_pd(&A_block[6*tt_arg->A_cols]);
-            r[7] = _mm512_load_pd(&A_block[7*tt_arg->A_cols]);
-
-            // shuffle doubles within 128-bit lanes
-            s[0] = _mm512_unpacklo_pd(r[0], r[1]);
-            s[1] = _mm512_unpackhi_pd(r[0], r[1]);
-            s[2] = _mm512_unpacklo_pd(r[2], r[3]);
-            s[3] = _mm512_unpackhi_pd(r[2], r[3]);
-            s[4] = _mm512_unpacklo_pd(r[4], r[5]);
-            s[5] = _mm512_unpackhi_pd(r[4], r[5]);
-            s[6] = _mm512_unpacklo_pd(r[6], r[7]);
-            s[7] = _mm512_unpackhi_pd(r[6], r[7]);
-
-            // shuffle 2x2 blocks of doubles
-            r[0] = _mm512_permutex2var_pd(s[0], idx_2x2_0, s[2]);
-            r[1] = _mm512_permutex2var_pd(s[1], idx_2x2_0, s[3]);
-            r[2] = _mm512_permutex2var_pd(s[2], idx_2x2_1, s[0]);
-            r[3] = _mm512_permutex2var_pd(s[3], idx_2x2_1, s[1]);
-            r[4] = _mm512_permutex2var_pd(s[4], idx_2x2_0, s[6]);
-            r[5] = _mm512_permutex2var_pd(s[5], idx_2x2_0, s[7]);
-            r[6] = _mm512_permutex2var_pd(s[6], idx_2x2_1, s[4]);
-            r[7] = _mm512_permutex2var_pd(s[7], idx_2x2_1, s[5]);
-
-            // shuffle 4x4 blocks of doubles
-            s[0] = _mm512_permutex2var_pd(r[0], idx_4x4_0, r[4]);
-            s[1] = _mm512_permutex2var_pd(r[1], idx_4x4_0, r[5]);
-            s[2] = _mm512_permutex2var_pd(r[2], idx_4x4_0, r[6]);
-            s[3] = _mm512_permutex2var_pd(r[3], idx_4x4_0, r[7]);
-            s[4] = _mm512_permutex2var_pd(r[4], idx_4x4_1, r[0]);
-            s[5] = _mm512_permutex2var_pd(r[5], idx_4x4_1, r[1]);
-            s[6] = _mm512_permutex2var_pd(r[6], idx_4x4_1, r[2]);
-            s[7] = _mm512_permutex2var_pd(r[7], idx_4x4_1, r[3]);
-
-            // write back 8x8 block of write array
-#if defined(USE_AVX_STREAMING_STORES)
-            _mm512_stream_pd(&B_block[0], s[0]);
-            _mm512_stream_pd(&B_block[tt_arg->A_rows], s[1]);
-            _mm512_stream_pd(&B_block[2*tt_arg->A_rows], s[2]);
-            _mm512_stream_pd(&B_block[3*tt_arg->A_rows], s[3]);
-            _mm512_stream_pd(&B_block[4*tt_arg->A_rows], s[4]);
-            _mm512_stream_pd(&B_block[5*tt_arg->A_rows], s[5]);
-            _mm512_stream_pd(&B_block[6*tt_arg->A_rows], s[6]);
-            _mm512_stream_pd(&B_block[7*tt_arg->A_rows], s[7]);
-#else
-            _mm512_store_pd(&B_block[0], s[0]);
-            _mm512_store_pd(&B_block[tt_arg->A_rows], s[1]);
-            _mm512_store_pd(&B_block[2*tt_arg->A_rows], s[2]);
-            _mm512_store_pd(&B_block[3*tt_arg->A_rows], s[3]);
-            _mm512_store_pd(&B_block[4*tt_arg->A_rows], s[4]);
-            _mm512_store_pd(&B_block[5*tt_arg->A_rows], s[5]);
-            _mm512_store_pd(&B_block[6*tt_arg->A_rows], s[6]);
-            _mm512_store_pd(&B_block[7*tt_arg->A_rows], s[7]);
-#endif
-        }
-    }
+    TRANSP_THREAD_TILES(double, __m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                        transpose_8x8_pd, store_8x8_pd, store_8x8_pd_mask,
+                        tt_arg);
+    return (void *)tt_arg->thr_num;
+}
 
-    pthread_exit((void *)tt_arg->thr_num);
+static void *transpose_thread_blocked_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_TILES(double complex, __m512d, 4, load_4x4_cpd,
+                        load_4x4_cpd_mask, transpose_4x4_cpd, store_4x4_cpd,
+                        store_4x4_cpd_mask, tt_arg);
+    return (void *)tt_arg->thr_num;
 }
 
-void transpose_dbl_thrrow_avx512_intr(const double* restrict A,
-                                      double* restrict B,
-                                      size_t A_rows, size_t A_cols,
-                                      size_t num_thr)
+static void *transpose_thread_square_dbl(void *args)
 {
-    size_t r_min, r_max, thr_num;
-    const size_t rows_per_thr = A_rows / num_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_SQUARE_TILES(double, __m512d, 8, load_8x8_pd,
+                               load_8x8_pd_mask, transpose_8x8_pd,
+                               store_8x8_pd, store_8x8_pd_mask, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_SQUARE_TILES(double complex, __m512d, 4, load_4x4_cpd,
+                               load_4x4_cpd_mask, transpose_4x4_cpd,
+                               store_4x4_cpd, store_4x4_cpd_mask, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_batch_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_BATCH(float, __m512, 16, load_16x16_ps, load_16x16_ps_mask,
+                        transpose_16x16_ps, store_16x16_ps,
+                        store_16x16_ps_mask, transpose_batch_packed_ps,
+                        tt_arg);
+    return (void *)tt_arg->thr_num;
+}
 
-    assert(A_rows % num_thr == 0);
+static void *transpose_thread_batch_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_BATCH(double, __m512d, 8, load_8x8_pd, load_8x8_pd_mask,
+                        transpose_8x8_pd, store_8x8_pd, store_8x8_pd_mask,
+                        transpose_batch_packed_pd, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_batch_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_BATCH(double complex, __m512d, 4, load_4x4_cpd,
+                        load_4x4_cpd_mask, transpose_4x4_cpd, store_4x4_cpd,
+                        store_4x4_cpd_mask, transpose_batch_packed_cpd,
+                        tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_epi_fcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const double* restrict A = (const double* restrict)tt_arg->A;
+    double* restrict B = (double* restrict)tt_arg->B;
+    TRANSPOSE_AVX512_TILES_EPI(__m512d, 8, 1, load_8x8_pd, load_8x8_pd_mask,
+                               transpose_8x8_pd, epilogue_init_cps,
+                               epilogue_cps, twiddle_cps, A, B,
+                               tt_arg->A_rows, tt_arg->A_cols,
+                               tt_arg->lda, tt_arg->ldb,
+                               tt_arg->r_min, tt_arg->r_max,
+                               tt_arg->c_min, tt_arg->c_max, tt_arg->epi);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_epi_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    const double complex* restrict A =
+        (const double complex* restrict)tt_arg->A;
+    double complex* restrict B = (double complex* restrict)tt_arg->B;
+    TRANSPOSE_AVX512_TILES_EPI(__m512d, 4, 2, load_4x4_cpd, load_4x4_cpd_mask,
+                               transpose_4x4_cpd, epilogue_init_cpd,
+                               epilogue_cpd, twiddle_cpd, A, B,
+                               tt_arg->A_rows, tt_arg->A_cols,
+                               tt_arg->lda, tt_arg->ldb,
+                               tt_arg->r_min, tt_arg->r_max,
+                               tt_arg->c_min, tt_arg->c_max, tt_arg->epi);
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Returns the first row (or column) of a thread's share of n rows (or
+ * columns), dividing the blk-sized tiles as evenly as possible between
+ * threads, so that each share starts on a tile boundary.  Neither n nor the
+ * tile count need be a multiple of the thread count.
+ */
+static size_t tile_split(size_t n, size_t blk, size_t num_thr, size_t thr_num)
+{
+    const size_t num_blks = (n + blk - 1) / blk;
+    const size_t r = num_blks * thr_num / num_thr * blk;
+    return r < n ? r : n;
+}
+
+static void transpose_thrrow(const void* restrict A, void* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr,
+                             size_t blk, void *(*start_routine)(void *))
+{
+    size_t r_min, r_max, thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
 
     for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        r_min = thr_num * rows_per_thr;
-        r_max = r_min + rows_per_thr;
+        r_min = tile_split(A_rows, blk, num_thr, thr_num);
+        r_max = tile_split(A_rows, blk, num_thr, thr_num + 1);
 
         tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
                     r_min, r_max, 0, A_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, &transpose_thread_blocked_dbl,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
-        }
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
     }
 
-    // wait for the other threads
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+static void transpose_thrcol(const void* restrict A, void* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr,
+                             size_t blk, void *(*start_routine)(void *))
+{
+    size_t c_min, c_max, thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+
     for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
+        c_min = tile_split(A_cols, blk, num_thr, thr_num);
+        c_max = tile_split(A_cols, blk, num_thr, thr_num + 1);
+
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    0, A_rows, c_min, c_max, thr_num);
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
     }
 
-    free(args);
-    free(threads);
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+void transpose_flt_thrrow_avx512_intr(const float* restrict A,
+                                      float* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 16,
+                     &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrrow_avx512_intr(const double* restrict A,
+                                      double* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 8,
+                     &transpose_thread_blocked_dbl);
+}
+
+void transpose_dcmplx_thrrow_avx512_intr(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 4,
+                     &transpose_thread_blocked_dcmplx);
+}
+
+void transpose_flt_thrcol_avx512_intr(const float* restrict A,
+                                      float* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 16,
+                     &transpose_thread_blocked_flt);
 }
 
 void transpose_dbl_thrcol_avx512_intr(const double* restrict A,
@@ -195,36 +309,235 @@ void transpose_dbl_thrcol_avx512_intr(const double* restrict A,
                                       size_t A_rows, size_t A_cols,
                                       size_t num_thr)
 {
-    size_t c_min, c_max, thr_num;
-    const size_t cols_per_thr = A_cols / num_thr;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    transpose_thrcol(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 8,
+                     &transpose_thread_blocked_dbl);
+}
 
-    assert(A_cols % num_thr == 0);
+void transpose_dcmplx_thrcol_avx512_intr(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 4,
+                     &transpose_thread_blocked_dcmplx);
+}
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.
+ */
+void transpose_flt_thrrow_avx512_intr_ld(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, lda, ldb, num_thr, 16,
+                     &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrrow_avx512_intr_ld(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, lda, ldb, num_thr, 8,
+                     &transpose_thread_blocked_dbl);
+}
+
+void transpose_dcmplx_thrrow_avx512_intr_ld(const double complex* restrict A,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t lda, size_t ldb,
+                                            size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, lda, ldb, num_thr, 4,
+                     &transpose_thread_blocked_dcmplx);
+}
+
+void transpose_flt_thrcol_avx512_intr_ld(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, lda, ldb, num_thr, 16,
+                     &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrcol_avx512_intr_ld(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, lda, ldb, num_thr, 8,
+                     &transpose_thread_blocked_dbl);
+}
+
+void transpose_dcmplx_thrcol_avx512_intr_ld(const double complex* restrict A,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t lda, size_t ldb,
+                                            size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, lda, ldb, num_thr, 4,
+                     &transpose_thread_blocked_dcmplx);
+}
+
+/*
+ * Returns the first block row of a thread's share of the upper triangle
+ * (including the diagonal) of an n x n matrix of blocks, balancing the number
+ * of blocks per thread.
+ */
+static size_t tri_row_split(size_t n, size_t num_thr, size_t thr_num)
+{
+    const double b = 2.0 * n + 1.0;
+    double t, k;
+    if (thr_num >= num_thr) {
+        return n;
+    }
+    t = (double) thr_num / num_thr * n * (n + 1) / 2.0;
+    k = (b - sqrt(b * b - 8.0 * t)) / 2.0 + 0.5;
+    return k < n ? (size_t) k : n;
+}
+
+static void transpose_thrrow_square(void* A, size_t n, size_t blk,
+                                    size_t num_thr,
+                                    void *(*start_routine)(void *))
+{
+    // the last block row and column may be partial
+    const size_t num_blks = (n + blk - 1) / blk;
+    size_t r_min, r_max, thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
 
     for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        c_min = thr_num * cols_per_thr;
-        c_max = c_min + cols_per_thr;
+        r_min = tri_row_split(num_blks, num_thr, thr_num) * blk;
+        r_max = tri_row_split(num_blks, num_thr, thr_num + 1) * blk;
+        r_min = r_min < n ? r_min : n;
+        r_max = r_max < n ? r_max : n;
 
+        tt_arg_init(&args[thr_num], NULL, A, n, n,
+                    r_min, r_max, 0, n, thr_num);
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+void transpose_dbl_thrrow_square_avx512_intr(double* A, size_t n,
+                                             size_t num_thr)
+{
+    transpose_thrrow_square(A, n, 8, num_thr, &transpose_thread_square_dbl);
+}
+
+void transpose_dcmplx_thrrow_square_avx512_intr(double complex* A, size_t n,
+                                                size_t num_thr)
+{
+    transpose_thrrow_square(A, n, 4, num_thr,
+                            &transpose_thread_square_dcmplx);
+}
+
+/*
+ * Batched transposes divide the batch's work units -- whole matrices if they
+ * are packed into vectors, otherwise the tile rows of all the matrices --
+ * evenly between threads, so any count and thread count are supported.
+ */
+static void transpose_thrbatch(const void* restrict A, void* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t count, size_t stride, size_t num_thr,
+                               size_t blk, void *(*start_routine)(void *))
+{
+    const size_t units = TRANSPOSE_BATCH_PACKED(blk, A_rows, A_cols, stride) ?
+                         count : count * ((A_rows + blk - 1) / blk);
+    size_t thr_num;
+    struct tr_thread_arg *args =
+        thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
         tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
-                    0, A_rows, c_min, c_max, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, &transpose_thread_blocked_dbl,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
-        }
+                    units * thr_num / num_thr,
+                    units * (thr_num + 1) / num_thr, 0, A_cols, thr_num);
+        args[thr_num].stride = stride;
     }
 
-    // wait for the other threads
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+void transpose_flt_thrbatch_avx512_intr(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t count, size_t stride,
+                                        size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride, num_thr, 16,
+                       &transpose_thread_batch_flt);
+}
+
+void transpose_dbl_thrbatch_avx512_intr(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t count, size_t stride,
+                                        size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride, num_thr, 8,
+                       &transpose_thread_batch_dbl);
+}
+
+void transpose_dcmplx_thrbatch_avx512_intr(const double complex* restrict A,
+                                           double complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t count, size_t stride,
+                                           size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride, num_thr, 4,
+                       &transpose_thread_batch_dcmplx);
+}
+
+/*
+ * Transposes with a fused epilogue, dividing whole tile rows between threads.
+ */
+static void transpose_thrrow_epi(const void* restrict A, void* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb, size_t num_thr,
+                                 size_t blk, const transpose_epilogue *epi,
+                                 void *(*start_routine)(void *))
+{
+    size_t thr_num;
+    struct tr_thread_arg *args =
+        thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+
     for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    tile_split(A_rows, blk, num_thr, thr_num),
+                    tile_split(A_rows, blk, num_thr, thr_num + 1),
+                    0, A_cols, thr_num);
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
+        args[thr_num].epi = epi;
     }
 
-    free(args);
-    free(threads);
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+void transpose_fcmplx_thrrow_avx512_intr_epi(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t lda, size_t ldb,
+                                             size_t num_thr,
+                                             const transpose_epilogue *epi)
+{
+    transpose_thrrow_epi(A, B, A_rows, A_cols, lda, ldb, num_thr, 8, epi,
+                         &transpose_thread_epi_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_avx512_intr_epi(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t lda, size_t ldb,
+                                             size_t num_thr,
+                                             const transpose_epilogue *epi)
+{
+    transpose_thrrow_epi(A, B, A_rows, A_cols, lda, ldb, num_thr, 4, epi,
+                         &transpose_thread_epi_dcmplx);
 }
@@ -7,8 +7,21 @@
 #ifndef TRANSPOSE_THREADS_AVX_H
 #define TRANSPOSE_THREADS_AVX_H
 
+#include <complex.h>
 #include <stdlib.h>
 
+#include "transpose-epilogue.h"
+
+void transpose_flt_thrrow_avx512_intr(const float* restrict A,
+                                      float* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t num_thr);
+
+void transpose_flt_thrcol_avx512_intr(const float* restrict A,
+                                      float* restrict B,
+                                      size_t A_rows, size_t A_cols,
+                                      size_t num_thr);
+
 void transpose_dbl_thrrow_avx512_intr(const double* restrict A,
                                       double* restrict B,
                                       size_t A_rows, size_t A_cols,
@@ -19,4 +32,100 @@ void transpose_dbl_thrcol_avx512_intr(const double* restrict A,
                                       size_t A_rows, size_t A_cols,
                                       size_t num_thr);
 
+void transpose_dbl_thrrow_square_avx512_intr(double* A, size_t n,
+                                             size_t num_thr);
+
+void transpose_dcmplx_thrrow_avx512_intr(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t num_thr);
+
+void transpose_dcmplx_thrcol_avx512_intr(const double complex* restrict A,
+                                         double complex* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t num_thr);
+
+void transpose_dcmplx_thrrow_square_avx512_intr(double complex* A, size_t n,
+                                                size_t num_thr);
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.
+ */
+void transpose_flt_thrrow_avx512_intr_ld(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr);
+
+void transpose_dbl_thrrow_avx512_intr_ld(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr);
+
+void transpose_dcmplx_thrrow_avx512_intr_ld(const double complex* restrict A,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t lda, size_t ldb,
+                                            size_t num_thr);
+
+void transpose_flt_thrcol_avx512_intr_ld(const float* restrict A,
+                                         float* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr);
+
+void transpose_dbl_thrcol_avx512_intr_ld(const double* restrict A,
+                                         double* restrict B,
+                                         size_t A_rows, size_t A_cols,
+                                         size_t lda, size_t ldb,
+                                         size_t num_thr);
+
+void transpose_dcmplx_thrcol_avx512_intr_ld(const double complex* restrict A,
+                                            double complex* restrict B,
+                                            size_t A_rows, size_t A_cols,
+                                            size_t lda, size_t ldb,
+                                            size_t num_thr);
+
+/**
+ * Batched transposes, as in transpose.h, dividing the matrices (or their tile
+ * rows) between threads.
+ */
+void transpose_flt_thrbatch_avx512_intr(const float* restrict A,
+                                        float* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t count, size_t stride,
+                                        size_t num_thr);
+
+void transpose_dbl_thrbatch_avx512_intr(const double* restrict A,
+                                        double* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t count, size_t stride,
+                                        size_t num_thr);
+
+void transpose_dcmplx_thrbatch_avx512_intr(const double complex* restrict A,
+                                           double complex* restrict B,
+                                           size_t A_rows, size_t A_cols,
+                                           size_t count, size_t stride,
+                                           size_t num_thr);
+
+/**
+ * Transposes with a fused epilogue, as in transpose.h, dividing whole tile
+ * rows between threads.
+ */
+void transpose_fcmplx_thrrow_avx512_intr_epi(const float complex* restrict A,
+                                             float complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t lda, size_t ldb,
+                                             size_t num_thr,
+                                             const transpose_epilogue *epi);
+
+void transpose_dcmplx_thrrow_avx512_intr_epi(const double complex* restrict A,
+                                             double complex* restrict B,
+                                             size_t A_rows, size_t A_cols,
+                                             size_t lda, size_t ldb,
+                                             size_t num_thr,
+                                             const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_THREADS_AVX_H */
@@ -0,0 +1,299 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#undef NDEBUG
+#include <assert.h>
+#include <complex.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "transpose-avx2-kernels.h"
+#include "transpose-threads-avx2.h"
+#include "thread-pool.h"
+
+struct tr_thread_arg {
+    const void* restrict A;
+    void* restrict B;
+    size_t A_rows, A_cols, r_min, r_max, c_min, c_max, thr_num;
+    // leading dimensions (row strides) of A and B
+    size_t lda, ldb;
+};
+
+static void tt_arg_init(struct tr_thread_arg *tt_arg,
+                        const void* restrict A, void* restrict B,
+                        size_t A_rows, size_t A_cols,
+                        size_t r_min, size_t r_max, size_t c_min, size_t c_max,
+                        size_t thr_num)
+{
+    tt_arg->A = A;
+    tt_arg->B = B;
+    tt_arg->A_rows = A_rows;
+    tt_arg->A_cols = A_cols;
+    tt_arg->r_min = r_min;
+    tt_arg->r_max = r_max;
+    tt_arg->c_min = c_min;
+    tt_arg->c_max = c_max;
+    tt_arg->thr_num = thr_num;
+    tt_arg->lda = A_cols;
+    tt_arg->ldb = A_rows;
+}
+
+// each thread's partition must start on an n x n tile boundary
+#define TRANSP_THREAD_TILES(datatype, vtype, n, fn_load, fn_load_mask, \
+                            fn_transp, fn_store, fn_store_mask, arg) { \
+    assert((arg)->r_min % (n) == 0 || (arg)->r_min == (arg)->r_max); \
+    assert((arg)->c_min % (n) == 0 || (arg)->c_min == (arg)->c_max); \
+    TRANSPOSE_AVX2_TILES(vtype, n, fn_load, fn_load_mask, fn_transp, \
+                         fn_store, fn_store_mask, \
+                         (const datatype* restrict)(arg)->A, \
+                         (datatype* restrict)(arg)->B, \
+                         (arg)->A_rows, (arg)->A_cols, \
+                         (arg)->lda, (arg)->ldb, \
+                         (arg)->r_min, (arg)->r_max, \
+                         (arg)->c_min, (arg)->c_max); \
+}
+
+static void *transpose_thread_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_TILES(float, __m256, 8, load_8x8_ps, load_8x8_ps_mask,
+                        transpose_8x8_ps, store_8x8_ps, store_8x8_ps_mask,
+                        tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_TILES(double, __m256d, 4, load_4x4_pd, load_4x4_pd_mask,
+                        transpose_4x4_pd, store_4x4_pd, store_4x4_pd_mask,
+                        tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    TRANSP_THREAD_TILES(double complex, __m256d, 2, load_2x2_cpd,
+                        load_2x2_cpd_mask, transpose_2x2_cpd, store_2x2_cpd,
+                        store_2x2_cpd_mask, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Returns the start of thread thr_num's share of n rows (or columns), when
+ * whole blk-sized tiles are divided as evenly as possible among num_thr
+ * threads, so that each share starts on a tile boundary.  Neither n nor the
+ * tile count need be a multiple of the thread count.
+ */
+static size_t tile_split(size_t n, size_t blk, size_t num_thr, size_t thr_num)
+{
+    const size_t num_blks = (n + blk - 1) / blk;
+    const size_t r = num_blks * thr_num / num_thr * blk;
+    return r < n ? r : n;
+}
+
+static void transpose_thrrow(const void* restrict A, void* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr,
+                             size_t blk, void *(*start_routine)(void *))
+{
+    size_t r_min, r_max, thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        r_min = tile_split(A_rows, blk, num_thr, thr_num);
+        r_max = tile_split(A_rows, blk, num_thr, thr_num + 1);
+
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    r_min, r_max, 0, A_cols, thr_num);
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+static void transpose_thrcol(const void* restrict A, void* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr,
+                             size_t blk, void *(*start_routine)(void *))
+{
+    size_t c_min, c_max, thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        c_min = tile_split(A_cols, blk, num_thr, thr_num);
+        c_max = tile_split(A_cols, blk, num_thr, thr_num + 1);
+
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    0, A_rows, c_min, c_max, thr_num);
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+void transpose_flt_thrrow_avx2_intr(const float* restrict A,
+                                    float* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 8,
+                     &transpose_thread_flt);
+}
+
+void transpose_dbl_thrrow_avx2_intr(const double* restrict A,
+                                    double* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrrow_avx2_intr(const float complex* restrict A,
+                                       float complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr)
+{
+    // a float complex value is 64 bits, so it can be moved as a double
+    transpose_thrrow((const double* restrict)A, (double* restrict)B,
+                     A_rows, A_cols, A_cols, A_rows, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_dcmplx_thrrow_avx2_intr(const double complex* restrict A,
+                                       double complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 2,
+                     &transpose_thread_dcmplx);
+}
+
+void transpose_flt_thrcol_avx2_intr(const float* restrict A,
+                                    float* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 8,
+                     &transpose_thread_flt);
+}
+
+void transpose_dbl_thrcol_avx2_intr(const double* restrict A,
+                                    double* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrcol_avx2_intr(const float complex* restrict A,
+                                       float complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr)
+{
+    // a float complex value is 64 bits, so it can be moved as a double
+    transpose_thrcol((const double* restrict)A, (double* restrict)B,
+                     A_rows, A_cols, A_cols, A_rows, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_dcmplx_thrcol_avx2_intr(const double complex* restrict A,
+                                       double complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, A_cols, A_rows, num_thr, 2,
+                     &transpose_thread_dcmplx);
+}
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.
+ */
+void transpose_flt_thrrow_avx2_intr_ld(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, lda, ldb, num_thr, 8,
+                     &transpose_thread_flt);
+}
+
+void transpose_dbl_thrrow_avx2_intr_ld(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, lda, ldb, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrrow_avx2_intr_ld(const float complex* restrict A,
+                                          float complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr)
+{
+    // a float complex value is 64 bits, so it can be moved as a double
+    transpose_thrrow((const double* restrict)A, (double* restrict)B,
+                     A_rows, A_cols, lda, ldb, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_dcmplx_thrrow_avx2_intr_ld(const double complex* restrict A,
+                                          double complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr)
+{
+    transpose_thrrow(A, B, A_rows, A_cols, lda, ldb, num_thr, 2,
+                     &transpose_thread_dcmplx);
+}
+
+void transpose_flt_thrcol_avx2_intr_ld(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, lda, ldb, num_thr, 8,
+                     &transpose_thread_flt);
+}
+
+void transpose_dbl_thrcol_avx2_intr_ld(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, lda, ldb, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrcol_avx2_intr_ld(const float complex* restrict A,
+                                          float complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr)
+{
+    // a float complex value is 64 bits, so it can be moved as a double
+    transpose_thrcol((const double* restrict)A, (double* restrict)B,
+                     A_rows, A_cols, lda, ldb, num_thr, 4,
+                     &transpose_thread_dbl);
+}
+
+void transpose_dcmplx_thrcol_avx2_intr_ld(const double complex* restrict A,
+                                          double complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr)
+{
+    transpose_thrcol(A, B, A_rows, A_cols, lda, ldb, num_thr, 2,
+                     &transpose_thread_dcmplx);
+}
@@ -0,0 +1,101 @@
+/**
+ * Transpose functions.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_THREADS_AVX2_H
+#define TRANSPOSE_THREADS_AVX2_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+void transpose_flt_thrrow_avx2_intr(const float* restrict A,
+                                    float* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+
+void transpose_dbl_thrrow_avx2_intr(const double* restrict A,
+                                    double* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+
+void transpose_fcmplx_thrrow_avx2_intr(const float complex* restrict A,
+                                       float complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr);
+
+void transpose_dcmplx_thrrow_avx2_intr(const double complex* restrict A,
+                                       double complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr);
+
+void transpose_flt_thrcol_avx2_intr(const float* restrict A,
+                                    float* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+
+void transpose_dbl_thrcol_avx2_intr(const double* restrict A,
+                                    double* restrict B,
+                                    size_t A_rows, size_t A_cols,
+                                    size_t num_thr);
+
+void transpose_fcmplx_thrcol_avx2_intr(const float complex* restrict A,
+                                       float complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr);
+
+void transpose_dcmplx_thrcol_avx2_intr(const double complex* restrict A,
+                                       double complex* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t num_thr);
+
+/*
+ * As above, for matrices with padded rows: lda and ldb are the row strides of
+ * A and B, in elements.
+ */
+void transpose_flt_thrrow_avx2_intr_ld(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_dbl_thrrow_avx2_intr_ld(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fcmplx_thrrow_avx2_intr_ld(const float complex* restrict A,
+                                          float complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr);
+
+void transpose_dcmplx_thrrow_avx2_intr_ld(const double complex* restrict A,
+                                          double complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr);
+
+void transpose_flt_thrcol_avx2_intr_ld(const float* restrict A,
+                                       float* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_dbl_thrcol_avx2_intr_ld(const double* restrict A,
+                                       double* restrict B,
+                                       size_t A_rows, size_t A_cols,
+                                       size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_fcmplx_thrcol_avx2_intr_ld(const float complex* restrict A,
+                                          float complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr);
+
+void transpose_dcmplx_thrcol_avx2_intr_ld(const double complex* restrict A,
+                                          double complex* restrict B,
+                                          size_t A_rows, size_t A_cols,
+                                          size_t lda, size_t ldb,
+                                          size_t num_thr);
+
+#endif /* TRANSPOSE_THREADS_AVX2_H */
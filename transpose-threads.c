@@ -6,21 +6,48 @@
  * @date 2019-08-06
  */
 #include <complex.h>
-#include <errno.h>
+#include <math.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <pthread.h>
+#include <string.h>
 
+#include "numa-util.h"
+#include "tile-buffer.h"
+#include "tile-order.h"
+#include "tile-sched.h"
+#include "transpose-epilogue.h"
+#include "transpose-inplace.h"
+#include "transpose-square.h"
 #include "transpose-threads.h"
+#include "thread-pool.h"
 #include "util.h"
 
+// recursion stops at regions no larger than this in either dimension
+#define TRANSPOSE_REC_BASE 16
+// tile size for space-filling curve traversals
+#define TRANSPOSE_CURVE_BLK 16
+/*
+ * tile size for work-stealing transposes: 32 elements of any type is a whole
+ * number of cache lines, so every tile starts each of its rows in B on a line
+ */
+#define TRANSPOSE_TILE_BLK 32
+// block size for the first phase of NUMA-hierarchical transposes
+#define TRANSPOSE_NUMA_BLK 32
+// indices a thread claims at a time when looking for in-place cycle leaders
+#define TRANSPOSE_CYCLE_CHUNK 1024
+
 struct tr_thread_arg {
     const void* restrict A;
     void* restrict B;
     size_t A_rows, A_cols;
+    // leading dimensions (row strides) of A and B
+    size_t lda, ldb;
     size_t r_min, r_max, c_min, c_max;
     size_t blk_rows, blk_cols;
     size_t thr_num;
+    struct tile_sched *sched;
+    const transpose_epilogue *epi;
 };
 
 static void tt_arg_init(struct tr_thread_arg *tt_arg,
@@ -34,6 +61,8 @@ static void tt_arg_init(struct tr_thread_arg *tt_arg,
     tt_arg->B = B;
     tt_arg->A_rows = A_rows;
     tt_arg->A_cols = A_cols;
+    tt_arg->lda = A_cols;
+    tt_arg->ldb = A_rows;
     tt_arg->r_min = r_min;
     tt_arg->r_max = r_max;
     tt_arg->c_min = c_min;
@@ -41,13 +70,15 @@ static void tt_arg_init(struct tr_thread_arg *tt_arg,
     tt_arg->blk_rows = blk_rows;
     tt_arg->blk_cols = blk_cols;
     tt_arg->thr_num = thr_num;
+    tt_arg->sched = NULL;
+    tt_arg->epi = NULL;
 }
 
-#define TRANSPOSE_BLK(A, B, A_rows, A_cols, r_min, c_min, r_max, c_max) { \
+#define TRANSPOSE_BLK(A, B, lda, ldb, r_min, c_min, r_max, c_max) { \
     size_t r, c; \
     for (r = (r_min); r < (r_max); r++) { \
         for (c = (c_min); c < (c_max); c++) { \
-            (B)[(c) * (A_rows) + (r)] = (A)[(r) * (A_cols) + (c)]; \
+            (B)[(c) * (ldb) + (r)] = (A)[(r) * (lda) + (c)]; \
         } \
     } \
 }
@@ -64,20 +95,69 @@ static void tt_arg_init(struct tr_thread_arg *tt_arg,
         for (cblk_num = start_cblk_num; cblk_num < end_cblk_num; cblk_num++) { \
             cblk_min = cblk_num * arg->blk_cols; \
             cblk_max = cblk_min + arg->blk_cols; \
-            TRANSPOSE_BLK(A, B, arg->A_rows, arg->A_cols, \
+            TRANSPOSE_BLK(A, B, arg->lda, arg->ldb, \
                           rblk_min, cblk_min, rblk_max, cblk_max); \
         } \
     } \
 }
 
+#define TRANSP_THREAD_SQ_BLK(datatype, arg, A) { \
+    size_t r_min, c_min, r_max, c_max; \
+    for (r_min = arg->r_min; r_min < arg->r_max; r_min += arg->blk_rows) { \
+        r_max = r_min + arg->blk_rows < arg->r_max ? \
+                r_min + arg->blk_rows : arg->r_max; \
+        for (c_min = r_min; c_min < arg->A_cols; c_min += arg->blk_rows) { \
+            c_max = c_min + arg->blk_rows < arg->A_cols ? \
+                    c_min + arg->blk_rows : arg->A_cols; \
+            TRANSPOSE_SQ_BLK(datatype, A, arg->A_cols, \
+                             r_min, c_min, r_max, c_max); \
+        } \
+    } \
+}
+
+/*
+ * Follow the cycles whose leaders are in chunks of indices claimed from the
+ * shared counter next.  An index leads its cycle if no index on the cycle is
+ * smaller, which is tested by walking the cycle (without moving data) until it
+ * returns to p or drops below it.  Cycles are disjoint, so each is moved by
+ * the one thread that holds its leader, concurrently with the others.
+ * Moved elements are marked in the shared bitmap moved, so most indices whose
+ * cycle's leader was claimed earlier are skipped without walking their cycle.
+ */
+#define TRANSPOSE_CYCLES(datatype, A, moved, A_rows, A_cols, next) { \
+    const size_t n = (A_rows) * (A_cols); \
+    size_t p, p_max, cur, src; \
+    datatype tmp; \
+    while ((p = atomic_fetch_add(next, TRANSPOSE_CYCLE_CHUNK)) < n) { \
+        p_max = n - p < TRANSPOSE_CYCLE_CHUNK ? n : p + TRANSPOSE_CYCLE_CHUNK; \
+        for (; p < p_max; p++) { \
+            if (BITMAP_GET_ATOMIC(moved, p)) { \
+                continue; \
+            } \
+            for (cur = INPLACE_SRC(p, A_rows, A_cols); cur > p; \
+                 cur = INPLACE_SRC(cur, A_rows, A_cols)); \
+            if (cur < p) { \
+                continue; \
+            } \
+            tmp = (A)[p]; \
+            while ((src = INPLACE_SRC(cur, A_rows, A_cols)) != p) { \
+                (A)[cur] = (A)[src]; \
+                BITMAP_SET_ATOMIC(moved, src); \
+                cur = src; \
+            } \
+            (A)[cur] = tmp; \
+        } \
+    } \
+}
+
 static void *transpose_thread_flt(void *args)
 {
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSPOSE_BLK((const float* restrict)tt_arg->A,
                   (float* restrict)tt_arg->B,
-                  tt_arg->A_rows, tt_arg->A_cols,
+                  tt_arg->lda, tt_arg->ldb,
                   tt_arg->r_min, tt_arg->c_min, tt_arg->r_max, tt_arg->c_max);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_dbl(void *args)
@@ -85,9 +165,9 @@ static void *transpose_thread_dbl(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSPOSE_BLK((const double* restrict)tt_arg->A,
                   (double* restrict)tt_arg->B,
-                  tt_arg->A_rows, tt_arg->A_cols,
+                  tt_arg->lda, tt_arg->ldb,
                   tt_arg->r_min, tt_arg->c_min, tt_arg->r_max, tt_arg->c_max);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_fcmplx(void *args)
@@ -95,9 +175,9 @@ static void *transpose_thread_fcmplx(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSPOSE_BLK((const float complex* restrict)tt_arg->A,
                   (float complex* restrict)tt_arg->B,
-                  tt_arg->A_rows, tt_arg->A_cols,
+                  tt_arg->lda, tt_arg->ldb,
                   tt_arg->r_min, tt_arg->c_min, tt_arg->r_max, tt_arg->c_max);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_dcmplx(void *args)
@@ -105,9 +185,9 @@ static void *transpose_thread_dcmplx(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSPOSE_BLK((const double complex* restrict)tt_arg->A,
                   (double complex* restrict)tt_arg->B,
-                  tt_arg->A_rows, tt_arg->A_cols,
+                  tt_arg->lda, tt_arg->ldb,
                   tt_arg->r_min, tt_arg->c_min, tt_arg->r_max, tt_arg->c_max);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_blocked_flt(void *args)
@@ -115,7 +195,7 @@ static void *transpose_thread_blocked_flt(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSP_THREAD_BLK(tt_arg, (const float* restrict)tt_arg->A,
                       (float* restrict)tt_arg->B);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_blocked_dbl(void *args)
@@ -123,7 +203,7 @@ static void *transpose_thread_blocked_dbl(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSP_THREAD_BLK(tt_arg, (const double* restrict)tt_arg->A,
                       (double* restrict)tt_arg->B);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_blocked_fcmplx(void *args)
@@ -131,7 +211,7 @@ static void *transpose_thread_blocked_fcmplx(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSP_THREAD_BLK(tt_arg, (const float complex* restrict)tt_arg->A,
                       (float complex* restrict)tt_arg->B);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void *transpose_thread_blocked_dcmplx(void *args)
@@ -139,18 +219,17 @@ static void *transpose_thread_blocked_dcmplx(void *args)
     const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
     TRANSP_THREAD_BLK(tt_arg, (const double complex* restrict)tt_arg->A,
                       (double complex* restrict)tt_arg->B);
-    pthread_exit((void *)tt_arg->thr_num);
+    return (void *)tt_arg->thr_num;
 }
 
 static void transpose_thrrow_blocked(const void* restrict A, void* restrict B,
                                      size_t A_rows, size_t A_cols,
-                                     size_t num_thr,
+                                     size_t lda, size_t ldb, size_t num_thr,
                                      size_t blk_rows, size_t blk_cols,
                                      void *(*start_routine)(void *))
 {
     size_t r_min, r_max, thr_num;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
     // divide the rows as evenly as possible among the threads
     const size_t num_thr_with_max_rows = A_rows % num_thr;
     const size_t min_rows_per_thread = A_rows / num_thr;
@@ -167,36 +246,21 @@ static void transpose_thrrow_blocked(const void* restrict A, void* restrict B,
         }
         tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
                     r_min, r_max, 0, A_cols, blk_rows, blk_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, start_routine,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
-        }
-    }
-
-    // wait for the other threads
-    for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
-        }
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
     }
 
-    free(args);
-    free(threads);
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
 }
 
 static void transpose_thrcol_blocked(const void* restrict A, void* restrict B,
                                      size_t A_rows, size_t A_cols,
-                                     size_t num_thr,
+                                     size_t lda, size_t ldb, size_t num_thr,
                                      size_t blk_rows, size_t blk_cols,
                                      void *(*start_routine)(void *))
 {
     size_t c_min, c_max, thr_num;
-    pthread_t *threads = assert_malloc(num_thr * sizeof(pthread_t));
-    struct tr_thread_arg *args = assert_malloc(num_thr * sizeof(struct tr_thread_arg));
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
     // divide the columns as evenly as possible among the threads
     const size_t num_thr_with_max_cols = A_cols % num_thr;
     const size_t min_cols_per_thread = A_cols / num_thr;
@@ -213,172 +277,1626 @@ static void transpose_thrcol_blocked(const void* restrict A, void* restrict B,
         }
         tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
                     0, A_rows, c_min, c_max, blk_rows, blk_cols, thr_num);
-        errno = pthread_create(&threads[thr_num], NULL, start_routine,
-                               &args[thr_num]);
-        if (errno) {
-            perror("pthread_create");
-            exit(errno);
-        }
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+static void *transpose_thread_epi_fcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_BLK_EPI(float complex, conjf,
+                      (const float complex* restrict)tt_arg->A,
+                      (float complex* restrict)tt_arg->B,
+                      tt_arg->A_rows, tt_arg->A_cols, tt_arg->lda, tt_arg->ldb,
+                      tt_arg->r_min, tt_arg->c_min, tt_arg->r_max,
+                      tt_arg->c_max, tt_arg->epi);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_epi_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_BLK_EPI(double complex, conj,
+                      (const double complex* restrict)tt_arg->A,
+                      (double complex* restrict)tt_arg->B,
+                      tt_arg->A_rows, tt_arg->A_cols, tt_arg->lda, tt_arg->ldb,
+                      tt_arg->r_min, tt_arg->c_min, tt_arg->r_max,
+                      tt_arg->c_max, tt_arg->epi);
+    return (void *)tt_arg->thr_num;
+}
+
+// divide the rows between threads, which apply the epilogue as they transpose
+static void transpose_thrrow_epi(const void* restrict A, void* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb, size_t num_thr,
+                                 const transpose_epilogue *epi,
+                                 void *(*start_routine)(void *))
+{
+    size_t thr_num;
+    struct tr_thread_arg *args =
+        thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    A_rows * thr_num / num_thr,
+                    A_rows * (thr_num + 1) / num_thr, 0, A_cols,
+                    0, 0, thr_num);
+        args[thr_num].lda = lda;
+        args[thr_num].ldb = ldb;
+        args[thr_num].epi = epi;
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+// transpose each region visited by a tile traversal, with tr_thread_arg context
+static void transpose_region_flt(void *ctx, size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)ctx;
+    TRANSPOSE_BLK((const float* restrict)tt_arg->A,
+                  (float* restrict)tt_arg->B,
+                  tt_arg->lda, tt_arg->ldb, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_region_dbl(void *ctx, size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)ctx;
+    TRANSPOSE_BLK((const double* restrict)tt_arg->A,
+                  (double* restrict)tt_arg->B,
+                  tt_arg->lda, tt_arg->ldb, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_region_fcmplx(void *ctx, size_t r_min, size_t r_max,
+                                    size_t c_min, size_t c_max)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)ctx;
+    TRANSPOSE_BLK((const float complex* restrict)tt_arg->A,
+                  (float complex* restrict)tt_arg->B,
+                  tt_arg->lda, tt_arg->ldb, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_region_dcmplx(void *ctx, size_t r_min, size_t r_max,
+                                    size_t c_min, size_t c_max)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)ctx;
+    TRANSPOSE_BLK((const double complex* restrict)tt_arg->A,
+                  (double complex* restrict)tt_arg->B,
+                  tt_arg->lda, tt_arg->ldb, r_min, c_min, r_max, c_max);
+}
+
+static void *transpose_thread_recursive_flt(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_recursive(tt_arg->r_min, tt_arg->r_max,
+                         tt_arg->c_min, tt_arg->c_max, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_flt, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_recursive_dbl(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_recursive(tt_arg->r_min, tt_arg->r_max,
+                         tt_arg->c_min, tt_arg->c_max, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_dbl, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_recursive_fcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_recursive(tt_arg->r_min, tt_arg->r_max,
+                         tt_arg->c_min, tt_arg->c_max, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_fcmplx, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_recursive_dcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_recursive(tt_arg->r_min, tt_arg->r_max,
+                         tt_arg->c_min, tt_arg->c_max, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_dcmplx, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+// curve traversals visit the tiles of size blk_rows in positions [r_min, r_max)
+static void *transpose_thread_morton_flt(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_morton(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                      tt_arg->r_min, tt_arg->r_max,
+                      &transpose_region_flt, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_morton_dbl(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_morton(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                      tt_arg->r_min, tt_arg->r_max,
+                      &transpose_region_dbl, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_morton_fcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_morton(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                      tt_arg->r_min, tt_arg->r_max,
+                      &transpose_region_fcmplx, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_morton_dcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_morton(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                      tt_arg->r_min, tt_arg->r_max,
+                      &transpose_region_dcmplx, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_hilbert_flt(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_hilbert(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                       tt_arg->r_min, tt_arg->r_max,
+                       &transpose_region_flt, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_hilbert_dbl(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_hilbert(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                       tt_arg->r_min, tt_arg->r_max,
+                       &transpose_region_dbl, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_hilbert_fcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_hilbert(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                       tt_arg->r_min, tt_arg->r_max,
+                       &transpose_region_fcmplx, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_hilbert_dcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    tile_order_hilbert(tt_arg->A_rows, tt_arg->A_cols, tt_arg->blk_rows,
+                       tt_arg->r_min, tt_arg->r_max,
+                       &transpose_region_dcmplx, tt_arg);
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Tiles are numbered down the columns of the tile grid, so consecutive tiles
+ * write consecutive rows of B.
+ */
+static void transpose_thread_tiles(struct tr_thread_arg *tt_arg,
+                                   tile_region_fn fn)
+{
+    const size_t n_rblks = (tt_arg->A_rows + tt_arg->blk_rows - 1) /
+                           tt_arg->blk_rows;
+    size_t tile, r_min, r_max, c_min, c_max;
+    while (tile_sched_next(tt_arg->sched, tt_arg->thr_num, &tile)) {
+        r_min = (tile % n_rblks) * tt_arg->blk_rows;
+        r_max = r_min + tt_arg->blk_rows < tt_arg->A_rows ?
+                r_min + tt_arg->blk_rows : tt_arg->A_rows;
+        c_min = (tile / n_rblks) * tt_arg->blk_cols;
+        c_max = c_min + tt_arg->blk_cols < tt_arg->A_cols ?
+                c_min + tt_arg->blk_cols : tt_arg->A_cols;
+        fn(tt_arg, r_min, r_max, c_min, c_max);
+    }
+}
+
+static void *transpose_thread_tile_flt(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_tiles(tt_arg, &transpose_region_flt);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_tile_dbl(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_tiles(tt_arg, &transpose_region_dbl);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_tile_fcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_tiles(tt_arg, &transpose_region_fcmplx);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_tile_dcmplx(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_tiles(tt_arg, &transpose_region_dcmplx);
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Divide the tiles of a space-filling curve traversal into contiguous segments,
+ * so that each thread's tiles are also close together.
+ */
+static void transpose_thrcurve(const void* restrict A, void* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t num_thr, size_t blk,
+                               void *(*start_routine)(void *))
+{
+    size_t thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+    const size_t n_tiles = tile_order_count(A_rows, A_cols, blk);
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    thr_num * n_tiles / num_thr,
+                    (thr_num + 1) * n_tiles / num_thr,
+                    0, A_cols, blk, blk, thr_num);
     }
 
-    // wait for the other threads
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+/*
+ * Each thread starts with a contiguous run of tiles and steals from the others
+ * when it runs out, so uneven progress (e.g., from other load on a CPU, or
+ * tiles that miss in the TLB) doesn't leave threads idle.
+ */
+static void transpose_thrtile(const void* restrict A, void* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr, size_t blk,
+                              void *(*start_routine)(void *))
+{
+    size_t thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+    struct tile_sched *sched =
+        tile_sched_create(tile_order_count(A_rows, A_cols, blk), num_thr);
+
     for (thr_num = 0; thr_num < num_thr; thr_num++) {
-        errno = pthread_join(threads[thr_num], NULL);
-        if (errno) {
-            perror("pthread_join");
-            exit(errno);
+        tt_arg_init(&args[thr_num], A, B, A_rows, A_cols,
+                    0, A_rows, 0, A_cols, blk, blk, thr_num);
+        args[thr_num].sched = sched;
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+
+    tile_sched_destroy(sched);
+}
+
+/* Transpose rows [r_min, r_max) and columns [c_min, c_max) in blocks */
+static void transpose_thread_blocks(struct tr_thread_arg *tt_arg,
+                                    tile_region_fn fn)
+{
+    size_t r_min, r_max, c_min, c_max;
+    for (r_min = tt_arg->r_min; r_min < tt_arg->r_max;
+         r_min += tt_arg->blk_rows) {
+        r_max = r_min + tt_arg->blk_rows < tt_arg->r_max ?
+                r_min + tt_arg->blk_rows : tt_arg->r_max;
+        for (c_min = tt_arg->c_min; c_min < tt_arg->c_max;
+             c_min += tt_arg->blk_cols) {
+            c_max = c_min + tt_arg->blk_cols < tt_arg->c_max ?
+                    c_min + tt_arg->blk_cols : tt_arg->c_max;
+            fn(tt_arg, r_min, r_max, c_min, c_max);
         }
     }
+}
 
-    free(args);
-    free(threads);
+static void *transpose_thread_blocks_flt(void *args)
+{
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_blocks(tt_arg, &transpose_region_flt);
+    return (void *)tt_arg->thr_num;
 }
 
-void transpose_flt_thrrow(const float* restrict A, float* restrict B,
-                          size_t A_rows, size_t A_cols,
-                          size_t num_thr)
+static void *transpose_thread_blocks_dbl(void *args)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_flt);
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_blocks(tt_arg, &transpose_region_dbl);
+    return (void *)tt_arg->thr_num;
 }
 
-void transpose_dbl_thrrow(const double* restrict A, double* restrict B,
-                          size_t A_rows, size_t A_cols,
-                          size_t num_thr)
+static void *transpose_thread_blocks_fcmplx(void *args)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_dbl);
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_blocks(tt_arg, &transpose_region_fcmplx);
+    return (void *)tt_arg->thr_num;
 }
 
-void transpose_fcmplx_thrrow(const float complex* restrict A,
-                             float complex* restrict B,
-                             size_t A_rows, size_t A_cols,
-                             size_t num_thr)
+static void *transpose_thread_blocks_dcmplx(void *args)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_fcmplx);
+    struct tr_thread_arg *tt_arg = (struct tr_thread_arg *)args;
+    transpose_thread_blocks(tt_arg, &transpose_region_dcmplx);
+    return (void *)tt_arg->thr_num;
 }
 
-void transpose_dcmplx_thrrow(const double complex* restrict A,
-                             double complex* restrict B,
-                             size_t A_rows, size_t A_cols,
-                             size_t num_thr)
+/*
+ * NUMA-hierarchical transposes group threads into domains by the NUMA node
+ * they're pinned to.  Thread i owns the i-th contiguous partition of the rows
+ * of A and of B (as placed by first touch), so each domain owns a row panel of
+ * each matrix.
+ */
+struct tr_numa {
+    const char* restrict T;
+    char* restrict B;
+    size_t A_rows, A_cols;
+    size_t elsize;
+    size_t num_thr;
+    size_t num_dom;
+    // the first thread of each domain, then num_thr
+    size_t *dom_thr;
+};
+
+struct tr_numa_arg {
+    const struct tr_numa *tn;
+    size_t thr_num;
+};
+
+static size_t numa_domains(size_t num_thr, size_t *dom_thr)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_dcmplx);
+    size_t thr_num;
+    size_t num_dom = 0;
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        if (!thr_num ||
+            thread_pool_node(thr_num) != thread_pool_node(thr_num - 1)) {
+            dom_thr[num_dom++] = thr_num;
+        }
+    }
+    dom_thr[num_dom] = num_thr;
+    return num_dom;
 }
 
+// the scratch matrix, kept between calls (see transpose_thrnuma_reserve())
+static struct {
+    void *T;
+    size_t size;
+    size_t num_thr;
+} numa_scratch;
 
-void transpose_flt_thrcol(const float* restrict A, float* restrict B,
-                          size_t A_rows, size_t A_cols,
-                          size_t num_thr)
+/*
+ * Returns the scratch matrix for size bytes and num_thr threads, (re)allocating
+ * it if needed.  Thread i transposes rows of A into the i-th partition of the
+ * rows of T, within its domain's panel, so it first touches that partition.
+ */
+static void *numa_scratch_get(size_t size, size_t num_thr)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_flt);
+    if (numa_scratch.T && numa_scratch.size == size &&
+        numa_scratch.num_thr == num_thr) {
+        return numa_scratch.T;
+    }
+    transpose_thrnuma_release();
+    // aligned allocations must be whole cache lines
+    numa_scratch.T = assert_malloc_al((size + 63) & ~(size_t) 63);
+    numa_first_touch(numa_scratch.T, size, num_thr);
+    numa_scratch.size = size;
+    numa_scratch.num_thr = num_thr;
+    return numa_scratch.T;
 }
 
-void transpose_dbl_thrcol(const double* restrict A, double* restrict B,
-                          size_t A_rows, size_t A_cols,
-                          size_t num_thr)
+void transpose_thrnuma_reserve(size_t A_rows, size_t A_cols, size_t elsize,
+                               size_t num_thr)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_dbl);
+    size_t *dom_thr = assert_malloc((num_thr + 1) * sizeof(size_t));
+    if (numa_domains(num_thr, dom_thr) > 1) {
+        numa_scratch_get(A_rows * A_cols * elsize, num_thr);
+    }
+    free(dom_thr);
 }
 
-void transpose_fcmplx_thrcol(const float complex* restrict A,
-                             float complex* restrict B,
-                             size_t A_rows, size_t A_cols,
-                             size_t num_thr)
+void transpose_thrnuma_release(void)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_fcmplx);
+    if (numa_scratch.T) {
+        free_al(numa_scratch.T);
+    }
+    numa_scratch.T = NULL;
+    numa_scratch.size = 0;
+    numa_scratch.num_thr = 0;
 }
 
-void transpose_dcmplx_thrcol(const double complex* restrict A,
-                             double complex* restrict B,
-                             size_t A_rows, size_t A_cols,
-                             size_t num_thr)
+/*
+ * Phase 2: copy this thread's rows of B from the transposed panel of every
+ * domain, one domain at a time.  In a transposed panel, the run for each row
+ * of B is contiguous, as are the runs for consecutive rows, so reads from
+ * other nodes are sequential, and all writes are local.
+ */
+static void *transpose_thread_numa_exchange(void *args)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, 0, 0,
-                             &transpose_thread_dcmplx);
+    const struct tr_numa_arg *arg = (const struct tr_numa_arg *)args;
+    const struct tr_numa *tn = arg->tn;
+    const size_t c_min = arg->thr_num * tn->A_cols / tn->num_thr;
+    const size_t c_max = (arg->thr_num + 1) * tn->A_cols / tn->num_thr;
+    size_t dom, c, p_min, p_max;
+    for (dom = 0; dom < tn->num_dom; dom++) {
+        p_min = tn->dom_thr[dom] * tn->A_rows / tn->num_thr;
+        p_max = tn->dom_thr[dom + 1] * tn->A_rows / tn->num_thr;
+        for (c = c_min; c < c_max; c++) {
+            memcpy(tn->B + (c * tn->A_rows + p_min) * tn->elsize,
+                   tn->T + (p_min * tn->A_cols + c * (p_max - p_min)) *
+                           tn->elsize,
+                   (p_max - p_min) * tn->elsize);
+        }
+    }
+    return (void *)arg->thr_num;
 }
 
-void transpose_flt_thrrow_blocked(const float* restrict A,
-                                  float* restrict B,
-                                  size_t A_rows, size_t A_cols,
-                                  size_t num_thr,
-                                  size_t blk_rows, size_t blk_cols)
+/*
+ * Phase 1: each domain transposes its panel of A, in blocks, into a scratch
+ * panel on its own node (first touched by its threads when the scratch matrix
+ * was allocated).
+ * With only one domain, phase 1 transposes straight into B.
+ */
+static void transpose_thrnuma(const void* restrict A, void* restrict B,
+                              size_t A_rows, size_t A_cols, size_t elsize,
+                              size_t num_thr, void *(*start_routine)(void *))
+{
+    struct tr_numa tn;
+    struct tr_numa_arg *xargs;
+    struct tr_thread_arg *args;
+    char *T;
+    size_t thr_num, dom, p_min, p_max;
+
+    tn.dom_thr = assert_malloc((num_thr + 1) * sizeof(size_t));
+    tn.num_dom = numa_domains(num_thr, tn.dom_thr);
+    // get the scratch matrix first: first-touching it reuses the args storage
+    T = tn.num_dom > 1 ? numa_scratch_get(A_rows * A_cols * elsize, num_thr)
+                       : B;
+    args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+    for (dom = 0; dom < tn.num_dom; dom++) {
+        p_min = tn.dom_thr[dom] * A_rows / num_thr;
+        p_max = tn.dom_thr[dom + 1] * A_rows / num_thr;
+        for (thr_num = tn.dom_thr[dom]; thr_num < tn.dom_thr[dom + 1];
+             thr_num++) {
+            tt_arg_init(&args[thr_num],
+                        (const char *)A + p_min * A_cols * elsize,
+                        T + p_min * A_cols * elsize,
+                        p_max - p_min, A_cols,
+                        thr_num * A_rows / num_thr - p_min,
+                        (thr_num + 1) * A_rows / num_thr - p_min,
+                        0, A_cols, TRANSPOSE_NUMA_BLK, TRANSPOSE_NUMA_BLK,
+                        thr_num);
+        }
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+
+    if (tn.num_dom > 1) {
+        tn.T = T;
+        tn.B = B;
+        tn.A_rows = A_rows;
+        tn.A_cols = A_cols;
+        tn.elsize = elsize;
+        tn.num_thr = num_thr;
+        xargs = thread_pool_args(sizeof(struct tr_numa_arg), num_thr);
+        for (thr_num = 0; thr_num < num_thr; thr_num++) {
+            xargs[thr_num].tn = &tn;
+            xargs[thr_num].thr_num = thr_num;
+        }
+        thread_pool_run(transpose_thread_numa_exchange, xargs, sizeof(*xargs),
+                        num_thr);
+    }
+
+    free(tn.dom_thr);
+}
+
+/*
+ * TLB-aware multi-pass transposes go through a tile-contiguous buffer (see
+ * tile-buffer.h).  Threads gather contiguous runs of tile rows of A, then
+ * transpose and scatter contiguous runs of tile columns, i.e., row panels of B.
+ */
+struct tr_tlb {
+    const void* restrict A;
+    void* restrict T;
+    void* restrict B;
+    size_t A_rows, A_cols;
+    size_t elsize;
+    size_t num_thr;
+    tile_transpose_fn fn;
+};
+
+struct tr_tlb_arg {
+    const struct tr_tlb *tl;
+    size_t thr_num;
+};
+
+/* First touch the pages of T that this thread gathers to */
+static void *transpose_thread_tlb_touch(void *args)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_flt);
+    const struct tr_tlb_arg *arg = (const struct tr_tlb_arg *)args;
+    const struct tr_tlb *tl = arg->tl;
+    const size_t blk_rows = tile_buffer_blk_rows(tl->elsize);
+    const size_t n_rblks = (tl->A_rows + blk_rows - 1) / blk_rows;
+    tile_buffer_touch(tl->T, tl->A_rows, tl->A_cols, tl->elsize,
+                      arg->thr_num * n_rblks / tl->num_thr,
+                      (arg->thr_num + 1) * n_rblks / tl->num_thr);
+    return (void *)arg->thr_num;
 }
 
-void transpose_dbl_thrrow_blocked(const double* restrict A,
-                                  double* restrict B,
-                                  size_t A_rows, size_t A_cols,
-                                  size_t num_thr,
-                                  size_t blk_rows, size_t blk_cols)
+static void *transpose_thread_tlb_gather(void *args)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_dbl);
+    const struct tr_tlb_arg *arg = (const struct tr_tlb_arg *)args;
+    const struct tr_tlb *tl = arg->tl;
+    const size_t blk_rows = tile_buffer_blk_rows(tl->elsize);
+    const size_t n_rblks = (tl->A_rows + blk_rows - 1) / blk_rows;
+    tile_buffer_gather(tl->A, tl->T, tl->A_rows, tl->A_cols, tl->elsize,
+                       arg->thr_num * n_rblks / tl->num_thr,
+                       (arg->thr_num + 1) * n_rblks / tl->num_thr);
+    return (void *)arg->thr_num;
 }
 
-void transpose_fcmplx_thrrow_blocked(const float complex* restrict A,
-                                     float complex* restrict B,
-                                     size_t A_rows, size_t A_cols,
-                                     size_t num_thr,
-                                     size_t blk_rows, size_t blk_cols)
+static void *transpose_thread_tlb_scatter(void *args)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_fcmplx);
+    const struct tr_tlb_arg *arg = (const struct tr_tlb_arg *)args;
+    const struct tr_tlb *tl = arg->tl;
+    const size_t n_cblks = (tl->A_cols + TILE_BUFFER_BLK_COLS - 1) /
+                           TILE_BUFFER_BLK_COLS;
+    tile_buffer_scatter(tl->T, tl->B, tl->A_rows, tl->A_cols, tl->elsize,
+                        arg->thr_num * n_cblks / tl->num_thr,
+                        (arg->thr_num + 1) * n_cblks / tl->num_thr, tl->fn);
+    return (void *)arg->thr_num;
 }
 
-void transpose_dcmplx_thrrow_blocked(const double complex* restrict A,
-                                     double complex* restrict B,
-                                     size_t A_rows, size_t A_cols,
-                                     size_t num_thr,
-                                     size_t blk_rows, size_t blk_cols)
+static void tr_tlb_args_init(struct tr_tlb_arg *args, const struct tr_tlb *tl)
+{
+    size_t thr_num;
+    for (thr_num = 0; thr_num < tl->num_thr; thr_num++) {
+        args[thr_num].tl = tl;
+        args[thr_num].thr_num = thr_num;
+    }
+}
+
+// the tile buffer, kept between calls (see transpose_thrtlb_reserve())
+static struct {
+    void *T;
+    size_t A_rows, A_cols;
+    size_t elsize;
+    size_t num_thr;
+} tlb_scratch;
+
+/*
+ * Returns the tile buffer for an A_rows x A_cols matrix and num_thr threads,
+ * (re)allocating it if needed.  Each thread first touches the tile rows it
+ * gathers, with the same partition as transpose_thread_tlb_gather().
+ */
+static void *tlb_scratch_get(size_t A_rows, size_t A_cols, size_t elsize,
+                             size_t num_thr)
 {
-    transpose_thrrow_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_dcmplx);
+    struct tr_tlb tl = {
+        .A_rows = A_rows,
+        .A_cols = A_cols,
+        .elsize = elsize,
+        .num_thr = num_thr,
+    };
+    struct tr_tlb_arg *args;
+    if (tlb_scratch.T && tlb_scratch.A_rows == A_rows &&
+        tlb_scratch.A_cols == A_cols && tlb_scratch.elsize == elsize &&
+        tlb_scratch.num_thr == num_thr) {
+        return tlb_scratch.T;
+    }
+    transpose_thrtlb_release();
+    tl.T = assert_malloc_al(tile_buffer_size(A_rows, A_cols, elsize));
+    args = thread_pool_args(sizeof(struct tr_tlb_arg), num_thr);
+    tr_tlb_args_init(args, &tl);
+    thread_pool_run(transpose_thread_tlb_touch, args, sizeof(*args), num_thr);
+    tlb_scratch.T = tl.T;
+    tlb_scratch.A_rows = A_rows;
+    tlb_scratch.A_cols = A_cols;
+    tlb_scratch.elsize = elsize;
+    tlb_scratch.num_thr = num_thr;
+    return tlb_scratch.T;
 }
 
-void transpose_flt_thrcol_blocked(const float* restrict A,
-                                  float* restrict B,
-                                  size_t A_rows, size_t A_cols,
-                                  size_t num_thr,
-                                  size_t blk_rows, size_t blk_cols)
+void transpose_thrtlb_reserve(size_t A_rows, size_t A_cols, size_t elsize,
+                              size_t num_thr)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_flt);
+    tlb_scratch_get(A_rows, A_cols, elsize, num_thr);
 }
 
-void transpose_dbl_thrcol_blocked(const double* restrict A,
-                                  double* restrict B,
-                                  size_t A_rows, size_t A_cols,
-                                  size_t num_thr,
-                                  size_t blk_rows, size_t blk_cols)
+void transpose_thrtlb_release(void)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_dbl);
+    if (tlb_scratch.T) {
+        free_al(tlb_scratch.T);
+    }
+    tlb_scratch.T = NULL;
+    tlb_scratch.A_rows = 0;
+    tlb_scratch.A_cols = 0;
+    tlb_scratch.elsize = 0;
+    tlb_scratch.num_thr = 0;
 }
 
-void transpose_fcmplx_thrcol_blocked(const float complex* restrict A,
-                                     float complex* restrict B,
-                                     size_t A_rows, size_t A_cols,
-                                     size_t num_thr,
-                                     size_t blk_rows, size_t blk_cols)
+static void transpose_thrtlb(const void* restrict A, void* restrict B,
+                             size_t A_rows, size_t A_cols, size_t elsize,
+                             size_t num_thr, tile_transpose_fn fn)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_fcmplx);
+    // get the buffer first, since first touching it reuses the args storage
+    struct tr_tlb tl = {
+        .A = A,
+        .T = tlb_scratch_get(A_rows, A_cols, elsize, num_thr),
+        .B = B,
+        .A_rows = A_rows,
+        .A_cols = A_cols,
+        .elsize = elsize,
+        .num_thr = num_thr,
+        .fn = fn,
+    };
+    struct tr_tlb_arg *args = thread_pool_args(sizeof(struct tr_tlb_arg), num_thr);
+    tr_tlb_args_init(args, &tl);
+
+    thread_pool_run(transpose_thread_tlb_gather, args, sizeof(*args), num_thr);
+    thread_pool_run(transpose_thread_tlb_scatter, args, sizeof(*args), num_thr);
 }
 
-void transpose_dcmplx_thrcol_blocked(const double complex* restrict A,
-                                     double complex* restrict B,
-                                     size_t A_rows, size_t A_cols,
-                                     size_t num_thr,
-                                     size_t blk_rows, size_t blk_cols)
+/*
+ * Batched transposes treat the batch as one tall matrix of count * A_rows rows
+ * (row r is row r % A_rows of matrix r / A_rows), and divide its rows between
+ * threads as evenly as possible, so threads aren't left idle while others
+ * transpose a tail of whole matrices when count isn't a multiple of the thread
+ * count.  Each thread's rows of each matrix are transposed cache-obliviously.
+ */
+struct tr_batch {
+    const void* restrict A;
+    void* restrict B;
+    size_t A_rows, A_cols;
+    size_t count, stride;
+    size_t elsize;
+    size_t num_thr;
+    tile_region_fn fn;
+};
+
+struct tr_batch_arg {
+    const struct tr_batch *ba;
+    size_t thr_num;
+};
+
+static void *transpose_thread_batch(void *args)
+{
+    const struct tr_batch_arg *arg = (const struct tr_batch_arg *)args;
+    const struct tr_batch *ba = arg->ba;
+    const size_t n = ba->count * ba->A_rows;
+    const size_t end = (arg->thr_num + 1) * n / ba->num_thr;
+    struct tr_thread_arg mat;
+    size_t r, r_min, r_max, i;
+    for (r = arg->thr_num * n / ba->num_thr; r < end; r += r_max - r_min) {
+        i = r / ba->A_rows;
+        r_min = r % ba->A_rows;
+        r_max = end - r < ba->A_rows - r_min ? r_min + (end - r) : ba->A_rows;
+        tt_arg_init(&mat, (const char *)ba->A + i * ba->stride * ba->elsize,
+                    (char *)ba->B + i * ba->stride * ba->elsize,
+                    ba->A_rows, ba->A_cols, r_min, r_max, 0, ba->A_cols,
+                    0, 0, arg->thr_num);
+        tile_order_recursive(r_min, r_max, 0, ba->A_cols, TRANSPOSE_REC_BASE, 1,
+                             ba->fn, &mat);
+    }
+    return (void *)arg->thr_num;
+}
+
+static void transpose_thrbatch(const void* restrict A, void* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t count, size_t stride, size_t elsize,
+                               size_t num_thr, tile_region_fn fn)
+{
+    const struct tr_batch ba = {
+        .A = A,
+        .B = B,
+        .A_rows = A_rows,
+        .A_cols = A_cols,
+        .count = count,
+        .stride = stride,
+        .elsize = elsize,
+        .num_thr = num_thr,
+        .fn = fn,
+    };
+    struct tr_batch_arg *args =
+        thread_pool_args(sizeof(struct tr_batch_arg), num_thr);
+    size_t thr_num;
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        args[thr_num].ba = &ba;
+        args[thr_num].thr_num = thr_num;
+    }
+
+    thread_pool_run(transpose_thread_batch, args, sizeof(*args), num_thr);
+}
+
+// in-place transposes operate on the matrix in B
+static void *transpose_thread_square_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SQ_BLK(float, (float* restrict)tt_arg->B, tt_arg->A_cols,
+                     tt_arg->r_min, 0, tt_arg->r_max, tt_arg->A_cols);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SQ_BLK(double, (double* restrict)tt_arg->B, tt_arg->A_cols,
+                     tt_arg->r_min, 0, tt_arg->r_max, tt_arg->A_cols);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_fcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SQ_BLK(float complex, (float complex* restrict)tt_arg->B,
+                     tt_arg->A_cols,
+                     tt_arg->r_min, 0, tt_arg->r_max, tt_arg->A_cols);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSPOSE_SQ_BLK(double complex, (double complex* restrict)tt_arg->B,
+                     tt_arg->A_cols,
+                     tt_arg->r_min, 0, tt_arg->r_max, tt_arg->A_cols);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_blocked_flt(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSP_THREAD_SQ_BLK(float, tt_arg, (float* restrict)tt_arg->B);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_blocked_dbl(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSP_THREAD_SQ_BLK(double, tt_arg, (double* restrict)tt_arg->B);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_blocked_fcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSP_THREAD_SQ_BLK(float complex, tt_arg,
+                         (float complex* restrict)tt_arg->B);
+    return (void *)tt_arg->thr_num;
+}
+
+static void *transpose_thread_square_blocked_dcmplx(void *args)
+{
+    const struct tr_thread_arg *tt_arg = (const struct tr_thread_arg *)args;
+    TRANSP_THREAD_SQ_BLK(double complex, tt_arg,
+                         (double complex* restrict)tt_arg->B);
+    return (void *)tt_arg->thr_num;
+}
+
+/*
+ * Returns the first row of a thread's share of the upper triangle (including
+ * the diagonal) of an n x n matrix.
+ * Rows [0, k) cover k*n - k*(k-1)/2 elements, so solve for the k whose rows
+ * cover thr_num/num_thr of the n*(n+1)/2 elements, which gives each thread a
+ * roughly equal number of swaps despite rows getting shorter.
+ */
+static size_t tri_row_split(size_t n, size_t num_thr, size_t thr_num)
+{
+    const double b = 2.0 * n + 1.0;
+    double t, k;
+    if (thr_num >= num_thr) {
+        return n;
+    }
+    t = (double) thr_num / num_thr * n * (n + 1) / 2.0;
+    k = (b - sqrt(b * b - 8.0 * t)) / 2.0 + 0.5;
+    return k < n ? (size_t) k : n;
+}
+
+static void transpose_thrrow_square(void* restrict A, size_t n,
+                                    size_t num_thr, size_t blk,
+                                    void *(*start_routine)(void *))
+{
+    size_t r_min, r_max, thr_num;
+    struct tr_thread_arg *args = thread_pool_args(sizeof(struct tr_thread_arg), num_thr);
+    // divide the (block) rows of the upper triangle among the threads
+    const size_t n_blks = (n + blk - 1) / blk;
+
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        r_min = tri_row_split(n_blks, num_thr, thr_num) * blk;
+        r_max = tri_row_split(n_blks, num_thr, thr_num + 1) * blk;
+        r_min = r_min < n ? r_min : n;
+        r_max = r_max < n ? r_max : n;
+        tt_arg_init(&args[thr_num], NULL, A, n, n,
+                    r_min, r_max, 0, n, blk, blk, thr_num);
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+}
+
+/*
+ * In-place cycle-following transposes: all threads claim chunks of candidate
+ * cycle leaders from a shared counter, so that threads that draw long cycles
+ * don't hold up the others.
+ */
+struct tr_cycles {
+    void* restrict A;
+    atomic_uchar *moved;
+    size_t A_rows, A_cols;
+    atomic_size_t next;
+};
+
+struct tr_cycles_arg {
+    struct tr_cycles *cy;
+    size_t thr_num;
+};
+
+static void *transpose_thread_cycles_flt(void *args)
+{
+    const struct tr_cycles_arg *arg = (const struct tr_cycles_arg *)args;
+    struct tr_cycles *cy = arg->cy;
+    TRANSPOSE_CYCLES(float, (float* restrict)cy->A, cy->moved,
+                     cy->A_rows, cy->A_cols, &cy->next);
+    return (void *)arg->thr_num;
+}
+
+static void *transpose_thread_cycles_dbl(void *args)
+{
+    const struct tr_cycles_arg *arg = (const struct tr_cycles_arg *)args;
+    struct tr_cycles *cy = arg->cy;
+    TRANSPOSE_CYCLES(double, (double* restrict)cy->A, cy->moved,
+                     cy->A_rows, cy->A_cols, &cy->next);
+    return (void *)arg->thr_num;
+}
+
+static void *transpose_thread_cycles_fcmplx(void *args)
+{
+    const struct tr_cycles_arg *arg = (const struct tr_cycles_arg *)args;
+    struct tr_cycles *cy = arg->cy;
+    TRANSPOSE_CYCLES(float complex, (float complex* restrict)cy->A,
+                     cy->moved, cy->A_rows, cy->A_cols, &cy->next);
+    return (void *)arg->thr_num;
+}
+
+static void *transpose_thread_cycles_dcmplx(void *args)
+{
+    const struct tr_cycles_arg *arg = (const struct tr_cycles_arg *)args;
+    struct tr_cycles *cy = arg->cy;
+    TRANSPOSE_CYCLES(double complex, (double complex* restrict)cy->A,
+                     cy->moved, cy->A_rows, cy->A_cols, &cy->next);
+    return (void *)arg->thr_num;
+}
+
+static void transpose_thrcyc_inplace(void* restrict A,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr,
+                                     void *(*start_routine)(void *))
+{
+    const size_t bm_sz = (A_rows * A_cols + CHAR_BIT - 1) / CHAR_BIT;
+    struct tr_cycles cy = {
+        .A = A,
+        .moved = assert_malloc(bm_sz),
+        .A_rows = A_rows,
+        .A_cols = A_cols,
+    };
+    struct tr_cycles_arg *args = thread_pool_args(sizeof(struct tr_cycles_arg), num_thr);
+    size_t thr_num;
+    memset(cy.moved, 0, bm_sz);
+    atomic_init(&cy.next, 0);
+    for (thr_num = 0; thr_num < num_thr; thr_num++) {
+        args[thr_num].cy = &cy;
+        args[thr_num].thr_num = thr_num;
+    }
+
+    thread_pool_run(start_routine, args, sizeof(*args), num_thr);
+
+    free(cy.moved);
+}
+
+void transpose_flt_thrrow(const float* restrict A, float* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_flt);
+}
+
+void transpose_dbl_thrrow(const double* restrict A, double* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrrow(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_fcmplx);
+}
+
+void transpose_dcmplx_thrrow(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_dcmplx);
+}
+
+
+void transpose_flt_thrcol(const float* restrict A, float* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_flt);
+}
+
+void transpose_dbl_thrcol(const double* restrict A, double* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrcol(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_fcmplx);
+}
+
+void transpose_dcmplx_thrcol(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, 0, 0, &transpose_thread_dcmplx);
+}
+
+void transpose_flt_thrrow_blocked(const float* restrict A,
+                                  float* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr,
+                                  size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrrow_blocked(const double* restrict A,
+                                  double* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr,
+                                  size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_dbl);
+}
+
+void transpose_fcmplx_thrrow_blocked(const float complex* restrict A,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_blocked(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_dcmplx);
+}
+
+void transpose_flt_thrcol_blocked(const float* restrict A,
+                                  float* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr,
+                                  size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrcol_blocked(const double* restrict A,
+                                  double* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr,
+                                  size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_dbl);
+}
+
+void transpose_fcmplx_thrcol_blocked(const float complex* restrict A,
+                                     float complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_fcmplx);
+}
+
+void transpose_dcmplx_thrcol_blocked(const double complex* restrict A,
+                                     double complex* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                             num_thr, blk_rows, blk_cols,
+                             &transpose_thread_blocked_dcmplx);
+}
+
+void transpose_flt_thrrow_ld(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_flt);
+}
+
+void transpose_dbl_thrrow_ld(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrrow_ld(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_ld(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_dcmplx);
+}
+
+void transpose_flt_thrcol_ld(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_flt);
+}
+
+void transpose_dbl_thrcol_ld(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_dbl);
+}
+
+void transpose_fcmplx_thrcol_ld(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_fcmplx);
+}
+
+void transpose_dcmplx_thrcol_ld(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             0, 0, &transpose_thread_dcmplx);
+}
+
+void transpose_flt_thrrow_blocked_ld(const float* restrict A,
+                                     float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols, &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrrow_blocked_ld(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols, &transpose_thread_blocked_dbl);
+}
+
+void transpose_fcmplx_thrrow_blocked_ld(const float complex* restrict A,
+                                        float complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols,
+                             &transpose_thread_blocked_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_blocked_ld(const double complex* restrict A,
+                                        double complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrrow_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols,
+                             &transpose_thread_blocked_dcmplx);
+}
+
+void transpose_flt_thrcol_blocked_ld(const float* restrict A,
+                                     float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols, &transpose_thread_blocked_flt);
+}
+
+void transpose_dbl_thrcol_blocked_ld(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols, &transpose_thread_blocked_dbl);
+}
+
+void transpose_fcmplx_thrcol_blocked_ld(const float complex* restrict A,
+                                        float complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols,
+                             &transpose_thread_blocked_fcmplx);
+}
+
+void transpose_dcmplx_thrcol_blocked_ld(const double complex* restrict A,
+                                        double complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols)
+{
+    transpose_thrcol_blocked(A, B, A_rows, A_cols, lda, ldb, num_thr,
+                             blk_rows, blk_cols,
+                             &transpose_thread_blocked_dcmplx);
+}
+
+void transpose_flt_thrrow_square(float* A, size_t n, size_t num_thr)
+{
+    transpose_thrrow_square(A, n, num_thr, 1, &transpose_thread_square_flt);
+}
+
+void transpose_dbl_thrrow_square(double* A, size_t n, size_t num_thr)
+{
+    transpose_thrrow_square(A, n, num_thr, 1, &transpose_thread_square_dbl);
+}
+
+void transpose_fcmplx_thrrow_square(float complex* A, size_t n,
+                                    size_t num_thr)
+{
+    transpose_thrrow_square(A, n, num_thr, 1,
+                            &transpose_thread_square_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_square(double complex* A, size_t n,
+                                    size_t num_thr)
+{
+    transpose_thrrow_square(A, n, num_thr, 1,
+                            &transpose_thread_square_dcmplx);
+}
+
+void transpose_flt_thrrow_square_blocked(float* A, size_t n,
+                                         size_t num_thr, size_t blk)
+{
+    transpose_thrrow_square(A, n, num_thr, blk,
+                            &transpose_thread_square_blocked_flt);
+}
+
+void transpose_dbl_thrrow_square_blocked(double* A, size_t n,
+                                         size_t num_thr, size_t blk)
+{
+    transpose_thrrow_square(A, n, num_thr, blk,
+                            &transpose_thread_square_blocked_dbl);
+}
+
+void transpose_fcmplx_thrrow_square_blocked(float complex* A, size_t n,
+                                            size_t num_thr, size_t blk)
+{
+    transpose_thrrow_square(A, n, num_thr, blk,
+                            &transpose_thread_square_blocked_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_square_blocked(double complex* A, size_t n,
+                                            size_t num_thr, size_t blk)
+{
+    transpose_thrrow_square(A, n, num_thr, blk,
+                            &transpose_thread_square_blocked_dcmplx);
+}
+
+void transpose_flt_thrcyc_inplace(float* A,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr)
+{
+    transpose_thrcyc_inplace(A, A_rows, A_cols, num_thr,
+                             &transpose_thread_cycles_flt);
+}
+
+void transpose_dbl_thrcyc_inplace(double* A,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr)
+{
+    transpose_thrcyc_inplace(A, A_rows, A_cols, num_thr,
+                             &transpose_thread_cycles_dbl);
+}
+
+void transpose_fcmplx_thrcyc_inplace(float complex* A,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_thrcyc_inplace(A, A_rows, A_cols, num_thr,
+                             &transpose_thread_cycles_fcmplx);
+}
+
+void transpose_dcmplx_thrcyc_inplace(double complex* A,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr)
+{
+    transpose_thrcyc_inplace(A, A_rows, A_cols, num_thr,
+                             &transpose_thread_cycles_dcmplx);
+}
+
+void transpose_flt_thrrec(const float* restrict A,
+                          float* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    // split the longer dimension among the threads, then each recurses
+    if (A_rows >= A_cols) {
+        transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_flt);
+    } else {
+        transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_flt);
+    }
+}
+
+void transpose_dbl_thrrec(const double* restrict A,
+                          double* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    // split the longer dimension among the threads, then each recurses
+    if (A_rows >= A_cols) {
+        transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_dbl);
+    } else {
+        transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_dbl);
+    }
+}
+
+void transpose_fcmplx_thrrec(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    // split the longer dimension among the threads, then each recurses
+    if (A_rows >= A_cols) {
+        transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_fcmplx);
+    } else {
+        transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_fcmplx);
+    }
+}
+
+void transpose_dcmplx_thrrec(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    // split the longer dimension among the threads, then each recurses
+    if (A_rows >= A_cols) {
+        transpose_thrrow_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_dcmplx);
+    } else {
+        transpose_thrcol_blocked(A, B, A_rows, A_cols, A_cols, A_rows,
+                                 num_thr, 0, 0,
+                                 &transpose_thread_recursive_dcmplx);
+    }
+}
+
+void transpose_flt_thrmorton(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_morton_flt);
+}
+
+void transpose_dbl_thrmorton(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_morton_dbl);
+}
+
+void transpose_fcmplx_thrmorton(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_morton_fcmplx);
+}
+
+void transpose_dcmplx_thrmorton(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_morton_dcmplx);
+}
+
+void transpose_flt_thrhilbert(const float* restrict A,
+                              float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_hilbert_flt);
+}
+
+void transpose_dbl_thrhilbert(const double* restrict A,
+                              double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_hilbert_dbl);
+}
+
+void transpose_fcmplx_thrhilbert(const float complex* restrict A,
+                                 float complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_hilbert_fcmplx);
+}
+
+void transpose_dcmplx_thrhilbert(const double complex* restrict A,
+                                 double complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t num_thr)
+{
+    transpose_thrcurve(A, B, A_rows, A_cols, num_thr, TRANSPOSE_CURVE_BLK,
+                       &transpose_thread_hilbert_dcmplx);
+}
+
+void transpose_flt_thrtile(const float* restrict A,
+                           float* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr)
+{
+    transpose_thrtile(A, B, A_rows, A_cols, num_thr, TRANSPOSE_TILE_BLK,
+                      &transpose_thread_tile_flt);
+}
+
+void transpose_dbl_thrtile(const double* restrict A,
+                           double* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr)
+{
+    transpose_thrtile(A, B, A_rows, A_cols, num_thr, TRANSPOSE_TILE_BLK,
+                      &transpose_thread_tile_dbl);
+}
+
+void transpose_fcmplx_thrtile(const float complex* restrict A,
+                              float complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_thrtile(A, B, A_rows, A_cols, num_thr, TRANSPOSE_TILE_BLK,
+                      &transpose_thread_tile_fcmplx);
+}
+
+void transpose_dcmplx_thrtile(const double complex* restrict A,
+                              double complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_thrtile(A, B, A_rows, A_cols, num_thr, TRANSPOSE_TILE_BLK,
+                      &transpose_thread_tile_dcmplx);
+}
+
+void transpose_flt_thrnuma(const float* restrict A,
+                           float* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr)
+{
+    transpose_thrnuma(A, B, A_rows, A_cols, sizeof(float), num_thr,
+                      &transpose_thread_blocks_flt);
+}
+
+void transpose_dbl_thrnuma(const double* restrict A,
+                           double* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr)
+{
+    transpose_thrnuma(A, B, A_rows, A_cols, sizeof(double), num_thr,
+                      &transpose_thread_blocks_dbl);
+}
+
+void transpose_fcmplx_thrnuma(const float complex* restrict A,
+                              float complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_thrnuma(A, B, A_rows, A_cols, sizeof(float complex), num_thr,
+                      &transpose_thread_blocks_fcmplx);
+}
+
+void transpose_dcmplx_thrnuma(const double complex* restrict A,
+                              double complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr)
+{
+    transpose_thrnuma(A, B, A_rows, A_cols, sizeof(double complex), num_thr,
+                      &transpose_thread_blocks_dcmplx);
+}
+
+void transpose_flt_thrtlb(const float* restrict A,
+                          float* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    transpose_thrtlb(A, B, A_rows, A_cols, sizeof(float), num_thr,
+                     &tile_transpose_flt);
+}
+
+void transpose_dbl_thrtlb(const double* restrict A,
+                          double* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr)
+{
+    transpose_thrtlb(A, B, A_rows, A_cols, sizeof(double), num_thr,
+                     &tile_transpose_dbl);
+}
+
+void transpose_fcmplx_thrtlb(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrtlb(A, B, A_rows, A_cols, sizeof(float complex), num_thr,
+                     &tile_transpose_fcmplx);
+}
+
+void transpose_dcmplx_thrtlb(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr)
+{
+    transpose_thrtlb(A, B, A_rows, A_cols, sizeof(double complex), num_thr,
+                     &tile_transpose_dcmplx);
+}
+
+void transpose_flt_thrbatch(const float* restrict A,
+                            float* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride,
+                            size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride,
+                       sizeof(float), num_thr,
+                       &transpose_region_flt);
+}
+
+void transpose_dbl_thrbatch(const double* restrict A,
+                            double* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride,
+                            size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride,
+                       sizeof(double), num_thr,
+                       &transpose_region_dbl);
+}
+
+void transpose_fcmplx_thrbatch(const float complex* restrict A,
+                               float complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t count, size_t stride,
+                               size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride,
+                       sizeof(float complex), num_thr,
+                       &transpose_region_fcmplx);
+}
+
+void transpose_dcmplx_thrbatch(const double complex* restrict A,
+                               double complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t count, size_t stride,
+                               size_t num_thr)
+{
+    transpose_thrbatch(A, B, A_rows, A_cols, count, stride,
+                       sizeof(double complex), num_thr,
+                       &transpose_region_dcmplx);
+}
+
+void transpose_fcmplx_thrrow_epi(const float complex* restrict A,
+                                 float complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb, size_t num_thr,
+                                 const transpose_epilogue *epi)
+{
+    transpose_thrrow_epi(A, B, A_rows, A_cols, lda, ldb, num_thr, epi,
+                         &transpose_thread_epi_fcmplx);
+}
+
+void transpose_dcmplx_thrrow_epi(const double complex* restrict A,
+                                 double complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb, size_t num_thr,
+                                 const transpose_epilogue *epi)
 {
-    transpose_thrcol_blocked(A, B, A_rows, A_cols, num_thr, blk_rows,
-                             blk_cols, &transpose_thread_blocked_dcmplx);
+    transpose_thrrow_epi(A, B, A_rows, A_cols, lda, ldb, num_thr, epi,
+                         &transpose_thread_epi_dcmplx);
 }
@@ -10,6 +10,8 @@
 #include <complex.h>
 #include <stdlib.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_flt_thrrow(const float* restrict A, float* restrict B,
                           size_t A_rows, size_t A_cols,
                           size_t num_thr);
@@ -78,4 +80,279 @@ void transpose_dcmplx_thrcol_blocked(const double complex* restrict A,
                                      size_t num_thr,
                                      size_t blk_rows, size_t blk_cols);
 
+/*
+ * As above, for matrices with padded rows: lda and ldb are the leading
+ * dimensions (row strides, in elements) of A and B.
+ */
+void transpose_flt_thrrow_ld(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr);
+void transpose_dbl_thrrow_ld(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr);
+void transpose_fcmplx_thrrow_ld(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr);
+void transpose_dcmplx_thrrow_ld(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_flt_thrcol_ld(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr);
+void transpose_dbl_thrcol_ld(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t lda, size_t ldb, size_t num_thr);
+void transpose_fcmplx_thrcol_ld(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr);
+void transpose_dcmplx_thrcol_ld(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb, size_t num_thr);
+
+void transpose_flt_thrrow_blocked_ld(const float* restrict A,
+                                     float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols);
+void transpose_dbl_thrrow_blocked_ld(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols);
+void transpose_fcmplx_thrrow_blocked_ld(const float complex* restrict A,
+                                        float complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols);
+void transpose_dcmplx_thrrow_blocked_ld(const double complex* restrict A,
+                                        double complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols);
+
+void transpose_flt_thrcol_blocked_ld(const float* restrict A,
+                                     float* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols);
+void transpose_dbl_thrcol_blocked_ld(const double* restrict A,
+                                     double* restrict B,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t lda, size_t ldb, size_t num_thr,
+                                     size_t blk_rows, size_t blk_cols);
+void transpose_fcmplx_thrcol_blocked_ld(const float complex* restrict A,
+                                        float complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols);
+void transpose_dcmplx_thrcol_blocked_ld(const double complex* restrict A,
+                                        double complex* restrict B,
+                                        size_t A_rows, size_t A_cols,
+                                        size_t lda, size_t ldb, size_t num_thr,
+                                        size_t blk_rows, size_t blk_cols);
+
+void transpose_flt_thrrow_square(float* A, size_t n, size_t num_thr);
+void transpose_dbl_thrrow_square(double* A, size_t n, size_t num_thr);
+void transpose_fcmplx_thrrow_square(float complex* A, size_t n,
+                                    size_t num_thr);
+void transpose_dcmplx_thrrow_square(double complex* A, size_t n,
+                                    size_t num_thr);
+
+void transpose_flt_thrrow_square_blocked(float* A, size_t n,
+                                         size_t num_thr, size_t blk);
+void transpose_dbl_thrrow_square_blocked(double* A, size_t n,
+                                         size_t num_thr, size_t blk);
+void transpose_fcmplx_thrrow_square_blocked(float complex* A, size_t n,
+                                            size_t num_thr, size_t blk);
+void transpose_dcmplx_thrrow_square_blocked(double complex* A, size_t n,
+                                            size_t num_thr, size_t blk);
+
+void transpose_flt_thrcyc_inplace(float* A,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr);
+void transpose_dbl_thrcyc_inplace(double* A,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t num_thr);
+void transpose_fcmplx_thrcyc_inplace(float complex* A,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+void transpose_dcmplx_thrcyc_inplace(double complex* A,
+                                     size_t A_rows, size_t A_cols,
+                                     size_t num_thr);
+
+void transpose_flt_thrrec(const float* restrict A,
+                          float* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr);
+void transpose_dbl_thrrec(const double* restrict A,
+                          double* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr);
+void transpose_fcmplx_thrrec(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+void transpose_dcmplx_thrrec(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+
+void transpose_flt_thrmorton(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+void transpose_dbl_thrmorton(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+void transpose_fcmplx_thrmorton(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t num_thr);
+void transpose_dcmplx_thrmorton(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t num_thr);
+
+void transpose_flt_thrhilbert(const float* restrict A,
+                              float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+void transpose_dbl_thrhilbert(const double* restrict A,
+                              double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+void transpose_fcmplx_thrhilbert(const float complex* restrict A,
+                                 float complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t num_thr);
+void transpose_dcmplx_thrhilbert(const double complex* restrict A,
+                                 double complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t num_thr);
+
+void transpose_flt_thrtile(const float* restrict A,
+                           float* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr);
+void transpose_dbl_thrtile(const double* restrict A,
+                           double* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr);
+void transpose_fcmplx_thrtile(const float complex* restrict A,
+                              float complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+void transpose_dcmplx_thrtile(const double complex* restrict A,
+                              double complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+
+void transpose_flt_thrnuma(const float* restrict A,
+                           float* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr);
+void transpose_dbl_thrnuma(const double* restrict A,
+                           double* restrict B,
+                           size_t A_rows, size_t A_cols,
+                           size_t num_thr);
+void transpose_fcmplx_thrnuma(const float complex* restrict A,
+                              float complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+void transpose_dcmplx_thrnuma(const double complex* restrict A,
+                              double complex* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t num_thr);
+
+/*
+ * When their threads span more than one NUMA node, NUMA-hierarchical
+ * transposes go through a scratch matrix the size of A, which is kept between
+ * calls with the same size and thread count.  Reserve it ahead of the timed
+ * transposes (elements of size elsize), so it's allocated and placed on the
+ * threads' nodes only once, and release it when done.
+ */
+void transpose_thrnuma_reserve(size_t A_rows, size_t A_cols, size_t elsize,
+                               size_t num_thr);
+void transpose_thrnuma_release(void);
+
+void transpose_flt_thrtlb(const float* restrict A,
+                          float* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr);
+void transpose_dbl_thrtlb(const double* restrict A,
+                          double* restrict B,
+                          size_t A_rows, size_t A_cols,
+                          size_t num_thr);
+void transpose_fcmplx_thrtlb(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+void transpose_dcmplx_thrtlb(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols,
+                             size_t num_thr);
+
+/*
+ * Threaded TLB-aware transposes go through a tile buffer the size of A, which
+ * is kept between calls with the same size and thread count.  Reserve it ahead
+ * of the timed transposes (elements of size elsize), so it's allocated and
+ * first touched by the threads that gather into it only once, and release it
+ * when done.
+ */
+void transpose_thrtlb_reserve(size_t A_rows, size_t A_cols, size_t elsize,
+                              size_t num_thr);
+void transpose_thrtlb_release(void);
+
+/*
+ * Batched transposes, as in transpose.h: matrix i starts at &A[i * stride] and
+ * its transpose at &B[i * stride].  The rows of all matrices in the batch are
+ * divided between the threads, so any count and thread count are supported.
+ */
+void transpose_flt_thrbatch(const float* restrict A,
+                            float* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride,
+                            size_t num_thr);
+void transpose_dbl_thrbatch(const double* restrict A,
+                            double* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride,
+                            size_t num_thr);
+void transpose_fcmplx_thrbatch(const float complex* restrict A,
+                               float complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t count, size_t stride,
+                               size_t num_thr);
+void transpose_dcmplx_thrbatch(const double complex* restrict A,
+                               double complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t count, size_t stride,
+                               size_t num_thr);
+
+/*
+ * Transposes with a fused epilogue, as in transpose.h, dividing rows between
+ * threads.
+ */
+void transpose_fcmplx_thrrow_epi(const float complex* restrict A,
+                                 float complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb, size_t num_thr,
+                                 const transpose_epilogue *epi);
+
+void transpose_dcmplx_thrrow_epi(const double complex* restrict A,
+                                 double complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb, size_t num_thr,
+                                 const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_THREADS_H */
@@ -0,0 +1,124 @@
+/**
+ * Twiddle factors fused into transposes, for six-step FFTs.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#undef NDEBUG
+#include <assert.h>
+#include <complex.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "transpose-twiddle.h"
+#include "util.h"
+
+// -std=c11 doesn't define M_PI
+#define TWIDDLE_PI 3.14159265358979323846
+
+// w^k, where w = exp(sign * 2 * pi * i / n)
+static double complex twiddle(size_t k, size_t n, int sign)
+{
+    const double a = sign * 2 * TWIDDLE_PI * ((double) k / (double) n);
+    return cos(a) + I * sin(a);
+}
+
+// aligned allocations must be whole cache lines
+static void *table_alloc(size_t sz)
+{
+    return assert_malloc_al((sz + 63) & ~(size_t) 63);
+}
+
+// copy len values to a new table of float complex or double complex values
+static void *table_copy(const double complex *x, size_t len, size_t elsize)
+{
+    void *t = table_alloc(len * elsize);
+    size_t i;
+    for (i = 0; i < len; i++) {
+        if (elsize == sizeof(float complex)) {
+            ((float complex *)t)[i] = (float complex) x[i];
+        } else {
+            ((double complex *)t)[i] = x[i];
+        }
+    }
+    return t;
+}
+
+static transpose_twiddle *twiddle_create(size_t A_rows, size_t A_cols,
+                                         int sign, int full, size_t elsize)
+{
+    const size_t n = A_rows * A_cols;
+    transpose_twiddle *tw = assert_malloc(sizeof(transpose_twiddle));
+    double complex *lo, *hi;
+    size_t lo_len, hi_len, mask, r, c, k;
+    // r * c must fit in 64 bits, and the AVX-512 kernels multiply 32-bit halves
+    assert(A_rows && A_cols);
+    assert(A_rows <= UINT32_MAX && A_cols <= UINT32_MAX);
+
+    // lo_len is the smallest power of two with lo_len * lo_len >= n
+    tw->lo_bits = 0;
+    while (((size_t) 1 << (2 * tw->lo_bits)) < n) {
+        tw->lo_bits++;
+    }
+    lo_len = (size_t) 1 << tw->lo_bits;
+    hi_len = ((n - 1) >> tw->lo_bits) + 1;
+    mask = lo_len - 1;
+    lo = assert_malloc(lo_len * sizeof(double complex));
+    hi = assert_malloc(hi_len * sizeof(double complex));
+    for (k = 0; k < lo_len; k++) {
+        lo[k] = twiddle(k, n, sign);
+    }
+    for (k = 0; k < hi_len; k++) {
+        hi[k] = twiddle(k << tw->lo_bits, n, sign);
+    }
+
+    if (full) {
+        // the product of two tables is far cheaper to compute than sin and cos
+        // of every factor, and is just as precise in the matrices' type
+        tw->full = table_alloc(n * elsize);
+        tw->lo = NULL;
+        tw->hi = NULL;
+        tw->size = n * elsize;
+        for (c = 0; c < A_cols; c++) {
+            for (r = 0; r < A_rows; r++) {
+                k = r * c;
+                if (elsize == sizeof(float complex)) {
+                    ((float complex *)tw->full)[c * A_rows + r] =
+                        (float complex) (lo[k & mask] * hi[k >> tw->lo_bits]);
+                } else {
+                    ((double complex *)tw->full)[c * A_rows + r] =
+                        lo[k & mask] * hi[k >> tw->lo_bits];
+                }
+            }
+        }
+    } else {
+        tw->full = NULL;
+        tw->lo = table_copy(lo, lo_len, elsize);
+        tw->hi = table_copy(hi, hi_len, elsize);
+        tw->size = (lo_len + hi_len) * elsize;
+    }
+    free(hi);
+    free(lo);
+    return tw;
+}
+
+transpose_twiddle *transpose_twiddle_fcmplx(size_t A_rows, size_t A_cols,
+                                            int sign, int full)
+{
+    return twiddle_create(A_rows, A_cols, sign, full, sizeof(float complex));
+}
+
+transpose_twiddle *transpose_twiddle_dcmplx(size_t A_rows, size_t A_cols,
+                                            int sign, int full)
+{
+    return twiddle_create(A_rows, A_cols, sign, full, sizeof(double complex));
+}
+
+void transpose_twiddle_destroy(transpose_twiddle *tw)
+{
+    free_al((void *)tw->full);
+    free_al((void *)tw->lo);
+    free_al((void *)tw->hi);
+    free(tw);
+}
@@ -0,0 +1,60 @@
+/**
+ * Twiddle factors fused into transposes, for six-step FFTs.
+ *
+ * A six-step FFT of length n = A_rows * A_cols multiplies the element at row r
+ * and column c of the matrix between its two sets of 1-D FFTs by w^(r * c),
+ * where w = exp(sign * 2 * pi * i / n).  Transposes with an epilogue (see
+ * transpose-epilogue.h) apply the twiddle factors as they write B, rather than
+ * making another pass over the matrix.
+ *
+ * @author Connor Imes <cimes@isi.edu>
+ * @date 2026-10-17
+ */
+#ifndef TRANSPOSE_TWIDDLE_H
+#define TRANSPOSE_TWIDDLE_H
+
+#include <complex.h>
+#include <stdlib.h>
+
+/**
+ * If full is not NULL, it holds every twiddle factor, stored as B is: the
+ * factor for row r and column c of A is at full[c * A_rows + r].
+ * Otherwise, factors are computed on the fly from two tables of about sqrt(n)
+ * values each, as w^k = lo[k % lo_len] * hi[k / lo_len], where k = r * c and
+ * lo_len = 2^lo_bits.
+ * Tables hold values of the matrices' type (float complex or double complex).
+ */
+typedef struct transpose_twiddle {
+    const void *full;
+    const void *lo;
+    const void *hi;
+    size_t lo_bits;
+    // total size of the tables, in bytes
+    size_t size;
+} transpose_twiddle;
+
+/*
+ * Twiddle factor for row r and column c of an A_rows x A_cols matrix A.
+ * Requires r * c < A_rows * A_cols, i.e., r and c must be in range.
+ */
+#define TRANSPOSE_TWIDDLE(datatype, tw, A_rows, r, c) \
+    ((tw)->full ? ((const datatype *)(tw)->full)[(c) * (A_rows) + (r)] : \
+     ((const datatype *)(tw)->lo)[((r) * (c)) & \
+                                  (((size_t) 1 << (tw)->lo_bits) - 1)] * \
+     ((const datatype *)(tw)->hi)[((r) * (c)) >> (tw)->lo_bits])
+
+/**
+ * Create twiddle factors for a six-step FFT with sign FFTW_FORWARD (-1) or
+ * FFTW_BACKWARD (1), of length A_rows * A_cols.  With full set, all factors
+ * are precomputed, which takes as much memory as the matrix; otherwise, only
+ * the two small tables are.
+ * A_rows and A_cols must be less than 2^32.
+ */
+transpose_twiddle *transpose_twiddle_fcmplx(size_t A_rows, size_t A_cols,
+                                            int sign, int full);
+transpose_twiddle *transpose_twiddle_dcmplx(size_t A_rows, size_t A_cols,
+                                            int sign, int full);
+
+void transpose_twiddle_destroy(transpose_twiddle *tw);
+
+#endif /* TRANSPOSE_TWIDDLE_H */
@@ -6,20 +6,35 @@
  * @date 2019-07-15
  */
 #include <complex.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "tile-buffer.h"
+#include "tile-order.h"
 #include "transpose.h"
+#include "transpose-epilogue.h"
+#include "transpose-inplace.h"
+#include "transpose-square.h"
+#include "util.h"
 
-#define TRANSPOSE_BLK(A, B, A_rows, A_cols, r_min, c_min, r_max, c_max) { \
+// recursion stops at regions no larger than this in either dimension
+#define TRANSPOSE_REC_BASE 16
+// tile size for space-filling curve traversals
+#define TRANSPOSE_CURVE_BLK 16
+
+#define TRANSPOSE_BLK(A, B, lda, ldb, r_min, c_min, r_max, c_max) { \
     size_t r, c; \
     for (r = (r_min); r < (r_max); r++) { \
         for (c = (c_min); c < (c_max); c++) { \
-            (B)[(c) * (A_rows) + (r)] = (A)[(r) * (A_cols) + (c)]; \
+            (B)[(c) * (ldb) + (r)] = (A)[(r) * (lda) + (c)]; \
         } \
     } \
 }
 
-#define TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, blk_rows, blk_cols) { \
+#define TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, lda, ldb, \
+                          blk_rows, blk_cols) { \
     /* take the ceiling of (A_rows / blk_rows) */ \
     const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows; \
     /* take the ceiling of (A_cols / blk_cols) */ \
@@ -45,49 +60,134 @@
                 c_max = c_min + cblk_remainder; \
             } \
             /* perform actual transpose over current block */ \
-            TRANSPOSE_BLK(A, B, A_rows, A_cols, r_min, c_min, r_max, c_max); \
+            TRANSPOSE_BLK(A, B, lda, ldb, r_min, c_min, r_max, c_max); \
+        } \
+    } \
+}
+
+/* swap each block on or above the diagonal with its mirror block */
+#define TRANSPOSE_SQUARE_BLOCKED(datatype, A, n, blk) { \
+    size_t r_min, c_min, r_max, c_max; \
+    for (r_min = 0; r_min < (n); r_min += (blk)) { \
+        r_max = r_min + (blk) < (n) ? r_min + (blk) : (n); \
+        for (c_min = r_min; c_min < (n); c_min += (blk)) { \
+            c_max = c_min + (blk) < (n) ? c_min + (blk) : (n); \
+            TRANSPOSE_SQ_BLK(datatype, A, n, r_min, c_min, r_max, c_max); \
+        } \
+    } \
+}
+
+/*
+ * In-place transpose of a rectangular matrix by following the cycles of the
+ * permutation (see transpose-inplace.h).
+ * A bitmap marks elements already moved so each cycle is only followed once,
+ * starting from its smallest index.
+ */
+#define TRANSPOSE_INPLACE(datatype, A, A_rows, A_cols) { \
+    const size_t n = (A_rows) * (A_cols); \
+    const size_t bm_sz = (n + CHAR_BIT - 1) / CHAR_BIT; \
+    unsigned char *visited; \
+    size_t p, cur, next; \
+    datatype tmp; \
+    if ((A_rows) > 1 && (A_cols) > 1) { \
+        visited = assert_malloc(bm_sz); \
+        memset(visited, 0, bm_sz); \
+        for (p = 1; p < n - 1; p++) { \
+            if (BITMAP_GET(visited, p)) { \
+                continue; \
+            } \
+            tmp = (A)[p]; \
+            cur = p; \
+            while ((next = INPLACE_SRC(cur, A_rows, A_cols)) != p) { \
+                (A)[cur] = (A)[next]; \
+                BITMAP_SET(visited, next); \
+                cur = next; \
+            } \
+            (A)[cur] = tmp; \
         } \
+        free(visited); \
     } \
 }
 
+/* transpose each region visited by a tile traversal */
+struct tr_region_arg {
+    const void* restrict A;
+    void* restrict B;
+    size_t A_rows, A_cols;
+};
+
+static void transpose_region_flt(void *ctx, size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    TRANSPOSE_BLK((const float* restrict)arg->A, (float* restrict)arg->B,
+                  arg->A_cols, arg->A_rows, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_region_dbl(void *ctx, size_t r_min, size_t r_max,
+                                 size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    TRANSPOSE_BLK((const double* restrict)arg->A, (double* restrict)arg->B,
+                  arg->A_cols, arg->A_rows, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_region_fcmplx(void *ctx, size_t r_min, size_t r_max,
+                                    size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    TRANSPOSE_BLK((const float complex* restrict)arg->A,
+                  (float complex* restrict)arg->B,
+                  arg->A_cols, arg->A_rows, r_min, c_min, r_max, c_max);
+}
+
+static void transpose_region_dcmplx(void *ctx, size_t r_min, size_t r_max,
+                                    size_t c_min, size_t c_max)
+{
+    const struct tr_region_arg *arg = (const struct tr_region_arg *)ctx;
+    TRANSPOSE_BLK((const double complex* restrict)arg->A,
+                  (double complex* restrict)arg->B,
+                  arg->A_cols, arg->A_rows, r_min, c_min, r_max, c_max);
+}
+
 void transpose_flt_naive(const float* restrict A, float* restrict B,
                          size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    TRANSPOSE_BLK(A, B, A_cols, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_dbl_naive(const double* restrict A, double* restrict B,
                          size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    TRANSPOSE_BLK(A, B, A_cols, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_fcmplx_naive(const float complex* restrict A,
                             float complex* restrict B,
                             size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    TRANSPOSE_BLK(A, B, A_cols, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_dcmplx_naive(const double complex* restrict A,
                             double complex* restrict B,
                             size_t A_rows, size_t A_cols)
 {
-    TRANSPOSE_BLK(A, B, A_rows, A_cols, 0, 0, A_rows, A_cols);
+    TRANSPOSE_BLK(A, B, A_cols, A_rows, 0, 0, A_rows, A_cols);
 }
 
 void transpose_flt_blocked(const float* restrict A, float* restrict B,
                            size_t A_rows, size_t A_cols,
                            size_t blk_rows, size_t blk_cols)
 {
-    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, blk_rows, blk_cols);
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, A_cols, A_rows, blk_rows, blk_cols);
 }
 
 void transpose_dbl_blocked(const double* restrict A, double* restrict B,
                            size_t A_rows, size_t A_cols,
                            size_t blk_rows, size_t blk_cols)
 {
-    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, blk_rows, blk_cols);
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, A_cols, A_rows, blk_rows, blk_cols);
 }
 
 void transpose_fcmplx_blocked(const float complex* restrict A,
@@ -95,7 +195,7 @@ void transpose_fcmplx_blocked(const float complex* restrict A,
                               size_t A_rows, size_t A_cols,
                               size_t blk_rows, size_t blk_cols)
 {
-    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, blk_rows, blk_cols);
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, A_cols, A_rows, blk_rows, blk_cols);
 }
 
 void transpose_dcmplx_blocked(const double complex* restrict A,
@@ -103,5 +203,452 @@ void transpose_dcmplx_blocked(const double complex* restrict A,
                               size_t A_rows, size_t A_cols,
                               size_t blk_rows, size_t blk_cols)
 {
-    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, blk_rows, blk_cols);
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, A_cols, A_rows, blk_rows, blk_cols);
+}
+
+void transpose_flt_naive_ld(const float* restrict A,
+                            float* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t lda, size_t ldb)
+{
+    TRANSPOSE_BLK(A, B, lda, ldb, 0, 0, A_rows, A_cols);
+}
+
+void transpose_dbl_naive_ld(const double* restrict A,
+                            double* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t lda, size_t ldb)
+{
+    TRANSPOSE_BLK(A, B, lda, ldb, 0, 0, A_rows, A_cols);
+}
+
+void transpose_fcmplx_naive_ld(const float complex* restrict A,
+                               float complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb)
+{
+    TRANSPOSE_BLK(A, B, lda, ldb, 0, 0, A_rows, A_cols);
+}
+
+void transpose_dcmplx_naive_ld(const double complex* restrict A,
+                               double complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb)
+{
+    TRANSPOSE_BLK(A, B, lda, ldb, 0, 0, A_rows, A_cols);
+}
+
+void transpose_flt_blocked_ld(const float* restrict A,
+                              float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb,
+                              size_t blk_rows, size_t blk_cols)
+{
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, lda, ldb, blk_rows, blk_cols);
+}
+
+void transpose_dbl_blocked_ld(const double* restrict A,
+                              double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb,
+                              size_t blk_rows, size_t blk_cols)
+{
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, lda, ldb, blk_rows, blk_cols);
+}
+
+void transpose_fcmplx_blocked_ld(const float complex* restrict A,
+                                 float complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb,
+                                 size_t blk_rows, size_t blk_cols)
+{
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, lda, ldb, blk_rows, blk_cols);
+}
+
+void transpose_dcmplx_blocked_ld(const double complex* restrict A,
+                                 double complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb,
+                                 size_t blk_rows, size_t blk_cols)
+{
+    TRANSPOSE_BLOCKED(A, B, A_rows, A_cols, lda, ldb, blk_rows, blk_cols);
+}
+
+void transpose_flt_square_naive(float* A, size_t n)
+{
+    TRANSPOSE_SQ_BLK(float, A, n, 0, 0, n, n);
+}
+
+void transpose_dbl_square_naive(double* A, size_t n)
+{
+    TRANSPOSE_SQ_BLK(double, A, n, 0, 0, n, n);
+}
+
+void transpose_fcmplx_square_naive(float complex* A, size_t n)
+{
+    TRANSPOSE_SQ_BLK(float complex, A, n, 0, 0, n, n);
+}
+
+void transpose_dcmplx_square_naive(double complex* A, size_t n)
+{
+    TRANSPOSE_SQ_BLK(double complex, A, n, 0, 0, n, n);
+}
+
+void transpose_flt_square_blocked(float* A, size_t n, size_t blk)
+{
+    TRANSPOSE_SQUARE_BLOCKED(float, A, n, blk);
+}
+
+void transpose_dbl_square_blocked(double* A, size_t n, size_t blk)
+{
+    TRANSPOSE_SQUARE_BLOCKED(double, A, n, blk);
+}
+
+void transpose_fcmplx_square_blocked(float complex* A, size_t n, size_t blk)
+{
+    TRANSPOSE_SQUARE_BLOCKED(float complex, A, n, blk);
+}
+
+void transpose_dcmplx_square_blocked(double complex* A, size_t n, size_t blk)
+{
+    TRANSPOSE_SQUARE_BLOCKED(double complex, A, n, blk);
+}
+
+void transpose_flt_inplace(float* A, size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_INPLACE(float, A, A_rows, A_cols);
+}
+
+void transpose_dbl_inplace(double* A, size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_INPLACE(double, A, A_rows, A_cols);
+}
+
+void transpose_fcmplx_inplace(float complex* A, size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_INPLACE(float complex, A, A_rows, A_cols);
+}
+
+void transpose_dcmplx_inplace(double complex* A, size_t A_rows, size_t A_cols)
+{
+    TRANSPOSE_INPLACE(double complex, A, A_rows, A_cols);
+}
+
+void transpose_flt_recursive(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_flt, &arg);
+}
+
+void transpose_dbl_recursive(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_dbl, &arg);
+}
+
+void transpose_fcmplx_recursive(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_fcmplx, &arg);
+}
+
+void transpose_dcmplx_recursive(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                         &transpose_region_dcmplx, &arg);
+}
+
+void transpose_flt_morton(const float* restrict A,
+                          float* restrict B,
+                          size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_morton(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                      &transpose_region_flt, &arg);
+}
+
+void transpose_dbl_morton(const double* restrict A,
+                          double* restrict B,
+                          size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_morton(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                      &transpose_region_dbl, &arg);
+}
+
+void transpose_fcmplx_morton(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_morton(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                      &transpose_region_fcmplx, &arg);
+}
+
+void transpose_dcmplx_morton(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_morton(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                      &transpose_region_dcmplx, &arg);
+}
+
+void transpose_flt_hilbert(const float* restrict A,
+                           float* restrict B,
+                           size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_hilbert(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                       &transpose_region_flt, &arg);
+}
+
+void transpose_dbl_hilbert(const double* restrict A,
+                           double* restrict B,
+                           size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_hilbert(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                       &transpose_region_dbl, &arg);
+}
+
+void transpose_fcmplx_hilbert(const float complex* restrict A,
+                              float complex* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_hilbert(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                       &transpose_region_fcmplx, &arg);
+}
+
+void transpose_dcmplx_hilbert(const double complex* restrict A,
+                              double complex* restrict B,
+                              size_t A_rows, size_t A_cols)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    tile_order_hilbert(A_rows, A_cols, TRANSPOSE_CURVE_BLK, 0, SIZE_MAX,
+                       &transpose_region_dcmplx, &arg);
+}
+
+// the tile buffer, kept between calls (see transpose_tlb_reserve())
+static struct {
+    void *T;
+    size_t A_rows, A_cols;
+    size_t elsize;
+} tlb_scratch;
+
+/*
+ * Returns the tile buffer for an A_rows x A_cols matrix, (re)allocating and
+ * first touching it if needed.
+ */
+static void *tlb_scratch_get(size_t A_rows, size_t A_cols, size_t elsize)
+{
+    const size_t blk_rows = tile_buffer_blk_rows(elsize);
+    const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows;
+    if (tlb_scratch.T && tlb_scratch.A_rows == A_rows &&
+        tlb_scratch.A_cols == A_cols && tlb_scratch.elsize == elsize) {
+        return tlb_scratch.T;
+    }
+    transpose_tlb_release();
+    tlb_scratch.T = assert_malloc_al(tile_buffer_size(A_rows, A_cols, elsize));
+    tile_buffer_touch(tlb_scratch.T, A_rows, A_cols, elsize, 0, n_rblks);
+    tlb_scratch.A_rows = A_rows;
+    tlb_scratch.A_cols = A_cols;
+    tlb_scratch.elsize = elsize;
+    return tlb_scratch.T;
+}
+
+void transpose_tlb_reserve(size_t A_rows, size_t A_cols, size_t elsize)
+{
+    tlb_scratch_get(A_rows, A_cols, elsize);
+}
+
+void transpose_tlb_release(void)
+{
+    if (tlb_scratch.T) {
+        free_al(tlb_scratch.T);
+    }
+    tlb_scratch.T = NULL;
+    tlb_scratch.A_rows = 0;
+    tlb_scratch.A_cols = 0;
+    tlb_scratch.elsize = 0;
+}
+
+/*
+ * Multi-pass transpose through a tile-contiguous buffer: gather A's tiles into
+ * pages, then transpose each tile in cache and write it out to B.
+ */
+static void transpose_tlb(const void* restrict A, void* restrict B,
+                          size_t A_rows, size_t A_cols, size_t elsize,
+                          tile_transpose_fn fn)
+{
+    const size_t blk_rows = tile_buffer_blk_rows(elsize);
+    const size_t n_rblks = (A_rows + blk_rows - 1) / blk_rows;
+    const size_t n_cblks = (A_cols + TILE_BUFFER_BLK_COLS - 1) /
+                           TILE_BUFFER_BLK_COLS;
+    void *T = tlb_scratch_get(A_rows, A_cols, elsize);
+    tile_buffer_gather(A, T, A_rows, A_cols, elsize, 0, n_rblks);
+    tile_buffer_scatter(T, B, A_rows, A_cols, elsize, 0, n_cblks, fn);
+}
+
+void transpose_flt_tlb(const float* restrict A,
+                       float* restrict B,
+                       size_t A_rows, size_t A_cols)
+{
+    transpose_tlb(A, B, A_rows, A_cols, sizeof(float), &tile_transpose_flt);
+}
+
+void transpose_dbl_tlb(const double* restrict A,
+                       double* restrict B,
+                       size_t A_rows, size_t A_cols)
+{
+    transpose_tlb(A, B, A_rows, A_cols, sizeof(double), &tile_transpose_dbl);
+}
+
+void transpose_fcmplx_tlb(const float complex* restrict A,
+                          float complex* restrict B,
+                          size_t A_rows, size_t A_cols)
+{
+    transpose_tlb(A, B, A_rows, A_cols, sizeof(float complex),
+                  &tile_transpose_fcmplx);
+}
+
+void transpose_dcmplx_tlb(const double complex* restrict A,
+                          double complex* restrict B,
+                          size_t A_rows, size_t A_cols)
+{
+    transpose_tlb(A, B, A_rows, A_cols, sizeof(double complex),
+                  &tile_transpose_dcmplx);
+}
+
+void transpose_flt_batch(const float* restrict A,
+                         float* restrict B,
+                         size_t A_rows, size_t A_cols,
+                         size_t count, size_t stride)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    size_t i;
+    for (i = 0; i < count; i++) {
+        arg.A = &A[i * stride];
+        arg.B = &B[i * stride];
+        tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                             &transpose_region_flt, &arg);
+    }
+}
+
+void transpose_dbl_batch(const double* restrict A,
+                         double* restrict B,
+                         size_t A_rows, size_t A_cols,
+                         size_t count, size_t stride)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    size_t i;
+    for (i = 0; i < count; i++) {
+        arg.A = &A[i * stride];
+        arg.B = &B[i * stride];
+        tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                             &transpose_region_dbl, &arg);
+    }
+}
+
+void transpose_fcmplx_batch(const float complex* restrict A,
+                            float complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    size_t i;
+    for (i = 0; i < count; i++) {
+        arg.A = &A[i * stride];
+        arg.B = &B[i * stride];
+        tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                             &transpose_region_fcmplx, &arg);
+    }
+}
+
+void transpose_dcmplx_batch(const double complex* restrict A,
+                            double complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride)
+{
+    struct tr_region_arg arg = { A, B, A_rows, A_cols };
+    size_t i;
+    for (i = 0; i < count; i++) {
+        arg.A = &A[i * stride];
+        arg.B = &B[i * stride];
+        tile_order_recursive(0, A_rows, 0, A_cols, TRANSPOSE_REC_BASE, 1,
+                             &transpose_region_dcmplx, &arg);
+    }
+}
+
+/*
+ * Transposes with a fused epilogue (see transpose-epilogue.h).  Blocked
+ * variants need not use divisors of the matrix dimensions for block sizes.
+ */
+#define TRANSPOSE_BLOCKED_EPI(datatype, fn_conj, A, B, A_rows, A_cols, \
+                              lda, ldb, blk_rows, blk_cols, epi) { \
+    size_t r_min, c_min, r_max, c_max; \
+    for (r_min = 0; r_min < (A_rows); r_min += (blk_rows)) { \
+        r_max = r_min + (blk_rows) < (A_rows) ? r_min + (blk_rows) : (A_rows); \
+        for (c_min = 0; c_min < (A_cols); c_min += (blk_cols)) { \
+            c_max = c_min + (blk_cols) < (A_cols) ? \
+                    c_min + (blk_cols) : (A_cols); \
+            TRANSPOSE_BLK_EPI(datatype, fn_conj, A, B, A_rows, A_cols, \
+                              lda, ldb, r_min, c_min, r_max, c_max, epi); \
+        } \
+    } \
+}
+
+void transpose_fcmplx_naive_epi(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                const transpose_epilogue *epi)
+{
+    TRANSPOSE_BLK_EPI(float complex, conjf, A, B, A_rows, A_cols, lda, ldb,
+                      0, 0, A_rows, A_cols, epi);
+}
+
+void transpose_dcmplx_naive_epi(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                const transpose_epilogue *epi)
+{
+    TRANSPOSE_BLK_EPI(double complex, conj, A, B, A_rows, A_cols, lda, ldb,
+                      0, 0, A_rows, A_cols, epi);
+}
+
+void transpose_fcmplx_blocked_epi(const float complex* restrict A,
+                                  float complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb,
+                                  size_t blk_rows, size_t blk_cols,
+                                  const transpose_epilogue *epi)
+{
+    TRANSPOSE_BLOCKED_EPI(float complex, conjf, A, B, A_rows, A_cols,
+                          lda, ldb, blk_rows, blk_cols, epi);
+}
+
+void transpose_dcmplx_blocked_epi(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb,
+                                  size_t blk_rows, size_t blk_cols,
+                                  const transpose_epilogue *epi)
+{
+    TRANSPOSE_BLOCKED_EPI(double complex, conj, A, B, A_rows, A_cols,
+                          lda, ldb, blk_rows, blk_cols, epi);
 }
@@ -11,6 +11,8 @@
 #include <complex.h>
 #include <stdlib.h>
 
+#include "transpose-epilogue.h"
+
 void transpose_flt_naive(const float* restrict A, float* restrict B,
                          size_t A_rows, size_t A_cols);
 void transpose_dbl_naive(const double* restrict A, double* restrict B,
@@ -37,4 +39,180 @@ void transpose_dcmplx_blocked(const double complex* restrict A,
                               size_t A_rows, size_t A_cols,
                               size_t blk_rows, size_t blk_cols);
 
+/*
+ * Transposes of matrices with padded rows: lda and ldb are the leading
+ * dimensions (row strides, in elements) of A and B, where lda >= A_cols and
+ * ldb >= A_rows.  Padding rows so that the strides aren't large powers of two
+ * avoids cache set conflicts between the rows of a block.
+ * The matrices may also be windows of larger ones, e.g., to transpose the
+ * A_rows x A_cols window at row r and column c of a frame into the mirrored
+ * window of the transposed frame, without copying, pass &A[r * lda + c] and
+ * &B[c * ldb + r], with the frames' row strides.
+ */
+void transpose_flt_naive_ld(const float* restrict A,
+                            float* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t lda, size_t ldb);
+void transpose_dbl_naive_ld(const double* restrict A,
+                            double* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t lda, size_t ldb);
+void transpose_fcmplx_naive_ld(const float complex* restrict A,
+                               float complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb);
+void transpose_dcmplx_naive_ld(const double complex* restrict A,
+                               double complex* restrict B,
+                               size_t A_rows, size_t A_cols,
+                               size_t lda, size_t ldb);
+
+void transpose_flt_blocked_ld(const float* restrict A,
+                              float* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb,
+                              size_t blk_rows, size_t blk_cols);
+void transpose_dbl_blocked_ld(const double* restrict A,
+                              double* restrict B,
+                              size_t A_rows, size_t A_cols,
+                              size_t lda, size_t ldb,
+                              size_t blk_rows, size_t blk_cols);
+void transpose_fcmplx_blocked_ld(const float complex* restrict A,
+                                 float complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb,
+                                 size_t blk_rows, size_t blk_cols);
+void transpose_dcmplx_blocked_ld(const double complex* restrict A,
+                                 double complex* restrict B,
+                                 size_t A_rows, size_t A_cols,
+                                 size_t lda, size_t ldb,
+                                 size_t blk_rows, size_t blk_cols);
+
+void transpose_flt_square_naive(float* A, size_t n);
+void transpose_dbl_square_naive(double* A, size_t n);
+void transpose_fcmplx_square_naive(float complex* A, size_t n);
+void transpose_dcmplx_square_naive(double complex* A, size_t n);
+
+void transpose_flt_square_blocked(float* A, size_t n, size_t blk);
+void transpose_dbl_square_blocked(double* A, size_t n, size_t blk);
+void transpose_fcmplx_square_blocked(float complex* A, size_t n, size_t blk);
+void transpose_dcmplx_square_blocked(double complex* A, size_t n, size_t blk);
+
+void transpose_flt_inplace(float* A, size_t A_rows, size_t A_cols);
+void transpose_dbl_inplace(double* A, size_t A_rows, size_t A_cols);
+void transpose_fcmplx_inplace(float complex* A, size_t A_rows, size_t A_cols);
+void transpose_dcmplx_inplace(double complex* A, size_t A_rows, size_t A_cols);
+
+void transpose_flt_recursive(const float* restrict A,
+                             float* restrict B,
+                             size_t A_rows, size_t A_cols);
+void transpose_dbl_recursive(const double* restrict A,
+                             double* restrict B,
+                             size_t A_rows, size_t A_cols);
+void transpose_fcmplx_recursive(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+void transpose_dcmplx_recursive(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols);
+
+void transpose_flt_morton(const float* restrict A,
+                          float* restrict B,
+                          size_t A_rows, size_t A_cols);
+void transpose_dbl_morton(const double* restrict A,
+                          double* restrict B,
+                          size_t A_rows, size_t A_cols);
+void transpose_fcmplx_morton(const float complex* restrict A,
+                             float complex* restrict B,
+                             size_t A_rows, size_t A_cols);
+void transpose_dcmplx_morton(const double complex* restrict A,
+                             double complex* restrict B,
+                             size_t A_rows, size_t A_cols);
+
+void transpose_flt_hilbert(const float* restrict A,
+                           float* restrict B,
+                           size_t A_rows, size_t A_cols);
+void transpose_dbl_hilbert(const double* restrict A,
+                           double* restrict B,
+                           size_t A_rows, size_t A_cols);
+void transpose_fcmplx_hilbert(const float complex* restrict A,
+                              float complex* restrict B,
+                              size_t A_rows, size_t A_cols);
+void transpose_dcmplx_hilbert(const double complex* restrict A,
+                              double complex* restrict B,
+                              size_t A_rows, size_t A_cols);
+
+void transpose_flt_tlb(const float* restrict A,
+                       float* restrict B,
+                       size_t A_rows, size_t A_cols);
+void transpose_dbl_tlb(const double* restrict A,
+                       double* restrict B,
+                       size_t A_rows, size_t A_cols);
+void transpose_fcmplx_tlb(const float complex* restrict A,
+                          float complex* restrict B,
+                          size_t A_rows, size_t A_cols);
+void transpose_dcmplx_tlb(const double complex* restrict A,
+                          double complex* restrict B,
+                          size_t A_rows, size_t A_cols);
+
+/*
+ * TLB-aware transposes go through a tile buffer the size of A, which is kept
+ * between calls with the same size.  Reserve it ahead of the timed transposes
+ * (elements of size elsize), so it's allocated and faulted in only once, and
+ * release it when done.
+ */
+void transpose_tlb_reserve(size_t A_rows, size_t A_cols, size_t elsize);
+void transpose_tlb_release(void);
+
+/*
+ * Transpose a batch of count A_rows x A_cols matrices: matrix i starts at
+ * &A[i * stride] and its transpose at &B[i * stride], where
+ * stride >= A_rows * A_cols.  Each matrix is transposed cache-obliviously, as
+ * by the recursive transposes, without a call per matrix.
+ */
+void transpose_flt_batch(const float* restrict A,
+                         float* restrict B,
+                         size_t A_rows, size_t A_cols,
+                         size_t count, size_t stride);
+void transpose_dbl_batch(const double* restrict A,
+                         double* restrict B,
+                         size_t A_rows, size_t A_cols,
+                         size_t count, size_t stride);
+void transpose_fcmplx_batch(const float complex* restrict A,
+                            float complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride);
+void transpose_dcmplx_batch(const double complex* restrict A,
+                            double complex* restrict B,
+                            size_t A_rows, size_t A_cols,
+                            size_t count, size_t stride);
+
+/*
+ * Transposes with a fused epilogue (scale, conjugate, circular shift of B, and
+ * six-step FFT twiddle factors), for matrices with padded rows: lda and ldb are
+ * the row strides of A and B.
+ * Blocked variants support any block size.
+ */
+void transpose_fcmplx_naive_epi(const float complex* restrict A,
+                                float complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                const transpose_epilogue *epi);
+void transpose_dcmplx_naive_epi(const double complex* restrict A,
+                                double complex* restrict B,
+                                size_t A_rows, size_t A_cols,
+                                size_t lda, size_t ldb,
+                                const transpose_epilogue *epi);
+void transpose_fcmplx_blocked_epi(const float complex* restrict A,
+                                  float complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb,
+                                  size_t blk_rows, size_t blk_cols,
+                                  const transpose_epilogue *epi);
+void transpose_dcmplx_blocked_epi(const double complex* restrict A,
+                                  double complex* restrict B,
+                                  size_t A_rows, size_t A_cols,
+                                  size_t lda, size_t ldb,
+                                  size_t blk_rows, size_t blk_cols,
+                                  const transpose_epilogue *epi);
+
 #endif /* TRANSPOSE_H */
@@ -19,5 +19,28 @@ void matrix_print_fftw(const fftw_complex *A, size_t nrows, size_t ncols);
 int is_eq_fftw(fftw_complex a, fftw_complex b);
 
 void *assert_fftw_malloc(size_t sz);
+void free_fftw(void *ptr);
+
+/**
+ * Set flags to the FFTW planner flag for rigor "estimate", "measure",
+ * "patient", or "exhaustive".  Returns 0 on success, -1 otherwise.
+ */
+int plan_flags_fftw(const char *rigor, unsigned *flags);
+
+/**
+ * Write the name of the wisdom file in dir for rows x cols transforms planned
+ * for the given number of threads, e.g., "dir/fftw-1024x2048-t4.wisdom".
+ * Returns the length of the name, as snprintf() does.
+ */
+int wisdom_path_fftw(char *buf, size_t len, const char *dir, size_t rows,
+                     size_t cols, size_t threads);
+
+/**
+ * Import/export FFTW wisdom from/to a file.
+ * Return 0 on success, -1 with errno set otherwise (ENOENT if the file to
+ * import doesn't exist).
+ */
+int wisdom_import_fftw(const char *filename);
+int wisdom_export_fftw(const char *filename);
 
 #endif /* UTIL_FFTW_H */
@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <fftw3.h>
 
@@ -31,10 +32,71 @@ int is_eq_fftwf(fftwf_complex a, fftwf_complex b)
 
 void *assert_fftwf_malloc(size_t sz)
 {
-    void *ptr = fftwf_malloc(sz);
+    void *ptr = assert_malloc_huge(sz);
+    if (ptr) {
+        return ptr;
+    }
+    ptr = fftwf_malloc(sz);
     if (!ptr) {
         perror("fftwf_malloc");
         exit(ENOMEM);
     }
     return ptr;
 }
+
+void free_fftwf(void *ptr)
+{
+    if (!free_huge(ptr)) {
+        fftwf_free(ptr);
+    }
+}
+
+int plan_flags_fftwf(const char *rigor, unsigned *flags)
+{
+    if (!strcmp(rigor, "estimate")) {
+        *flags = FFTW_ESTIMATE;
+    } else if (!strcmp(rigor, "measure")) {
+        *flags = FFTW_MEASURE;
+    } else if (!strcmp(rigor, "patient")) {
+        *flags = FFTW_PATIENT;
+    } else if (!strcmp(rigor, "exhaustive")) {
+        *flags = FFTW_EXHAUSTIVE;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+int wisdom_path_fftwf(char *buf, size_t len, const char *dir, size_t rows,
+                      size_t cols, size_t threads)
+{
+    return snprintf(buf, len, "%s/fftwf-%zux%zu-t%zu.wisdom", dir, rows, cols,
+                    threads);
+}
+
+int wisdom_import_fftwf(const char *filename)
+{
+    // FFTW doesn't say why an import failed, so check that the file exists
+    FILE *f = fopen(filename, "r");
+    if (!f) {
+        return -1;
+    }
+    fclose(f);
+    if (!fftwf_import_wisdom_from_filename(filename)) {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+int wisdom_export_fftwf(const char *filename)
+{
+    errno = 0;
+    if (!fftwf_export_wisdom_to_filename(filename)) {
+        if (!errno) {
+            errno = EIO;
+        }
+        return -1;
+    }
+    return 0;
+}
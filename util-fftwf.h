@@ -19,5 +19,28 @@ void matrix_print_fftwf(const fftwf_complex *A, size_t nrows, size_t ncols);
 int is_eq_fftwf(fftwf_complex a, fftwf_complex b);
 
 void *assert_fftwf_malloc(size_t sz);
+void free_fftwf(void *ptr);
+
+/**
+ * Set flags to the FFTW planner flag for rigor "estimate", "measure",
+ * "patient", or "exhaustive".  Returns 0 on success, -1 otherwise.
+ */
+int plan_flags_fftwf(const char *rigor, unsigned *flags);
+
+/**
+ * Write the name of the wisdom file in dir for rows x cols transforms planned
+ * for the given number of threads, e.g., "dir/fftwf-1024x2048-t4.wisdom".
+ * Returns the length of the name, as snprintf() does.
+ */
+int wisdom_path_fftwf(char *buf, size_t len, const char *dir, size_t rows,
+                      size_t cols, size_t threads);
+
+/**
+ * Import/export FFTW wisdom from/to a file.
+ * Return 0 on success, -1 with errno set otherwise (ENOENT if the file to
+ * import doesn't exist).
+ */
+int wisdom_import_fftwf(const char *filename);
+int wisdom_export_fftwf(const char *filename);
 
 #endif /* UTIL_FFTWF_H */
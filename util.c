@@ -4,14 +4,36 @@
  * @author Connor Imes <cimes@isi.edu>
  * @date 2019-07-15 
  */
+// for MAP_ANONYMOUS, MAP_HUGETLB, and MADV_HUGEPAGE
+#define _GNU_SOURCE
 #include <complex.h>
 #include <errno.h>
 #include <float.h>
+#if defined(HAVE_MALLINFO2)
+#include <malloc.h>
+#endif
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "util.h"
 
+// used when /proc/meminfo doesn't say
+#define HUGE_PAGE_SIZE_DEFAULT (2 * 1024 * 1024)
+
+#define CACHE_LINE_SIZE 64
+
+struct huge_alloc {
+    void *ptr;
+    size_t len;
+};
+
+static int huge_pages = 0;
+static struct huge_alloc *huge_allocs = NULL;
+static size_t num_huge_allocs = 0;
+
 float rand_flt(void)
 {
     // random number in range [-0.5, 0.5] - this is what FFTW's benchfft does
@@ -143,6 +165,9 @@ void *assert_malloc_al(size_t sz)
 {
     size_t align;
     void *ptr;
+    if ((ptr = assert_malloc_huge(sz))) {
+        return ptr;
+    }
     if (sz % 64 == 0) {
         align = 64;
     } else if (sz % 32 == 0) {
@@ -166,3 +191,167 @@ void *assert_malloc_al(size_t sz)
 #endif
     return ptr;
 }
+
+void alloc_huge_pages(int enable)
+{
+    huge_pages = enable;
+}
+
+/* Returns the default huge page size, from /proc/meminfo */
+static size_t huge_page_size(void)
+{
+    static size_t size = 0;
+    char line[128];
+    FILE *f;
+    if (size) {
+        return size;
+    }
+    size = HUGE_PAGE_SIZE_DEFAULT;
+    if ((f = fopen("/proc/meminfo", "r"))) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "Hugepagesize: %zu kB", &size) == 1) {
+                size *= 1024;
+                break;
+            }
+        }
+        fclose(f);
+    }
+    return size;
+}
+
+/*
+ * Map whole huge pages, from the hugetlbfs pool if it has enough free pages,
+ * otherwise as normal pages aligned to (and advised to be backed by)
+ * transparent huge pages.
+ */
+static void *malloc_huge(size_t sz)
+{
+    const size_t hsz = huge_page_size();
+    const size_t len = (sz + hsz - 1) / hsz * hsz;
+    struct huge_alloc *allocs;
+    char *ptr;
+    uintptr_t head;
+#if defined(MAP_HUGETLB)
+    ptr = mmap(NULL, len, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED) {
+#endif
+        // over-allocate by a huge page, then trim to a huge page boundary
+        ptr = mmap(NULL, len + hsz, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            perror("mmap");
+            exit(ENOMEM);
+        }
+        head = (hsz - (uintptr_t)ptr % hsz) % hsz;
+        if (head) {
+            munmap(ptr, head);
+        }
+        munmap(ptr + head + len, hsz - head);
+        ptr += head;
+#if defined(MADV_HUGEPAGE)
+        // may fail if transparent huge pages are disabled -- not fatal
+        madvise(ptr, len, MADV_HUGEPAGE);
+#endif
+#if defined(MAP_HUGETLB)
+    }
+#endif
+    allocs = realloc(huge_allocs, (num_huge_allocs + 1) * sizeof(*allocs));
+    if (!allocs) {
+        perror("realloc");
+        exit(ENOMEM);
+    }
+    huge_allocs = allocs;
+    huge_allocs[num_huge_allocs].ptr = ptr;
+    huge_allocs[num_huge_allocs].len = len;
+    num_huge_allocs++;
+    return ptr;
+}
+
+void *assert_malloc_huge(size_t sz)
+{
+    // smaller buffers would waste most of a huge page
+    if (!huge_pages || sz < huge_page_size()) {
+        return NULL;
+    }
+    return malloc_huge(sz);
+}
+
+int free_huge(void *ptr)
+{
+    size_t i;
+    for (i = 0; i < num_huge_allocs; i++) {
+        if (huge_allocs[i].ptr == ptr) {
+            munmap(ptr, huge_allocs[i].len);
+            huge_allocs[i] = huge_allocs[--num_huge_allocs];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void free_al(void *ptr)
+{
+    if (!free_huge(ptr)) {
+        free(ptr);
+    }
+}
+
+size_t alloc_page_size(const void *ptr)
+{
+    const unsigned long addr = (unsigned long)ptr;
+    unsigned long start, end;
+    size_t kps = 0;
+    size_t ahp = 0;
+    size_t val;
+    int found = 0;
+    char line[256];
+    FILE *f;
+    // the mapping that contains ptr, as reported by /proc/self/smaps
+    if (!(f = fopen("/proc/self/smaps", "r"))) {
+        return (size_t)sysconf(_SC_PAGESIZE);
+    }
+    while (fgets(line, sizeof(line), f)) {
+        // only mapping header lines start with "start-end"
+        if (sscanf(line, "%lx-%lx ", &start, &end) == 2) {
+            if (found) {
+                break;
+            }
+            found = addr >= start && addr < end;
+        } else if (found) {
+            if (sscanf(line, "KernelPageSize: %zu kB", &val) == 1) {
+                kps = val * 1024;
+            } else if (sscanf(line, "AnonHugePages: %zu kB", &val) == 1) {
+                ahp = val;
+            }
+        }
+    }
+    fclose(f);
+    if (!kps) {
+        return (size_t)sysconf(_SC_PAGESIZE);
+    }
+    // transparent huge pages are reported separately from the base page size
+    return ahp ? huge_page_size() : kps;
+}
+
+size_t ld_padded(size_t n, size_t elsize)
+{
+    const size_t line = CACHE_LINE_SIZE / elsize ? CACHE_LINE_SIZE / elsize : 1;
+    // round up to a whole number of lines, then make the count odd
+    size_t ld = (n + line - 1) / line * line;
+    if ((ld / line) % 2 == 0) {
+        ld += line;
+    }
+    return ld;
+}
+
+size_t alloc_heap_used(void)
+{
+#if defined(HAVE_MALLINFO2)
+    // allocations from the heap, and those large enough to get their own mmap
+    const struct mallinfo2 mi = mallinfo2();
+    return mi.uordblks + mi.hblkhd;
+#else
+    return 0;
+#endif
+}
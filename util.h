@@ -32,5 +32,41 @@ int is_eq_dcmplx(double complex a, double complex b);
 
 void *assert_malloc(size_t sz);
 void *assert_malloc_al(size_t sz);
+void free_al(void *ptr);
+
+/*
+ * Back later allocations of at least one huge page by assert_malloc_al() and
+ * the library-specific assert_*_malloc() functions with huge pages: from the
+ * hugetlbfs pool (MAP_HUGETLB) if it has enough free pages, otherwise with
+ * transparent huge pages (madvise(MADV_HUGEPAGE)), if the kernel allows.
+ * Such buffers must be freed with free_al() (or the library-specific free).
+ */
+void alloc_huge_pages(int enable);
+
+/* Returns a buffer backed by huge pages, or NULL if not enabled or too small */
+void *assert_malloc_huge(size_t sz);
+
+/* Frees ptr and returns 1 if it came from assert_malloc_huge(), else returns 0 */
+int free_huge(void *ptr);
+
+/*
+ * Returns the size of the pages backing the (touched) memory at ptr, counting
+ * transparent huge pages if the kernel used any.
+ */
+size_t alloc_page_size(const void *ptr);
+
+/*
+ * Returns a leading dimension (row stride, in elements) of at least n elements
+ * of size elsize, padded so that the stride in bytes is an odd number of cache
+ * lines.  Rows then start on a cache line, but consecutive rows don't map to
+ * the same cache sets, as they do when the stride is a large power of two.
+ */
+size_t ld_padded(size_t n, size_t elsize);
+
+/*
+ * Returns the bytes of heap memory currently allocated by malloc(), e.g., to
+ * measure what a library allocates internally, or 0 if unknown.
+ */
+size_t alloc_heap_used(void);
 
 #endif /* UTIL_H */